@@ -0,0 +1,72 @@
+#ifndef PIIXELENGINE_AUDIOBACKEND_HPP
+#define PIIXELENGINE_AUDIOBACKEND_HPP
+
+#include "Components/AudioSource.hpp"
+
+#include <cstdint>
+#include <memory>
+
+namespace PiiXeL {
+
+class AudioAsset;
+
+enum class AudioBackendType { Device, Offline, Mixer };
+
+class AudioBackend {
+public:
+    virtual ~AudioBackend() = default;
+
+    virtual bool Initialize() = 0;
+    virtual void Shutdown() = 0;
+    virtual void Advance(float deltaTime) = 0;
+    virtual void SetMasterVolume(float volume) = 0;
+
+    [[nodiscard]] virtual AudioBackendType GetType() const = 0;
+    [[nodiscard]] virtual uint32_t GetPcmSampleRate() const { return 0; }
+
+    virtual uint32_t CreateVoice(const AudioAsset& clip) = 0;
+    virtual void DestroyVoice(uint32_t voice) = 0;
+
+    virtual void PlayVoice(uint32_t voice) = 0;
+    virtual void StopVoice(uint32_t voice) = 0;
+    virtual void PauseVoice(uint32_t voice) = 0;
+    virtual void ResumeVoice(uint32_t voice) = 0;
+    [[nodiscard]] virtual bool IsVoicePlaying(uint32_t voice) const = 0;
+    // Moves a playing voice to a position in seconds. Backends that cannot seek keep playing from the start.
+    virtual void SeekVoice(uint32_t voice, float seconds) {
+        (void)voice;
+        (void)seconds;
+    }
+
+    virtual void SetVoiceVolume(uint32_t voice, float volume) = 0;
+    virtual void SetVoicePitch(uint32_t voice, float pitch) = 0;
+    virtual void SetVoicePan(uint32_t voice, float pan) = 0;
+    virtual void SetVoiceBus(uint32_t voice, AudioBus bus) {
+        (void)voice;
+        (void)bus;
+    }
+
+    virtual void SetBusGain(AudioBus bus, float gain) {
+        (void)bus;
+        (void)gain;
+    }
+    virtual void SetBusDucking(AudioBus target, AudioBus trigger, float amount) {
+        (void)target;
+        (void)trigger;
+        (void)amount;
+    }
+    virtual void SetBusParent(AudioBus bus, AudioBus parent) {
+        (void)bus;
+        (void)parent;
+    }
+
+    // Blocks until every queued voice change has reached the output thread.
+    virtual void Flush() {}
+
+    static std::unique_ptr<AudioBackend> Create(AudioBackendType type);
+    static const char* GetTypeName(AudioBackendType type);
+};
+
+} // namespace PiiXeL
+
+#endif
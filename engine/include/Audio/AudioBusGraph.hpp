@@ -0,0 +1,38 @@
+#ifndef PIIXELENGINE_AUDIOBUSGRAPH_HPP
+#define PIIXELENGINE_AUDIOBUSGRAPH_HPP
+
+#include "Components/AudioSource.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace PiiXeL {
+
+// Routing of the mix buses. Every bus except Master feeds exactly one parent, so the buses form a tree rooted at
+// Master; by default Ambience is a child of Sfx and the others feed Master directly.
+class AudioBusGraph {
+public:
+    static constexpr uint32_t BusCount{static_cast<uint32_t>(AudioBus::Count)};
+
+    AudioBusGraph();
+
+    // Rejects Master, out of range buses and any parent that would close a cycle.
+    bool SetParent(AudioBus bus, AudioBus parent);
+    [[nodiscard]] AudioBus GetParent(AudioBus bus) const;
+
+    // True when bus is ancestor itself or routes into it through any number of parents.
+    [[nodiscard]] bool IsWithin(AudioBus bus, AudioBus ancestor) const;
+
+    // Every bus but Master, children before their parents.
+    [[nodiscard]] const std::array<AudioBus, BusCount - 1>& GetMixOrder() const { return m_MixOrder; }
+
+private:
+    void RebuildMixOrder();
+
+    std::array<AudioBus, BusCount> m_Parents{};
+    std::array<AudioBus, BusCount - 1> m_MixOrder{};
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_AUDIOBUSGRAPH_HPP
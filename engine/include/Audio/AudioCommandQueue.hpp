@@ -0,0 +1,59 @@
+#ifndef PIIXELENGINE_AUDIOCOMMANDQUEUE_HPP
+#define PIIXELENGINE_AUDIOCOMMANDQUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace PiiXeL {
+
+enum class AudioCommandType : uint8_t {
+    CreateVoice,
+    DestroyVoice,
+    PlayVoice,
+    StopVoice,
+    PauseVoice,
+    ResumeVoice,
+    SeekVoice,
+    SetVoiceVolume,
+    SetVoicePitch,
+    SetVoicePan,
+    SetVoiceBus,
+    SetBusGain,
+    SetBusDucking,
+    SetBusParent,
+    SetMasterVolume
+};
+
+struct AudioCommand {
+    AudioCommandType type{AudioCommandType::SetMasterVolume};
+    uint32_t target{0};
+    uint32_t argument{0};
+    float value{0.0f};
+    const float* pcm{nullptr};
+    uint32_t frameCount{0};
+};
+
+// Single-producer single-consumer ring: the main thread pushes, the mixer pops.
+class AudioCommandQueue {
+public:
+    static constexpr size_t Capacity{1024};
+
+    bool Push(const AudioCommand& command);
+    bool Pop(AudioCommand& command);
+    void Clear();
+
+    [[nodiscard]] bool IsEmpty() const;
+
+private:
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    std::array<AudioCommand, Capacity> m_Buffer{};
+    alignas(64) std::atomic<size_t> m_Head{0};
+    alignas(64) std::atomic<size_t> m_Tail{0};
+};
+
+} // namespace PiiXeL
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef PIIXELENGINE_AUDIODECODEQUEUE_HPP
+#define PIIXELENGINE_AUDIODECODEQUEUE_HPP
+
+#include "Components/UUID.hpp"
+#include "Resources/AssetRegistry.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace PiiXeL {
+
+class AudioAsset;
+
+// Decodes audio clips as JobSystem jobs; Update() hands finished clips to the AssetRegistry on the main thread.
+// A failed decode is retried from Update() with exponential backoff and only counts as failed once MaxAttempts
+// decodes have failed; until then the clip stays pending.
+class AudioDecodeQueue {
+public:
+    static constexpr uint32_t MaxAttempts{4};
+
+    AudioDecodeQueue(const AudioDecodeQueue&) = delete;
+    AudioDecodeQueue& operator=(const AudioDecodeQueue&) = delete;
+
+    static AudioDecodeQueue& Instance();
+
+    void Request(UUID uuid);
+    void Update();
+    void Clear();
+
+    [[nodiscard]] bool IsPending(UUID uuid) const;
+    [[nodiscard]] bool HasFailed(UUID uuid) const;
+    [[nodiscard]] size_t GetPendingCount() const;
+
+private:
+    struct Job {
+        UUID uuid{0};
+        AssetSource source{};
+        uint32_t pcmSampleRate{0};
+        uint64_t epoch{0};
+    };
+
+    struct Result {
+        UUID uuid{0};
+        std::shared_ptr<AudioAsset> asset{};
+    };
+
+    struct Failure {
+        uint32_t attempts{0};
+        std::chrono::steady_clock::time_point retryAt{};
+    };
+
+    AudioDecodeQueue() = default;
+
+    void Enqueue(UUID uuid);
+    void RecordFailure(UUID uuid);
+    void Run(const Job& job);
+    [[nodiscard]] static std::shared_ptr<AudioAsset> Decode(const Job& job);
+
+    std::vector<Result> m_Completed;
+    std::unordered_set<UUID> m_Pending;
+    std::unordered_map<UUID, Failure> m_Failures;
+    mutable std::mutex m_Mutex;
+    // Bumped by Clear() so decodes still running for the cleared requests are dropped.
+    uint64_t m_Epoch{0};
+};
+
+} // namespace PiiXeL
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef PIIXELENGINE_AUDIOMIXKERNELS_HPP
+#define PIIXELENGINE_AUDIOMIXKERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// All buffers are interleaved stereo float. Gains ramp linearly across the block to avoid zipper noise.
+namespace PiiXeL::AudioMixKernels {
+
+struct StereoGain {
+    float left{1.0f};
+    float right{1.0f};
+};
+
+// Linear-interpolating resampler. Advances cursor by step per output frame and returns the number of frames
+// written; fewer than frameCount means the clip ended.
+uint32_t ResampleAdd(float* output, uint32_t frameCount, const float* source, size_t sourceFrames, double& cursor,
+                     double step, StereoGain from, StereoGain to);
+
+void AddScaled(float* output, const float* input, uint32_t frameCount, float from, float to);
+void Scale(float* buffer, uint32_t frameCount, float from, float to);
+void Clamp(float* buffer, uint32_t frameCount);
+[[nodiscard]] float Peak(const float* buffer, uint32_t frameCount);
+
+[[nodiscard]] const char* GetInstructionSet();
+
+} // namespace PiiXeL::AudioMixKernels
+
+#endif
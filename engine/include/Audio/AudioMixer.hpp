@@ -0,0 +1,158 @@
+#ifndef PIIXELENGINE_AUDIOMIXER_HPP
+#define PIIXELENGINE_AUDIOMIXER_HPP
+
+#include "Audio/AudioBusGraph.hpp"
+#include "Audio/AudioCommandQueue.hpp"
+#include "Audio/AudioMixKernels.hpp"
+#include "Components/AudioSource.hpp"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace PiiXeL {
+
+struct AudioMixerStats {
+    double lastMixMs{0.0};
+    double peakMixMs{0.0};
+    double load{0.0};
+    uint64_t renderedFrames{0};
+    uint64_t underruns{0};
+    uint32_t activeVoices{0};
+};
+
+// Voice and bus setters run on the main thread and only enqueue commands; Render() runs on the mixer thread
+// (or inline for offline rendering) and is the sole owner of the mixing state. A threaded mixer renders ahead into
+// an output ring that the device callback drains with ReadOutput(), so no mixing happens on the device thread.
+class AudioMixer {
+public:
+    static constexpr uint32_t MaxVoices{256};
+    static constexpr uint32_t MaxBlockFrames{2048};
+    static constexpr uint32_t OutputBlockFrames{256};
+    static constexpr uint32_t OutputRingFrames{2048};
+    static constexpr uint32_t BusCount{static_cast<uint32_t>(AudioBus::Count)};
+
+    AudioMixer() = default;
+    ~AudioMixer();
+
+    AudioMixer(const AudioMixer&) = delete;
+    AudioMixer& operator=(const AudioMixer&) = delete;
+
+    void Initialize(uint32_t sampleRate, bool threaded);
+    void Shutdown();
+
+    uint32_t CreateVoice(const float* pcm, uint32_t frameCount);
+    void DestroyVoice(uint32_t voice);
+
+    void PlayVoice(uint32_t voice);
+    void StopVoice(uint32_t voice);
+    void PauseVoice(uint32_t voice);
+    void ResumeVoice(uint32_t voice);
+    [[nodiscard]] bool IsVoicePlaying(uint32_t voice) const;
+    // Applies after the voice's last PlayVoice, which starts it from the beginning.
+    void SeekVoice(uint32_t voice, float seconds);
+
+    void SetVoiceVolume(uint32_t voice, float volume);
+    void SetVoicePitch(uint32_t voice, float pitch);
+    void SetVoicePan(uint32_t voice, float pan);
+    void SetVoiceBus(uint32_t voice, AudioBus bus);
+
+    void SetBusGain(AudioBus bus, float gain);
+    void SetBusDucking(AudioBus target, AudioBus trigger, float amount);
+    void SetBusParent(AudioBus bus, AudioBus parent);
+    void SetMasterVolume(float volume);
+
+    void Flush();
+
+    void Render(float* output, uint32_t frameCount);
+    // Device thread side of a threaded mixer; fills with silence on underrun and never blocks.
+    void ReadOutput(float* output, uint32_t frameCount);
+
+    [[nodiscard]] AudioMixerStats GetStats() const;
+    [[nodiscard]] uint32_t GetSampleRate() const { return m_SampleRate; }
+
+private:
+    struct VoiceControl {
+        uint32_t serial{0};
+        bool alive{false};
+        bool playing{false};
+        bool paused{false};
+    };
+
+    struct VoiceState {
+        const float* pcm{nullptr};
+        uint32_t frameCount{0};
+        uint32_t serial{0};
+        double cursor{0.0};
+        float volume{1.0f};
+        float pitch{1.0f};
+        float pan{0.5f};
+        AudioMixKernels::StereoGain gain{};
+        AudioBus bus{AudioBus::Sfx};
+        bool playing{false};
+        bool paused{false};
+    };
+
+    struct BusState {
+        float gain{1.0f};
+        float appliedGain{1.0f};
+        AudioBus duckTrigger{AudioBus::Master};
+        float duckAmount{0.0f};
+        float duckEnvelope{0.0f};
+    };
+
+    [[nodiscard]] VoiceControl* GetControl(uint32_t voice);
+    [[nodiscard]] const VoiceControl* GetControl(uint32_t voice) const;
+    void Submit(const AudioCommand& command);
+    void ProcessCommands();
+    void Apply(const AudioCommand& command);
+    void RenderBlock(float* output, uint32_t frameCount);
+    void MixThreadMain();
+    void WakeMixThread();
+
+    AudioCommandQueue m_Commands;
+    uint64_t m_SubmittedCommands{0};
+    std::atomic<uint64_t> m_ProcessedCommands{0};
+    AudioBusGraph m_ControlGraph;
+
+    std::vector<VoiceControl> m_Controls;
+    std::vector<uint32_t> m_FreeVoices;
+    std::unique_ptr<std::atomic<uint32_t>[]> m_FinishedSerials;
+
+    std::vector<VoiceState> m_Voices;
+    std::array<BusState, BusCount> m_Buses{};
+    AudioBusGraph m_BusGraph;
+    std::array<std::vector<float>, BusCount> m_BusBuffers{};
+    float m_MasterVolume{1.0f};
+    float m_AppliedMasterVolume{1.0f};
+
+    std::atomic<uint64_t> m_LastMixNanos{0};
+    std::atomic<uint64_t> m_PeakMixNanos{0};
+    std::atomic<uint64_t> m_TotalMixNanos{0};
+    std::atomic<uint64_t> m_RenderedFrames{0};
+    std::atomic<uint32_t> m_ActiveVoices{0};
+
+    std::thread m_MixThread;
+    std::mutex m_MixMutex;
+    std::condition_variable m_MixWake;
+    std::condition_variable m_FlushDone;
+    std::atomic<bool> m_WakeRequested{false};
+    bool m_StopRequested{false};
+    std::vector<float> m_OutputRing;
+    alignas(64) std::atomic<uint64_t> m_OutputRead{0};
+    alignas(64) std::atomic<uint64_t> m_OutputWrite{0};
+    std::atomic<uint64_t> m_Underruns{0};
+
+    uint32_t m_SampleRate{48000};
+    bool m_Threaded{false};
+    bool m_IsInitialized{false};
+};
+
+} // namespace PiiXeL
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef PIIXELENGINE_AUDIOSTREAMPUMP_HPP
+#define PIIXELENGINE_AUDIOSTREAMPUMP_HPP
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace PiiXeL {
+
+class AudioAsset;
+
+class AudioStreamPump {
+public:
+    AudioStreamPump(const AudioStreamPump&) = delete;
+    AudioStreamPump& operator=(const AudioStreamPump&) = delete;
+
+    static AudioStreamPump& Instance();
+
+    void Register(AudioAsset* asset);
+    void Unregister(AudioAsset* asset);
+
+    [[nodiscard]] size_t GetStreamCount() const;
+
+private:
+    AudioStreamPump() = default;
+    ~AudioStreamPump();
+
+    void Run();
+
+    std::vector<AudioAsset*> m_Streams;
+    mutable std::mutex m_Mutex;
+    std::thread m_Thread;
+    std::atomic<bool> m_Running{false};
+};
+
+} // namespace PiiXeL
+
+#endif
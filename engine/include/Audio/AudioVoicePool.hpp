@@ -0,0 +1,72 @@
+#ifndef PIIXELENGINE_AUDIOVOICEPOOL_HPP
+#define PIIXELENGINE_AUDIOVOICEPOOL_HPP
+
+#include "Components/AudioSource.hpp"
+#include "Components/UUID.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace PiiXeL {
+
+class AudioAsset;
+class AudioBackend;
+
+struct AudioVoice {
+    uint32_t backendVoice{0};
+    UUID clip{0};
+    entt::entity owner{entt::null};
+    uint32_t serial{0};
+    float priority{128.0f};
+    float audibility{1.0f};
+    double startTime{0.0};
+    bool active{false};
+    bool paused{false};
+};
+
+class AudioVoicePool {
+public:
+    static constexpr uint32_t DefaultMaxVoices{32};
+
+    AudioVoicePool() = default;
+    ~AudioVoicePool();
+
+    AudioVoicePool(const AudioVoicePool&) = delete;
+    AudioVoicePool& operator=(const AudioVoicePool&) = delete;
+
+    void Initialize(AudioBackend* backend, uint32_t maxVoices = DefaultMaxVoices);
+    void Shutdown();
+    void Advance(float deltaTime) { m_Time += deltaTime; }
+
+    [[nodiscard]] AudioVoiceHandle Acquire(const AudioAsset& asset, UUID clip, entt::entity owner, float priority,
+                                           float audibility);
+    void Release(AudioVoiceHandle handle);
+    void ReleaseClip(UUID clip);
+    void ReleaseAll();
+
+    [[nodiscard]] uint32_t GetBackendVoice(AudioVoiceHandle handle);
+    void SetAudibility(AudioVoiceHandle handle, float audibility);
+    void SetPaused(AudioVoiceHandle handle, bool paused);
+    [[nodiscard]] bool IsPaused(AudioVoiceHandle handle);
+
+    void SetMaxVoices(uint32_t maxVoices);
+    [[nodiscard]] uint32_t GetMaxVoices() const { return static_cast<uint32_t>(m_Voices.size()); }
+    [[nodiscard]] uint32_t GetActiveVoiceCount() const;
+    [[nodiscard]] bool HasFreeVoice() const;
+
+private:
+    [[nodiscard]] AudioVoice* Resolve(AudioVoiceHandle handle);
+    [[nodiscard]] bool IsFree(const AudioVoice& voice) const;
+    [[nodiscard]] float ComputeScore(float priority, float audibility, double startTime) const;
+    void ReleaseBackendVoice(AudioVoice& voice);
+
+    AudioBackend* m_Backend{nullptr};
+    std::vector<AudioVoice> m_Voices;
+    double m_Time{0.0};
+};
+
+} // namespace PiiXeL
+
+#endif
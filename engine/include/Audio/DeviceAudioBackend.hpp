@@ -0,0 +1,74 @@
+#ifndef PIIXELENGINE_DEVICEAUDIOBACKEND_HPP
+#define PIIXELENGINE_DEVICEAUDIOBACKEND_HPP
+
+#include "Audio/AudioBackend.hpp"
+#include "Audio/AudioBusGraph.hpp"
+
+#include <array>
+#include <raylib.h>
+#include <vector>
+
+namespace PiiXeL {
+
+// Plays each voice as a raylib sound alias. raylib has no submixes, so bus gain and ducking are folded into every
+// voice's volume: Advance() walks each voice's route up to Master and re-applies the volume when the product moves.
+class DeviceAudioBackend : public AudioBackend {
+public:
+    DeviceAudioBackend() = default;
+    ~DeviceAudioBackend() override;
+
+    bool Initialize() override;
+    void Shutdown() override;
+    void Advance(float deltaTime) override;
+    void SetMasterVolume(float volume) override;
+
+    [[nodiscard]] AudioBackendType GetType() const override { return AudioBackendType::Device; }
+
+    uint32_t CreateVoice(const AudioAsset& clip) override;
+    void DestroyVoice(uint32_t voice) override;
+
+    void PlayVoice(uint32_t voice) override;
+    void StopVoice(uint32_t voice) override;
+    void PauseVoice(uint32_t voice) override;
+    void ResumeVoice(uint32_t voice) override;
+    [[nodiscard]] bool IsVoicePlaying(uint32_t voice) const override;
+
+    void SetVoiceVolume(uint32_t voice, float volume) override;
+    void SetVoicePitch(uint32_t voice, float pitch) override;
+    void SetVoicePan(uint32_t voice, float pan) override;
+    void SetVoiceBus(uint32_t voice, AudioBus bus) override;
+
+    void SetBusGain(AudioBus bus, float gain) override;
+    void SetBusDucking(AudioBus target, AudioBus trigger, float amount) override;
+    void SetBusParent(AudioBus bus, AudioBus parent) override;
+
+private:
+    struct Voice {
+        Sound sound{};
+        float volume{1.0f};
+        float appliedVolume{-1.0f};
+        AudioBus bus{AudioBus::Sfx};
+    };
+
+    struct BusState {
+        float gain{1.0f};
+        AudioBus duckTrigger{AudioBus::Master};
+        float duckAmount{0.0f};
+        float duckEnvelope{0.0f};
+    };
+
+    [[nodiscard]] const Sound* GetSound(uint32_t voice) const;
+    [[nodiscard]] float GetRouteGain(AudioBus bus) const;
+    void ApplyVolume(Voice& voice) const;
+    void ApplyAllVolumes();
+
+    std::vector<Voice> m_Voices;
+    std::vector<uint32_t> m_FreeVoices;
+    std::array<BusState, AudioBusGraph::BusCount> m_Buses{};
+    AudioBusGraph m_BusGraph;
+    bool m_IsInitialized{false};
+};
+
+} // namespace PiiXeL
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef PIIXELENGINE_MIXERAUDIOBACKEND_HPP
+#define PIIXELENGINE_MIXERAUDIOBACKEND_HPP
+
+#include "Audio/AudioBackend.hpp"
+#include "Audio/AudioMixer.hpp"
+
+#include <atomic>
+#include <raylib.h>
+
+namespace PiiXeL {
+
+// Mixes on the AudioMixer's own thread; the raylib stream callback only copies finished blocks out of its ring.
+class MixerAudioBackend : public AudioBackend {
+public:
+    static constexpr uint32_t DefaultSampleRate{48000};
+    static constexpr uint32_t Channels{2};
+    static constexpr uint32_t StreamBufferFrames{1024};
+
+    explicit MixerAudioBackend(uint32_t sampleRate = DefaultSampleRate);
+    ~MixerAudioBackend() override;
+
+    bool Initialize() override;
+    void Shutdown() override;
+    void Advance(float deltaTime) override { (void)deltaTime; }
+    void SetMasterVolume(float volume) override { m_Mixer.SetMasterVolume(volume); }
+
+    [[nodiscard]] AudioBackendType GetType() const override { return AudioBackendType::Mixer; }
+    [[nodiscard]] uint32_t GetPcmSampleRate() const override { return m_SampleRate; }
+
+    uint32_t CreateVoice(const AudioAsset& clip) override;
+    void DestroyVoice(uint32_t voice) override { m_Mixer.DestroyVoice(voice); }
+
+    void PlayVoice(uint32_t voice) override { m_Mixer.PlayVoice(voice); }
+    void StopVoice(uint32_t voice) override { m_Mixer.StopVoice(voice); }
+    void PauseVoice(uint32_t voice) override { m_Mixer.PauseVoice(voice); }
+    void ResumeVoice(uint32_t voice) override { m_Mixer.ResumeVoice(voice); }
+    [[nodiscard]] bool IsVoicePlaying(uint32_t voice) const override { return m_Mixer.IsVoicePlaying(voice); }
+    void SeekVoice(uint32_t voice, float seconds) override { m_Mixer.SeekVoice(voice, seconds); }
+
+    void SetVoiceVolume(uint32_t voice, float volume) override { m_Mixer.SetVoiceVolume(voice, volume); }
+    void SetVoicePitch(uint32_t voice, float pitch) override { m_Mixer.SetVoicePitch(voice, pitch); }
+    void SetVoicePan(uint32_t voice, float pan) override { m_Mixer.SetVoicePan(voice, pan); }
+    void SetVoiceBus(uint32_t voice, AudioBus bus) override { m_Mixer.SetVoiceBus(voice, bus); }
+
+    void SetBusGain(AudioBus bus, float gain) override { m_Mixer.SetBusGain(bus, gain); }
+    void SetBusDucking(AudioBus target, AudioBus trigger, float amount) override {
+        m_Mixer.SetBusDucking(target, trigger, amount);
+    }
+    void SetBusParent(AudioBus bus, AudioBus parent) override { m_Mixer.SetBusParent(bus, parent); }
+
+    void Flush() override { m_Mixer.Flush(); }
+
+    [[nodiscard]] AudioMixerStats GetMixerStats() const { return m_Mixer.GetStats(); }
+    [[nodiscard]] uint32_t GetSampleRate() const { return m_SampleRate; }
+
+protected:
+    AudioMixer m_Mixer;
+    uint32_t m_SampleRate{DefaultSampleRate};
+
+private:
+    static void StreamCallback(void* bufferData, unsigned int frames);
+
+    static std::atomic<MixerAudioBackend*> s_Active;
+
+    AudioStream m_Stream{};
+    bool m_IsDeviceOpen{false};
+};
+
+} // namespace PiiXeL
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef PIIXELENGINE_OFFLINEAUDIOBACKEND_HPP
+#define PIIXELENGINE_OFFLINEAUDIOBACKEND_HPP
+
+#include "Audio/MixerAudioBackend.hpp"
+
+#include <vector>
+
+namespace PiiXeL {
+
+// Renders the mixer inline on the simulation clock instead of on a device thread.
+class OfflineAudioBackend : public MixerAudioBackend {
+public:
+    explicit OfflineAudioBackend(uint32_t sampleRate = DefaultSampleRate);
+    ~OfflineAudioBackend() override;
+
+    bool Initialize() override;
+    void Shutdown() override;
+    void Advance(float deltaTime) override;
+
+    [[nodiscard]] AudioBackendType GetType() const override { return AudioBackendType::Offline; }
+
+    void Render(uint32_t frameCount);
+
+    void SetCaptureEnabled(bool enabled) { m_CaptureEnabled = enabled; }
+    void ClearCapture() { m_Capture.clear(); }
+    [[nodiscard]] const std::vector<float>& GetCapture() const { return m_Capture; }
+    [[nodiscard]] uint64_t GetRenderedFrames() const { return m_RenderedFrames; }
+
+private:
+    std::vector<float> m_MixBuffer;
+    std::vector<float> m_Capture;
+    double m_PendingFrames{0.0};
+    uint64_t m_RenderedFrames{0};
+    bool m_CaptureEnabled{false};
+};
+
+} // namespace PiiXeL
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -36,14 +37,17 @@ public:
     void SetConfig(const nlohmann::json& config);
 
     [[nodiscard]] const GamePackageHeader& GetHeader() const { return m_Header; }
-    [[nodiscard]] const std::vector<std::pair<std::string, nlohmann::json>>& GetScenes() const { return m_Scenes; }
+    // Scene documents are shared so an asynchronous load can keep its scene alive after the package goes away.
+    [[nodiscard]] const std::vector<std::pair<std::string, std::shared_ptr<const nlohmann::json>>>& GetScenes() const {
+        return m_Scenes;
+    }
     [[nodiscard]] const std::vector<AssetData>& GetAssets() const { return m_Assets; }
     [[nodiscard]] const nlohmann::json& GetConfig() const { return m_Config; }
     [[nodiscard]] const AssetData* GetAsset(const std::string& path) const;
 
 private:
     GamePackageHeader m_Header;
-    std::vector<std::pair<std::string, nlohmann::json>> m_Scenes;
+    std::vector<std::pair<std::string, std::shared_ptr<const nlohmann::json>>> m_Scenes;
     std::vector<AssetData> m_Assets;
     nlohmann::json m_Config;
     std::unordered_map<std::string, size_t> m_AssetIndexMap;
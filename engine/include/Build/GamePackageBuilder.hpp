@@ -1,6 +1,7 @@
 #ifndef PIIXELENGINE_GAMEPACKAGEBUILDER_HPP
 #define PIIXELENGINE_GAMEPACKAGEBUILDER_HPP
 
+#include <filesystem>
 #include <string>
 
 #include "GamePackage.hpp"
@@ -16,6 +17,17 @@ public:
 
 private:
     void ScanScenes(const std::string& scenesPath, GamePackage& package);
+    void AddScene(GamePackage& package, const std::string& sceneName, const nlohmann::json& sceneData);
+    // Packages the world partition saved next to scenePath, if any: the manifest goes to
+    // "scenes/<sceneName>.partition" and its chunks keep their path relative to it, so the runtime streams the
+    // cells straight from the package.
+    void AddWorldPartition(GamePackage& package, const std::string& sceneName,
+                           const std::filesystem::path& scenePath);
+    // Adds the binary form of every packaged scene, which the runtime loads instead when it is present. Runs after
+    // the assets are collected, so prefab instances resolve against the packaged prefabs; returns false when a
+    // delta-encoded scene names a prefab the package does not contain.
+    bool AddBinaryScenes(GamePackage& package);
+    bool ResolvePrefabBases(const std::string& sceneName, const nlohmann::json& sceneData);
     void ScanAssets(const std::string& assetsPath, GamePackage& package);
     void CollectAssetsFromScenes(GamePackage& package, const std::filesystem::path& basePath);
     AssetData LoadAssetFile(const std::string& filepath, const std::string& type);
@@ -26,6 +26,7 @@ struct Animator {
     float transitionTime{0.0f};
     float transitionDuration{0.0f};
     bool isTransitioning{false};
+    bool isFinished{false};
 };
 
 } // namespace PiiXeL
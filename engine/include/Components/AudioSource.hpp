@@ -3,11 +3,33 @@
 
 #include "Components/UUID.hpp"
 
+#include <cstdint>
 #include <raylib.h>
 
 namespace PiiXeL {
 
-enum class AudioSourceState { Stopped, Playing, Paused };
+class AudioAsset;
+
+enum class AudioSourceState { Stopped, Playing, Paused, Pending };
+
+enum class AudioPendingPolicy : uint8_t { Delay = 0, Skip = 1 };
+
+enum class AudioBus : uint8_t { Master = 0, Music = 1, Sfx = 2, UI = 3, Ambience = 4, Count = 5 };
+
+// Resolved clip, valid while the generation of its AssetRegistry slot is unchanged.
+struct AudioClipHandle {
+    UUID clip{0};
+    uint32_t slot{0};
+    uint32_t generation{0};
+    AudioAsset* asset{nullptr};
+};
+
+struct AudioVoiceHandle {
+    int32_t index{-1};
+    uint32_t serial{0};
+
+    [[nodiscard]] bool IsValid() const { return index >= 0; }
+};
 
 struct AudioSource {
     UUID audioClip{0};
@@ -28,9 +50,15 @@ struct AudioSource {
 
     float priority{128.0f};
 
+    AudioBus bus{AudioBus::Sfx};
+    AudioPendingPolicy pendingPolicy{AudioPendingPolicy::Delay};
+
     float playbackPosition{0.0f};
 
-    void* backendSourceID{nullptr};
+    AudioClipHandle clipHandle{};
+    AudioVoiceHandle voice{};
+    bool isVirtual{false};
+    bool isStreaming{false};
 
     bool hasPlayedOnAwake{false};
 
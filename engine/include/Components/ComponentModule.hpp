@@ -4,10 +4,16 @@
 #include <entt/entt.hpp>
 #include <nlohmann/json.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <typeindex>
+#include <vector>
 
 namespace PiiXeL {
 
@@ -20,13 +26,33 @@ public:
     virtual ~IComponentModule() = default;
 
     virtual const char* GetName() const = 0;
+    // entt::hashed_string of the name, computed once; codec lookups compare these instead of strings.
+    virtual entt::id_type GetNameHash() const = 0;
     virtual std::type_index GetTypeIndex() const = 0;
 
-    virtual nlohmann::json Serialize(entt::registry& registry, entt::entity entity) const = 0;
+    virtual nlohmann::json Serialize(const entt::registry& registry, entt::entity entity) const = 0;
     virtual void Deserialize(entt::registry& registry, entt::entity entity, const nlohmann::json& data) = 0;
+    // The JSON of a default-constructed component; delta-encoded scenes only write the fields that differ from it.
+    virtual const nlohmann::json& GetDefaultJson() const = 0;
 
-    virtual bool HasComponent(entt::registry& registry, entt::entity entity) const = 0;
+    virtual bool HasComponent(const entt::registry& registry, entt::entity entity) const = 0;
     virtual void RemoveComponent(entt::registry& registry, entt::entity entity) = 0;
+    // Copies the source entity's component onto every target entity in one storage insert.
+    virtual void CopyToEntities(const entt::registry& source, entt::entity sourceEntity, entt::registry& destination,
+                                std::span<const entt::entity> entities) const = 0;
+    // Copies every component of this type onto the same entities of another registry in one storage insert.
+    virtual void CopyStorage(const entt::registry& source, entt::registry& destination) const = 0;
+
+    // Binary codec. Types with a record codec are written as fixed-size in-memory records, one column at a time,
+    // and read back with a single storage insert; the others are stored through their JSON form.
+    virtual bool HasRecordCodec() const = 0;
+    virtual uint32_t GetRecordSize() const = 0;
+    virtual uint32_t GetRecordAlign() const = 0;
+    // Appends the record of every listed entity that has the component, and its index in the span to rows.
+    virtual void WriteRecords(const entt::registry& registry, std::span<const entt::entity> entities,
+                              std::vector<uint32_t>& rows, std::vector<uint8_t>& data) const = 0;
+    virtual void InsertRecords(entt::registry& registry, std::span<const entt::entity> entities,
+                               const uint8_t* data) const = 0;
 
 #ifdef BUILD_WITH_EDITOR
     using EntityPickerFunc = std::function<bool(const char*, entt::entity*)>;
@@ -39,14 +65,18 @@ public:
     virtual void DuplicateComponent(entt::registry& registry, entt::entity srcEntity, entt::entity dstEntity) = 0;
     virtual int GetDisplayOrder() const = 0;
     virtual bool IsRenderedByRegistry() const = 0;
+    virtual bool IsAddableFromMenu() const = 0;
 #endif
 };
 
 template <typename T>
 class ComponentModule : public IComponentModule {
 public:
-    using SerializeFunc = std::function<nlohmann::json(const T&)>;
-    using DeserializeFunc = std::function<void(T&, const nlohmann::json&)>;
+    using SerializeFunc = nlohmann::json (*)(const T&);
+    using DeserializeFunc = void (*)(T&, const nlohmann::json&);
+    // Fills a value-initialized record with the component as it is written to disk; runtime state keeps its default
+    // value and padding stays zero, so the same scene always produces the same bytes.
+    using PersistFunc = void (*)(const T& component, T& record);
 
 #ifdef BUILD_WITH_EDITOR
     using EntityPickerFunc = std::function<bool(const char*, entt::entity*)>;
@@ -58,22 +88,30 @@ public:
 #endif
 
     explicit ComponentModule(const char* name) :
-        m_Name{name}, m_TypeIndex{std::type_index(typeid(T))}
+        m_Name{name}, m_NameHash{entt::hashed_string::value(name, std::strlen(name))},
+        m_TypeIndex{std::type_index(typeid(T))}
 #ifdef BUILD_WITH_EDITOR
         ,
-        m_DisplayOrder{100}, m_RenderInRegistry{true}
+        m_DisplayOrder{100}, m_RenderInRegistry{true}, m_AddableFromMenu{true}
 #endif
     {
     }
 
     const char* GetName() const override { return m_Name; }
 
+    entt::id_type GetNameHash() const override { return m_NameHash; }
+
     std::type_index GetTypeIndex() const override { return m_TypeIndex; }
 
     void SetSerializer(SerializeFunc func) { m_Serializer = func; }
 
     void SetDeserializer(DeserializeFunc func) { m_Deserializer = func; }
 
+    void SetRecordCodec(PersistFunc func) {
+        static_assert(std::is_trivially_copyable_v<T>, "Record codecs need a trivially copyable component");
+        m_Persist = func;
+    }
+
 #ifdef BUILD_WITH_EDITOR
     void SetEditorUI(EditorUIFunc func) { m_EditorUI = func; }
 
@@ -88,9 +126,13 @@ public:
     void SetRenderInRegistry(bool render) { m_RenderInRegistry = render; }
 
     bool IsRenderedByRegistry() const override { return m_RenderInRegistry; }
+
+    void SetAddableFromMenu(bool addable) { m_AddableFromMenu = addable; }
+
+    bool IsAddableFromMenu() const override { return m_AddableFromMenu; }
 #endif
 
-    nlohmann::json Serialize(entt::registry& registry, entt::entity entity) const override {
+    nlohmann::json Serialize(const entt::registry& registry, entt::entity entity) const override {
         if (!registry.all_of<T>(entity)) {
             return nlohmann::json{};
         }
@@ -110,7 +152,16 @@ public:
         registry.emplace<T>(entity, component);
     }
 
-    bool HasComponent(entt::registry& registry, entt::entity entity) const override {
+    const nlohmann::json& GetDefaultJson() const override {
+        std::call_once(m_DefaultJsonOnce, [this]() {
+            if (m_Serializer) {
+                m_DefaultJson = m_Serializer(T{});
+            }
+        });
+        return m_DefaultJson;
+    }
+
+    bool HasComponent(const entt::registry& registry, entt::entity entity) const override {
         return registry.all_of<T>(entity);
     }
 
@@ -120,6 +171,64 @@ public:
         }
     }
 
+    void CopyToEntities(const entt::registry& source, entt::entity sourceEntity, entt::registry& destination,
+                        std::span<const entt::entity> entities) const override {
+        const T* component = source.try_get<T>(sourceEntity);
+        if (component) {
+            destination.insert<T>(entities.begin(), entities.end(), *component);
+        }
+    }
+
+    void CopyStorage(const entt::registry& source, entt::registry& destination) const override {
+        const entt::storage_for_t<T>* storage = source.storage<T>();
+        if (storage && !storage->empty()) {
+            const entt::sparse_set& entities = *storage;
+            destination.insert<T>(entities.begin(), entities.end(), storage->begin());
+        }
+    }
+
+    bool HasRecordCodec() const override { return m_Persist != nullptr; }
+
+    uint32_t GetRecordSize() const override { return sizeof(T); }
+
+    uint32_t GetRecordAlign() const override { return alignof(T); }
+
+    void WriteRecords(const entt::registry& registry, std::span<const entt::entity> entities,
+                      std::vector<uint32_t>& rows, std::vector<uint8_t>& data) const override {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (!m_Persist) {
+                return;
+            }
+
+            for (size_t row = 0; row < entities.size(); ++row) {
+                if (const T* component = registry.try_get<T>(entities[row])) {
+                    T record{};
+                    m_Persist(*component, record);
+                    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&record);
+                    rows.push_back(static_cast<uint32_t>(row));
+                    data.insert(data.end(), bytes, bytes + sizeof(T));
+                }
+            }
+        }
+    }
+
+    // Mapped files and package buffers are aligned, so the records are normally inserted straight from the
+    // source memory.
+    void InsertRecords(entt::registry& registry, std::span<const entt::entity> entities,
+                       const uint8_t* data) const override {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (reinterpret_cast<uintptr_t>(data) % alignof(T) == 0) {
+                const T* records = reinterpret_cast<const T*>(data);
+                registry.insert<T>(entities.begin(), entities.end(), records);
+                return;
+            }
+
+            std::vector<T> records(entities.size());
+            std::memcpy(static_cast<void*>(records.data()), data, entities.size() * sizeof(T));
+            registry.insert<T>(entities.begin(), entities.end(), records.begin());
+        }
+    }
+
 #ifdef BUILD_WITH_EDITOR
     void RenderInspectorUI(entt::registry& registry, entt::entity entity, EditorCommandSystem& commandSystem,
                            EntityPickerFunc entityPicker, AssetPickerFunc assetPicker) override {
@@ -172,10 +281,15 @@ public:
 
 private:
     const char* m_Name;
+    entt::id_type m_NameHash;
     std::type_index m_TypeIndex;
 
-    SerializeFunc m_Serializer;
-    DeserializeFunc m_Deserializer;
+    SerializeFunc m_Serializer{nullptr};
+    DeserializeFunc m_Deserializer{nullptr};
+    PersistFunc m_Persist{nullptr};
+
+    mutable std::once_flag m_DefaultJsonOnce;
+    mutable nlohmann::json m_DefaultJson;
 
 #ifdef BUILD_WITH_EDITOR
     EditorUIFunc m_EditorUI;
@@ -183,6 +297,7 @@ private:
     DuplicateFunc m_DuplicateFunc;
     int m_DisplayOrder;
     bool m_RenderInRegistry;
+    bool m_AddableFromMenu;
 #endif
 };
 
@@ -9,6 +9,29 @@
 #include "Reflection/ImGuiRenderer.hpp"
 #endif
 
+#include <cstring>
+
+namespace PiiXeL {
+
+// Record persist function for reflected components: copies the serializable fields only, so runtime state such
+// as physics handles is written as its default value.
+template <typename T>
+void PersistSerializableFields(const T& component, T& record) {
+    const Reflection::TypeInfo* typeInfo = Reflection::TypeRegistry::Instance().GetTypeInfo<T>();
+    if (!typeInfo) {
+        record = component;
+        return;
+    }
+
+    for (const Reflection::FieldInfo& field : typeInfo->GetFields()) {
+        if (field.flags & Reflection::FieldFlags::Serializable) {
+            std::memcpy(field.getPtr(&record), field.getConstPtr(&component), field.size);
+        }
+    }
+}
+
+} // namespace PiiXeL
+
 #define BEGIN_COMPONENT_MODULE(TypeName)                                                                               \
     namespace {                                                                                                        \
     struct TypeName##_ModuleRegistrar {                                                                                \
@@ -30,6 +53,8 @@
         ::PiiXeL::Reflection::JsonSerializer::Deserialize(data, component);                                            \
     });
 
+#define RECORD_SERIALIZATION() module->SetRecordCodec(&::PiiXeL::PersistSerializableFields<ReflectedType>);
+
 #ifdef BUILD_WITH_EDITOR
 
 #define EDITOR_UI()                                                                                                    \
@@ -54,6 +79,8 @@
 
 #define SKIP_REGISTRY_RENDER() module->SetRenderInRegistry(false);
 
+#define HIDE_FROM_ADD_MENU() module->SetAddableFromMenu(false);
+
 #else
 
 #define EDITOR_UI() if (false)
@@ -78,6 +105,8 @@
 
 #define SKIP_REGISTRY_RENDER()
 
+#define HIDE_FROM_ADD_MENU()
+
 #endif
 
 #define END_COMPONENT_MODULE(TypeName)                                                                                 \
@@ -4,12 +4,15 @@
 #include "Components/ComponentModule.hpp"
 
 #include <memory>
+#include <string_view>
 #include <typeindex>
 #include <unordered_map>
 #include <vector>
 
 namespace PiiXeL {
 
+// The single component codec table. Modules are found by the precomputed hash of their name in an
+// open-addressing table, so loaders hash each JSON key once and compare the name only on a hash hit.
 class ComponentModuleRegistry {
 public:
     static ComponentModuleRegistry& Instance() {
@@ -21,8 +24,8 @@ public:
     void RegisterModule(std::shared_ptr<ComponentModule<T>> module) {
         std::type_index typeIdx = std::type_index(typeid(T));
         m_ModulesByType[typeIdx] = module;
-        m_ModulesByName[module->GetName()] = module;
         m_AllModules.push_back(module);
+        RebuildHashTable();
     }
 
     template <typename T>
@@ -35,19 +38,45 @@ public:
         return nullptr;
     }
 
-    IComponentModule* GetModuleByName(const std::string& name) {
-        auto it = m_ModulesByName.find(name);
-        if (it != m_ModulesByName.end()) {
-            return it->second.get();
+    [[nodiscard]] static entt::id_type HashName(std::string_view name) {
+        return entt::hashed_string::value(name.data(), name.size());
+    }
+
+    // nameHash must be HashName(name); callers that already hashed the key for other checks pass it along. A hash
+    // hit is confirmed by comparing the name, and colliding names sit further along the same probe sequence.
+    [[nodiscard]] IComponentModule* GetModuleByName(std::string_view name, entt::id_type nameHash) const {
+        if (m_HashTable.empty()) {
+            return nullptr;
+        }
+
+        const size_t mask = m_HashTable.size() - 1;
+        for (size_t slot = nameHash & mask;; slot = (slot + 1) & mask) {
+            IComponentModule* module = m_HashTable[slot];
+            if (!module || (module->GetNameHash() == nameHash && name == module->GetName())) {
+                return module;
+            }
         }
-        return nullptr;
+    }
+
+    [[nodiscard]] IComponentModule* GetModuleByName(std::string_view name) const {
+        return GetModuleByName(name, HashName(name));
     }
 
     const std::vector<std::shared_ptr<IComponentModule>>& GetAllModules() const { return m_AllModules; }
 
     nlohmann::json SerializeEntity(entt::registry& registry, entt::entity entity);
-    void DeserializeComponent(const std::string& componentName, entt::registry& registry, entt::entity entity,
-                              const nlohmann::json& data);
+    // Deserializes every component of an entity JSON object. The "uuid", "base" and script keys belong to the
+    // caller and are skipped.
+    void DeserializeEntity(entt::registry& registry, entt::entity entity, const nlohmann::json& entityJson);
+
+    // Delta encoding. Each component is written as the top-level fields that differ from its base: the component
+    // of the same name in base (an entity-shaped object, normally a prefab's components) or else the type default.
+    // Components equal to their base component are left out, and base components the entity lacks are null.
+    nlohmann::json SerializeEntityDelta(const entt::registry& registry, entt::entity entity,
+                                        const nlohmann::json& base) const;
+    // Overlays every delta on its base and adds the base components the entity JSON leaves out.
+    void DeserializeEntityDelta(entt::registry& registry, entt::entity entity, const nlohmann::json& entityJson,
+                                const nlohmann::json& base);
 
 #ifdef BUILD_WITH_EDITOR
     using EntityPickerFunc = IComponentModule::EntityPickerFunc;
@@ -62,9 +91,12 @@ public:
 private:
     ComponentModuleRegistry() = default;
 
+    void RebuildHashTable();
+
     std::unordered_map<std::type_index, std::shared_ptr<IComponentModule>> m_ModulesByType;
-    std::unordered_map<std::string, std::shared_ptr<IComponentModule>> m_ModulesByName;
     std::vector<std::shared_ptr<IComponentModule>> m_AllModules;
+    // Power-of-two sized, at most half full.
+    std::vector<IComponentModule*> m_HashTable;
 };
 
 } // namespace PiiXeL
@@ -0,0 +1,16 @@
+#ifndef PIIXELENGINE_PREFABINSTANCE_HPP
+#define PIIXELENGINE_PREFABINSTANCE_HPP
+
+#include "Components/UUID.hpp"
+
+namespace PiiXeL {
+
+// Links an entity to the prefab asset it was instantiated from. Delta-encoded scenes write the entity's
+// components against the prefab's instead of the type defaults.
+struct PrefabInstance {
+    UUID prefab{0};
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_PREFABINSTANCE_HPP
@@ -1,6 +1,8 @@
 #ifndef PIIXELENGINE_SCRIPT_HPP
 #define PIIXELENGINE_SCRIPT_HPP
 
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <typeindex>
@@ -14,6 +16,8 @@ struct ScriptInstance {
     std::shared_ptr<ScriptComponent> instance;
     std::string scriptName;
     std::type_index typeIndex{typeid(void)};
+    // Profiler cost slot of typeIndex, resolved on the first profiled callback.
+    uint32_t profileSlot{std::numeric_limits<uint32_t>::max()};
 
     ScriptInstance() = default;
 
@@ -1,6 +1,8 @@
 #ifndef PIIXELENGINE_APPLICATION_HPP
 #define PIIXELENGINE_APPLICATION_HPP
 
+#include "Audio/AudioBackend.hpp"
+
 #include <memory>
 #include <string>
 
@@ -21,6 +23,7 @@ struct ApplicationConfig {
     bool resizable{true};
     bool fullscreen{false};
     std::string iconPath{};
+    AudioBackendType audioBackend{AudioBackendType::Device};
     GamePackageLoader* packageLoader{nullptr};
 };
 
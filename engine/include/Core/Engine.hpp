@@ -1,6 +1,11 @@
 #ifndef PIIXELENGINE_ENGINE_HPP
 #define PIIXELENGINE_ENGINE_HPP
 
+#include "Audio/AudioBackend.hpp"
+#include "Scene/SceneLoader.hpp"
+#include "Scene/WorldPartition.hpp"
+#include "Systems/SystemScheduler.hpp"
+
 #include <entt/entt.hpp>
 
 #include <memory>
@@ -40,16 +45,34 @@ public:
     void SetScriptsEnabled(bool enabled) { m_ScriptsEnabled = enabled; }
     void SetAnimationEnabled(bool enabled) { m_AnimationEnabled = enabled; }
     void SetAudioEnabled(bool enabled) { m_AudioEnabled = enabled; }
+    void SetAudioBackendType(AudioBackendType type) { m_AudioBackendType = type; }
     void CreatePhysicsBodies();
     void DestroyAllPhysicsBodies();
 
     bool LoadSceneFromFile(const std::string& filepath);
     bool LoadFromPackage(const std::string& packagePath, const std::string& sceneName);
 
+    // Loads a scene from the game package when it has one with that name, otherwise from a scene file.
+    // Progress is reported through the returned operation; a Single load replaces the active scene when done.
+    std::shared_ptr<SceneLoadOperation> LoadSceneAsync(const std::string& scene,
+                                                       SceneLoadMode mode = SceneLoadMode::Single);
+    // Destroys the entities of a finished additive load.
+    void UnloadSubScene(const SceneLoadOperation& operation);
+    [[nodiscard]] SceneLoader& GetSceneLoader() { return m_SceneLoader; }
+    // Open while a ".partition" world loaded through LoadSceneFromFile is active.
+    [[nodiscard]] WorldPartition& GetWorldPartition() { return m_WorldPartition; }
+    // Runs the per-frame systems; SetParallel(false) runs them one after another on the main thread.
+    [[nodiscard]] SystemScheduler& GetSystemScheduler() { return m_Scheduler; }
+
     void InvalidatePrimaryCameraCache() { m_PrimaryCameraCached = false; }
 
 private:
     entt::entity FindPrimaryCamera();
+    void PreloadSceneAudio();
+    void RegisterSystems();
+    void UpdateWorldPartition();
+    void UpdateSceneLoads();
+    void FlushEvents();
 
     entt::registry m_Registry;
     std::unique_ptr<Scene> m_ActiveScene;
@@ -58,10 +81,14 @@ private:
     std::unique_ptr<ScriptSystem> m_ScriptSystem;
     std::unique_ptr<AudioSystem> m_AudioSystem;
     std::unique_ptr<GamePackageLoader> m_PackageLoader;
+    SceneLoader m_SceneLoader;
+    WorldPartition m_WorldPartition;
+    SystemScheduler m_Scheduler;
     bool m_PhysicsEnabled{false};
     bool m_ScriptsEnabled{true};
     bool m_AnimationEnabled{false};
     bool m_AudioEnabled{false};
+    AudioBackendType m_AudioBackendType{AudioBackendType::Device};
 
     entt::entity m_PrimaryCamera{entt::null};
     bool m_PrimaryCameraCached{false};
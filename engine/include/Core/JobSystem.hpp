@@ -0,0 +1,121 @@
+#ifndef PIIXELENGINE_JOBSYSTEM_HPP
+#define PIIXELENGINE_JOBSYSTEM_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace PiiXeL {
+
+// Counts the unfinished jobs of a Schedule or ParallelForAsync call. Jobs scheduled with it as a dependency
+// start once it reaches zero.
+class JobCounter {
+public:
+    [[nodiscard]] bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+
+    explicit JobCounter(uint32_t pending) : m_Pending{pending}, m_Finished{pending == 0} {}
+
+    std::atomic<uint32_t> m_Pending;
+    std::mutex m_Mutex;
+    bool m_Finished;
+    // Called once the counter reaches zero; each releases one dependency of a waiting job.
+    std::vector<std::function<void()>> m_Continuations;
+};
+
+using JobHandle = std::shared_ptr<JobCounter>;
+
+// Engine-wide worker threads. Each worker owns a deque: it pushes and pops its own jobs at the back and steals
+// from the front of the other deques when it runs dry. Jobs that call raylib (GL, window, audio device) are
+// scheduled on the main thread, which runs them in RunMainThreadJobs() and while it waits for other jobs. A job that
+// throws is logged and counted as finished.
+class JobSystem {
+public:
+    using JobFunction = std::function<void()>;
+    using RangeFunction = std::function<void(size_t begin, size_t end)>;
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    static JobSystem& Instance();
+
+    // A worker count of 0 starts one worker per hardware thread besides the calling one, which becomes the main
+    // thread. Without workers, jobs run on the thread that schedules them or, with dependencies, on the thread
+    // that finishes the last one.
+    void Initialize(uint32_t workerCount);
+    // Jobs already queued run before the workers exit.
+    void Shutdown();
+
+    JobHandle Schedule(JobFunction job, std::span<const JobHandle> dependencies = {});
+    JobHandle ScheduleOnMainThread(JobFunction job, std::span<const JobHandle> dependencies = {});
+
+    // Splits [0, count) into batches of batchSize indices and runs task(begin, end) for each as a job.
+    JobHandle ParallelForAsync(size_t count, size_t batchSize, RangeFunction task,
+                               std::span<const JobHandle> dependencies = {});
+    // Calls task(index) for every index in [0, count) and returns once all of them have run. The calling thread
+    // takes part.
+    void ParallelFor(size_t count, const std::function<void(size_t)>& task);
+
+    // Runs queued jobs until the handle is done.
+    void Wait(const JobHandle& handle);
+    void RunMainThreadJobs();
+
+    [[nodiscard]] uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+    [[nodiscard]] bool IsMainThread() const { return std::this_thread::get_id() == m_MainThread; }
+    // 0 on the main thread and any thread outside the pool, 1 + the worker index on a worker.
+    [[nodiscard]] static uint32_t GetThreadIndex();
+
+private:
+    struct Job {
+        JobFunction function;
+        JobHandle counter;
+        bool mainThread{false};
+    };
+
+    struct DeferredJob {
+        Job job;
+        std::atomic<uint32_t> dependencies;
+    };
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    JobSystem() = default;
+    ~JobSystem();
+
+    void Enqueue(Job job, std::span<const JobHandle> dependencies);
+    void Submit(Job job);
+    bool TryRunJob(bool mainThread);
+    bool TryPopMainThreadJob(Job& job);
+    bool TryPopWorkerJob(Job& job);
+    void Execute(Job& job);
+    void Finish(const JobHandle& counter);
+    void WorkerLoop(uint32_t index);
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_Queues;
+    std::vector<std::thread> m_Workers;
+    std::mutex m_MainMutex;
+    std::deque<Job> m_MainJobs;
+    std::mutex m_SleepMutex;
+    std::condition_variable m_WakeCondition;
+    // Jobs sitting in worker deques; sleeping workers wake when it is non-zero.
+    std::atomic<size_t> m_QueuedJobs{0};
+    std::atomic<uint32_t> m_NextQueue{0};
+    std::thread::id m_MainThread{std::this_thread::get_id()};
+    bool m_Stopping{false};
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_JOBSYSTEM_HPP
@@ -0,0 +1,40 @@
+#ifndef PIIXELENGINE_MAPPEDFILE_HPP
+#define PIIXELENGINE_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace PiiXeL {
+
+// Read-only memory mapping of a whole file. The view starts on a page boundary, so data written at aligned
+// offsets inside the file can be read in place.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool Open(const std::string& filepath);
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const { return m_Data != nullptr; }
+    [[nodiscard]] const uint8_t* GetData() const { return m_Data; }
+    [[nodiscard]] size_t GetSize() const { return m_Size; }
+
+private:
+    const uint8_t* m_Data{nullptr};
+    size_t m_Size{0};
+#ifdef _WIN32
+    void* m_File{nullptr};
+    void* m_Mapping{nullptr};
+#endif
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_MAPPEDFILE_HPP
@@ -4,8 +4,13 @@
 #ifdef BUILD_WITH_EDITOR
 
 #include <chrono>
+#include <cstdint>
 #include <deque>
+#include <limits>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <typeindex>
 #include <unordered_map>
 #include <vector>
 
@@ -19,8 +24,24 @@ struct ProfileResult {
     int depth;
 };
 
+struct ScriptCostResult {
+    std::string name;
+    double duration;
+    size_t callCount;
+};
+
+// A system run recorded by the SystemScheduler; thread 0 is the main thread.
+struct TimelineEvent {
+    std::string name;
+    uint32_t thread;
+    double startTime;
+    double duration;
+};
+
 struct FrameSnapshot {
     std::vector<ProfileResult> results;
+    std::vector<ScriptCostResult> scriptCosts;
+    std::vector<TimelineEvent> timeline;
     double frameTime;
     double fps;
 };
@@ -32,10 +53,26 @@ public:
     void BeginFrame();
     void EndFrame();
 
+    // Safe to call from any thread. Scopes opened off the frame thread, such as inside systems the scheduler runs
+    // on workers, are summed across threads and nest by their depth on the thread that opened them.
     void BeginScope(const std::string& name);
     void EndScope(const std::string& name);
 
+    // Safe to call from any thread.
+    void AddTimelineEvent(const std::string& name, uint32_t thread,
+                          std::chrono::high_resolution_clock::time_point start,
+                          std::chrono::high_resolution_clock::time_point end);
+
+    static constexpr uint32_t InvalidScriptSlot{std::numeric_limits<uint32_t>::max()};
+
+    // Per-script-type costs go through integer slots so the hot path never builds or hashes a string. The cost
+    // table is not synchronized, so both calls are frame-thread only; OnParallelUpdate is not costed per type.
+    uint32_t GetScriptTypeSlot(std::type_index type, const std::string& name);
+    void AddScriptCost(uint32_t slot, double duration, size_t callCount);
+
     const std::vector<ProfileResult>& GetResults() const { return m_Results; }
+    const std::vector<ScriptCostResult>& GetScriptCosts() const { return m_ScriptCosts; }
+    const std::vector<TimelineEvent>& GetTimeline() const { return m_Timeline; }
     double GetFrameTime() const { return m_FrameTime; }
     double GetFPS() const { return m_FPS; }
 
@@ -50,6 +87,7 @@ public:
 
     std::string GetCurrentFrameAsText() const;
     void CopyFrameToClipboard() const;
+    static std::string FormatFrame(const FrameSnapshot& snapshot);
 
 private:
     Profiler() = default;
@@ -65,7 +103,16 @@ private:
     bool m_Enabled{false};
     bool m_Recording{false};
     std::unordered_map<std::string, ScopeData> m_Scopes;
+    std::mutex m_WorkerScopeMutex;
+    std::unordered_map<std::string, ScopeData> m_WorkerScopes;
     std::vector<ProfileResult> m_Results;
+    std::unordered_map<std::type_index, uint32_t> m_ScriptTypeSlots;
+    std::vector<ScriptCostResult> m_ScriptTypeCosts;
+    std::vector<ScriptCostResult> m_ScriptCosts;
+    std::mutex m_TimelineMutex;
+    std::vector<TimelineEvent> m_PendingTimeline;
+    std::vector<TimelineEvent> m_Timeline;
+    std::thread::id m_FrameThread;
     std::chrono::high_resolution_clock::time_point m_FrameStart;
     double m_FrameTime{0.0};
     double m_FPS{0.0};
@@ -92,11 +139,58 @@ private:
     std::string m_Name;
 };
 
+class ScriptCostScope {
+public:
+    ScriptCostScope(std::type_index type, const std::string& name, size_t callCount) {
+        Profiler& profiler = Profiler::Instance();
+        if (profiler.IsEnabled()) {
+            Start(profiler.GetScriptTypeSlot(type, name), callCount);
+        }
+    }
+
+    // Resolves the slot once and keeps it in cachedSlot, so later calls skip the type lookup.
+    ScriptCostScope(uint32_t& cachedSlot, std::type_index type, const std::string& name, size_t callCount) {
+        Profiler& profiler = Profiler::Instance();
+        if (profiler.IsEnabled()) {
+            if (cachedSlot == Profiler::InvalidScriptSlot) {
+                cachedSlot = profiler.GetScriptTypeSlot(type, name);
+            }
+            Start(cachedSlot, callCount);
+        }
+    }
+
+    ~ScriptCostScope() {
+        if (m_Active) {
+            std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - m_StartTime;
+            Profiler::Instance().AddScriptCost(m_Slot, duration.count(), m_CallCount);
+        }
+    }
+
+private:
+    void Start(uint32_t slot, size_t callCount) {
+        m_Slot = slot;
+        m_CallCount = callCount;
+        m_StartTime = std::chrono::high_resolution_clock::now();
+        m_Active = true;
+    }
+
+    std::chrono::high_resolution_clock::time_point m_StartTime;
+    uint32_t m_Slot{0};
+    size_t m_CallCount{0};
+    bool m_Active{false};
+};
+
 #define PROFILE_SCOPE_CONCAT(a, b) a##b
 #define PROFILE_SCOPE_EXPAND(name, line) PROFILE_SCOPE_CONCAT(profileScope, line)
 #define PROFILE_SCOPE_IMPL(name, line) PiiXeL::ProfileScope PROFILE_SCOPE_EXPAND(name, line)(name)
 #define PROFILE_SCOPE(name) PROFILE_SCOPE_IMPL(name, __LINE__)
 #define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+#define PROFILE_SCRIPT_IMPL(type, name, calls, line)                                                                   \
+    PiiXeL::ScriptCostScope PROFILE_SCOPE_CONCAT(scriptCostScope, line)(type, name, calls)
+#define PROFILE_SCRIPT(type, name, calls) PROFILE_SCRIPT_IMPL(type, name, calls, __LINE__)
+#define PROFILE_SCRIPT_SLOT_IMPL(slot, type, name, calls, line)                                                        \
+    PiiXeL::ScriptCostScope PROFILE_SCOPE_CONCAT(scriptCostScope, line)(slot, type, name, calls)
+#define PROFILE_SCRIPT_SLOT(slot, type, name, calls) PROFILE_SCRIPT_SLOT_IMPL(slot, type, name, calls, __LINE__)
 
 } // namespace PiiXeL
 
@@ -104,6 +198,8 @@ private:
 
 #define PROFILE_SCOPE(name) ((void)0)
 #define PROFILE_FUNCTION() ((void)0)
+#define PROFILE_SCRIPT(type, name, calls) ((void)0)
+#define PROFILE_SCRIPT_SLOT(slot, type, name, calls) ((void)0)
 
 #endif
 
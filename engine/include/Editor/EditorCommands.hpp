@@ -77,7 +77,7 @@ public:
 
     void Undo() override {
         if (m_Scene && m_Entity != entt::null) {
-            m_Scene->DestroyEntity(m_Entity);
+            m_Scene->DestroyEntityImmediate(m_Entity);
             m_Entity = entt::null;
         }
     }
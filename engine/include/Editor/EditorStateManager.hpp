@@ -2,7 +2,7 @@
 
 #ifdef BUILD_WITH_EDITOR
 
-#include <string>
+#include "Scene/SceneSnapshot.hpp"
 
 namespace PiiXeL {
 
@@ -29,7 +29,7 @@ public:
 
 private:
     EditorState m_EditorState{EditorState::Edit};
-    std::string m_PlayModeSnapshot{};
+    SceneSnapshot m_PlayModeSnapshot;
 };
 
 } // namespace PiiXeL
@@ -25,6 +25,23 @@ struct PhysicsSettings {
     int positionIterations{3};
 };
 
+struct AudioSettings {
+    int maxVoices{32};
+};
+
+struct SceneSettings {
+    bool deltaEncoding{false};
+    bool worldPartition{false};
+    float cellSize{2048.0f};
+    int loadRadius{1};
+    int unloadRadius{2};
+};
+
+struct JobSettings {
+    // 0 starts one worker per hardware thread besides the main thread.
+    int workerCount{0};
+};
+
 struct ProjectSettings {
     std::string projectName{"My Game"};
     std::string startScene{"Default_Scene"};
@@ -33,14 +50,20 @@ struct ProjectSettings {
 
     WindowSettings window;
     PhysicsSettings physics;
+    AudioSettings audio;
+    SceneSettings scenes;
+    JobSettings jobs;
     nlohmann::json buildConfig;
 
     static ProjectSettings& Instance();
 
     bool Load(const std::string& filepath = "game.config.json");
+    // Reads the settings present in a project config document; missing keys keep their current values.
+    void LoadFromJson(const nlohmann::json& json);
     bool Save(const std::string& filepath = "game.config.json");
 
     void ApplyToPhysics(class PhysicsSystem* physicsSystem);
+    void ApplyToAudio(class AudioSystem* audioSystem);
 
 private:
     ProjectSettings() = default;
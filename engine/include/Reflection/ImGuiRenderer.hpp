@@ -20,7 +20,7 @@ class ImGuiRenderer {
 public:
     template <typename T>
     static bool RenderProperties(T& object, EntityPickerCallback entityPicker = nullptr,
-                                 AssetPickerCallback assetPicker = nullptr) {
+                                 AssetPickerCallback assetPicker = nullptr, const entt::registry* registry = nullptr) {
         const TypeInfo* typeInfo = TypeRegistry::Instance().GetTypeInfo<T>();
         if (!typeInfo) {
             return false;
@@ -33,7 +33,7 @@ public:
             }
 
             void* fieldPtr = field.getPtr(static_cast<void*>(&object));
-            if (RenderField(field, fieldPtr, entityPicker, assetPicker)) {
+            if (RenderField(field, fieldPtr, entityPicker, assetPicker, registry)) {
                 modified = true;
             }
         }
@@ -41,8 +41,10 @@ public:
         return modified;
     }
 
+    // EntityRef fields resolve against the registry of the edited object's scene and show only their UUID without
+    // one.
     static bool RenderField(const FieldInfo& field, void* fieldPtr, EntityPickerCallback entityPicker,
-                            AssetPickerCallback assetPicker);
+                            AssetPickerCallback assetPicker, const entt::registry* registry = nullptr);
 };
 
 } // namespace PiiXeL::Reflection
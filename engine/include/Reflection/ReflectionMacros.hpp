@@ -8,6 +8,8 @@
 
 #include <raylib.h>
 
+#include <cstddef>
+
 namespace PiiXeL {
 class EntityRef;
 class UUID;
@@ -41,6 +43,15 @@ struct TypeDeducer {
     }
 };
 
+// Byte offset of a data member, taken from the member pointer against uninitialized storage so no object of the
+// reflected type has to be constructed.
+template <typename ClassType, typename FieldType>
+inline size_t FieldOffset(FieldType ClassType::*memberPtr) {
+    alignas(ClassType) std::byte storage[sizeof(ClassType)];
+    const ClassType* object = reinterpret_cast<const ClassType*>(storage);
+    return static_cast<size_t>(reinterpret_cast<const std::byte*>(&(object->*memberPtr)) - storage);
+}
+
 template <typename ClassType, typename FieldType>
 inline FieldInfo MakeFieldInfo(const std::string& name, FieldType ClassType::*memberPtr, uint32_t flags,
                                FieldMetadata metadata = {}) {
@@ -48,7 +59,7 @@ inline FieldInfo MakeFieldInfo(const std::string& name, FieldType ClassType::*me
     info.name = name;
     info.type = TypeDeducer<FieldType>::GetFieldType();
     info.flags = flags;
-    info.offset = 0;
+    info.offset = FieldOffset(memberPtr);
     info.size = sizeof(FieldType);
     info.metadata = metadata;
     info.typeIndex = std::type_index(typeid(FieldType));
@@ -32,6 +32,8 @@ struct AssetMetadata {
     uint64_t importTimestamp{0};
     uint64_t sourceTimestamp{0};
     uint32_t version{1};
+    // Type-specific import option stored in the package; audio keeps its AudioLoadType here.
+    uint32_t importSettings{0};
 
     bool NeedsReimport(uint64_t currentSourceTimestamp) const { return currentSourceTimestamp > sourceTimestamp; }
 };
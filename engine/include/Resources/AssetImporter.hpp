@@ -34,11 +34,13 @@ public:
     void ForceUUID(const std::string& sourcePath, UUID uuid);
 
 private:
+    ImportResult ImportSource(const std::string& sourcePath, AssetType type, UUID uuid);
     ImportResult ImportTexture(const std::string& sourcePath, UUID uuid);
     ImportResult ImportAudio(const std::string& sourcePath, UUID uuid);
     ImportResult ImportSpriteSheet(const std::string& sourcePath, UUID uuid);
     ImportResult ImportAnimationClip(const std::string& sourcePath, UUID uuid);
     ImportResult ImportAnimatorController(const std::string& sourcePath, UUID uuid);
+    ImportResult ImportPrefab(const std::string& sourcePath, UUID uuid);
 
     UUID GetOrCreateUUID(const std::string& sourcePath);
     std::chrono::system_clock::time_point GetFileLastWriteTime(const std::string& path);
@@ -5,6 +5,7 @@
 #include "Resources/AssetImporter.hpp"
 #include "Resources/AssetPackage.hpp"
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -13,6 +14,12 @@
 
 namespace PiiXeL {
 
+struct AssetSource {
+    std::string sourcePath{};
+    std::string packagePath{};
+    std::vector<uint8_t> packageData{};
+};
+
 class AssetRegistry {
 public:
     AssetRegistry();
@@ -28,16 +35,27 @@ public:
     std::shared_ptr<Asset> LoadAssetFromPath(const std::string& path);
     std::shared_ptr<Asset> GetAsset(UUID uuid);
 
+    bool GetAssetSource(UUID uuid, AssetSource& outSource) const;
+    // Finishes a load whose package was already read and unpacked, usually on a worker thread. Main thread only.
+    std::shared_ptr<Asset> LoadAssetFromData(AssetMetadata metadata, const std::vector<uint8_t>& data);
+    bool AddLoadedAsset(const std::shared_ptr<Asset>& asset);
+
     void UnloadAsset(UUID uuid);
     void UnloadAll();
 
     void ImportDirectory(const std::string& directory);
     void ReimportAsset(const std::string& sourcePath);
+    // Rewrites the import option stored in the asset's package and reloads the asset if it was loaded.
+    bool SetImportSettings(UUID uuid, uint32_t importSettings);
     void RegisterExtractedAssets();
 
     using ProgressCallback = std::function<void(size_t current, size_t total, const std::string& path)>;
     void ScanAllPxaFiles(const std::string& rootPath, ProgressCallback callback = nullptr);
 
+    using UnloadListener = std::function<void(UUID uuid)>;
+    uint32_t AddUnloadListener(UnloadListener listener);
+    void RemoveUnloadListener(uint32_t listenerId);
+
     void LoadUUIDCacheFromMemory(const uint8_t* data, size_t dataSize);
     void RegisterAssetFromMemory(UUID uuid, const std::string& sourcePath, const std::vector<uint8_t>& packageData);
 
@@ -50,18 +68,31 @@ public:
     [[nodiscard]] const std::unordered_map<UUID, std::string>& GetAllKnownAssetPaths() const;
     [[nodiscard]] size_t GetTotalMemoryUsage() const;
 
+    // Every UUID that has been asked for gets a slot whose generation changes when that asset is loaded, unloaded or
+    // reimported. Caches keep the slot index and compare generations instead of looking the UUID up again.
+    uint32_t AcquireSlot(UUID uuid);
+    [[nodiscard]] uint32_t GetSlotGeneration(uint32_t slot) const {
+        return slot < m_SlotGenerations.size() ? m_SlotGenerations[slot] : 0;
+    }
+
     static AssetRegistry& Instance();
 
 private:
     std::shared_ptr<Asset> CreateAsset(AssetType type, UUID uuid, const std::string& name);
     std::shared_ptr<Asset> LoadAssetFromPackage(const std::string& packagePath, const std::string& sourcePath);
+    void NotifyUnload(UUID uuid);
+    void BumpSlot(UUID uuid);
 
     std::unordered_map<UUID, std::shared_ptr<Asset>> m_Assets;
     std::unordered_map<UUID, std::string> m_UUIDToPath;
     std::unordered_map<std::string, UUID> m_PathToUUID;
     std::unordered_map<UUID, std::vector<uint8_t>> m_PackageDataCache;
+    std::unordered_map<uint32_t, UnloadListener> m_UnloadListeners;
+    uint32_t m_NextListenerId{1};
 
     AssetImporter m_Importer;
+    std::unordered_map<UUID, uint32_t> m_Slots;
+    std::vector<uint32_t> m_SlotGenerations;
     bool m_IsInitialized{false};
 };
 
@@ -3,6 +3,8 @@
 
 #include "Resources/Asset.hpp"
 
+#include <cstdint>
+#include <mutex>
 #include <raylib.h>
 #include <vector>
 
@@ -10,7 +12,9 @@ namespace PiiXeL {
 
 enum class AudioFormat { Unknown = 0, WAV = 1, OGG = 2, MP3 = 3, FLAC = 4 };
 
-enum class AudioLoadType { DecompressOnLoad, CompressedInMemory, Streaming };
+// Per-asset import setting. Auto streams clips whose encoded size reaches StreamingThreshold; CompressedInMemory is
+// decoded like DecompressOnLoad until a compressed in-memory path exists.
+enum class AudioLoadType : uint8_t { Auto = 0, DecompressOnLoad = 1, CompressedInMemory = 2, Streaming = 3 };
 
 class AudioAsset : public Asset {
 public:
@@ -19,28 +23,69 @@ public:
     ~AudioAsset() override;
 
     bool Load(const void* data, size_t size) override;
+
+    // Two-phase load: Decode() touches no audio device state and may run on a worker thread,
+    // FinishLoad() creates the playable sound or stream and must run on the main thread.
+    bool Decode(const void* data, size_t size, uint32_t pcmSampleRate);
+    bool FinishLoad();
     void Unload() override;
     [[nodiscard]] size_t GetMemoryUsage() const override;
 
     [[nodiscard]] Sound GetSound() const { return m_Sound; }
-    [[nodiscard]] uint32_t GetFrameCount() const { return m_Sound.frameCount; }
+    [[nodiscard]] uint32_t GetFrameCount() const { return m_FrameCount; }
     [[nodiscard]] float GetLength() const;
     [[nodiscard]] uint32_t GetSampleRate() const;
     [[nodiscard]] uint32_t GetChannels() const;
     [[nodiscard]] AudioFormat GetFormat() const { return m_Format; }
-    [[nodiscard]] AudioLoadType GetLoadType() const { return m_LoadType; }
+    // The load type set on the asset, or else the one stored in its package metadata.
+    [[nodiscard]] AudioLoadType GetLoadType() const;
+    [[nodiscard]] bool IsStreaming() const { return m_IsStreaming; }
+    [[nodiscard]] const std::vector<float>& GetPcm() const { return m_Pcm; }
 
     void SetFormat(AudioFormat format) { m_Format = format; }
     void SetLoadType(AudioLoadType loadType) { m_LoadType = loadType; }
 
+    void PlayStream(bool loop);
+    void PauseStream();
+    void ResumeStream();
+    void StopStream();
+    void SetStreamVolume(float volume);
+    void SetStreamPitch(float pitch);
+    void SetStreamPan(float pan);
+    [[nodiscard]] bool IsStreamPlaying() const;
+    [[nodiscard]] bool IsStreamPaused() const { return m_IsStreamPaused; }
+    void RefillStream();
+
+    static constexpr size_t StreamingThreshold{1024 * 1024};
+
+    static void SetPcmSampleRate(uint32_t sampleRate) { s_PcmSampleRate = sampleRate; }
+    [[nodiscard]] static uint32_t GetPcmSampleRate() { return s_PcmSampleRate; }
+
     static std::vector<uint8_t> EncodeToMemory(const std::string& sourcePath);
     static AudioFormat DetectAudioFormat(const std::string& extension);
 
 private:
+    bool LoadStream(const char* fileExt);
+    bool DecodePcm(const char* fileExt, const void* data, size_t size, uint32_t pcmSampleRate);
+    void DiscardDecoded();
+
+    static const char* GetDecoderExtension(AudioFormat format);
+
     Sound m_Sound{};
-    Wave m_Wave{};
+    Music m_Music{};
+    Wave m_DecodedWave{};
+    std::vector<float> m_Pcm;
+    std::vector<uint8_t> m_EncodedData;
+    mutable std::mutex m_StreamMutex;
+    uint32_t m_FrameCount{0};
+    uint32_t m_SampleRate{0};
+    uint32_t m_Channels{0};
     AudioFormat m_Format{AudioFormat::Unknown};
-    AudioLoadType m_LoadType{AudioLoadType::DecompressOnLoad};
+    AudioLoadType m_LoadType{AudioLoadType::Auto};
+    bool m_IsStreaming{false};
+    bool m_IsStreamPaused{false};
+
+    static uint32_t s_PcmSampleRate;
 };
 
 } // namespace PiiXeL
@@ -0,0 +1,71 @@
+#ifndef PIIXELENGINE_PREFABASSET_HPP
+#define PIIXELENGINE_PREFABASSET_HPP
+
+#include "Resources/Asset.hpp"
+
+#include <entt/entt.hpp>
+#include <nlohmann/json.hpp>
+
+#include <any>
+#include <raylib.h>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace PiiXeL {
+
+class IComponentModule;
+class Scene;
+
+namespace Reflection {
+struct FieldInfo;
+}
+
+// Entity template imported from a .prefab file, which holds one entity in the scene file layout. The JSON is
+// parsed once on load: components are kept in a private registry and script properties are resolved to typed
+// values, so instantiating copies each component type into the scene with one storage insert per batch.
+class PrefabAsset : public Asset {
+public:
+    PrefabAsset(UUID uuid, const std::string& name);
+    ~PrefabAsset() override = default;
+
+    bool Load(const void* data, size_t size) override;
+    void Unload() override;
+    [[nodiscard]] size_t GetMemoryUsage() const override;
+
+    // Creates count instances with fresh UUIDs, appended to the scene's entity order in creation order. Each one
+    // gets a PrefabInstance that links it back to this asset.
+    std::vector<entt::entity> Instantiate(Scene& scene, size_t count) const;
+    // One instance per position, overriding the template Transform's position.
+    std::vector<entt::entity> Instantiate(Scene& scene, std::span<const Vector2> positions) const;
+
+    [[nodiscard]] size_t GetComponentCount() const { return m_Modules.size(); }
+    [[nodiscard]] size_t GetScriptCount() const { return m_Scripts.size(); }
+    // The template's components as an entity-shaped object in their serialized form; the base that delta-encoded
+    // scenes write instances against.
+    [[nodiscard]] const nlohmann::json& GetComponentsJson() const { return m_ComponentsJson; }
+
+private:
+    struct PropertyValue {
+        const Reflection::FieldInfo* field;
+        std::any value;
+    };
+
+    struct ScriptTemplate {
+        std::string scriptName;
+        bool enabled{true};
+        std::vector<PropertyValue> properties;
+    };
+
+    void InstantiateScripts(Scene& scene, std::span<const entt::entity> entities) const;
+
+    entt::registry m_Template;
+    entt::entity m_Root{entt::null};
+    std::vector<const IComponentModule*> m_Modules;
+    nlohmann::json m_ComponentsJson = nlohmann::json::object();
+    std::vector<ScriptTemplate> m_Scripts;
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_PREFABASSET_HPP
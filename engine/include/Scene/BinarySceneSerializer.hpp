@@ -0,0 +1,60 @@
+#ifndef PIIXELENGINE_BINARYSCENESERIALIZER_HPP
+#define PIIXELENGINE_BINARYSCENESERIALIZER_HPP
+
+#include <entt/entt.hpp>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PiiXeL {
+
+class Scene;
+
+// Runtime scene format built from the JSON scenes, which stay the editable source. After a header holding the
+// scene name, the UUID of every entity in hierarchy order and the preload manifest, each component type is one
+// column block: a schema header, the row -> entity table and the packed component data. Plain data components
+// are stored as in-memory records, so loading maps the file and bulk-copies each column into its EnTT storage;
+// a column whose schema no longer matches the running build rejects the file. Strings, scripts and components
+// without a fixed layout are stored as per-row blobs.
+class BinarySceneSerializer {
+public:
+    static constexpr uint32_t Magic{0x43535850}; // "PXSC"
+    static constexpr uint32_t Version{1};
+    static constexpr const char* FileExtension{".pxscene"};
+
+    explicit BinarySceneSerializer(Scene* scene);
+
+    bool Serialize(const std::string& filepath);
+    // Maps the file and replaces the scene's contents with it.
+    bool Deserialize(const std::string& filepath);
+
+    [[nodiscard]] std::vector<uint8_t> SerializeToMemory();
+    // Only the listed entities, in that order; used to write world partition cells.
+    [[nodiscard]] std::vector<uint8_t> SerializeToMemory(std::span<const entt::entity> entities);
+    bool DeserializeFromMemory(const uint8_t* data, size_t size);
+    // Adds the file's entities to the scene instead of replacing its contents; the scene name and preload
+    // manifest are left alone. The new entities are appended to entities.
+    bool AppendFromMemory(const uint8_t* data, size_t size, std::vector<entt::entity>& entities);
+
+    // Converts a JSON scene into the binary format. Script properties are taken from the JSON as-is, so
+    // scripts that are not registered in this build keep their data.
+    static bool ConvertJsonToBinary(const nlohmann::json& sceneJson, std::vector<uint8_t>& output);
+    static bool ConvertJsonToBinary(const std::string& jsonPath, const std::string& binaryPath);
+
+    [[nodiscard]] static bool IsBinaryScene(const uint8_t* data, size_t size);
+
+private:
+    bool Read(const uint8_t* data, size_t size, std::vector<entt::entity>* appended);
+
+    Scene* m_Scene;
+    // "Scripts" arrays written instead of the live script instances, used by the converter.
+    std::unordered_map<entt::entity, nlohmann::json> m_ScriptOverrides;
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_BINARYSCENESERIALIZER_HPP
@@ -0,0 +1,75 @@
+#ifndef PIIXELENGINE_ENTITYINDEX_HPP
+#define PIIXELENGINE_ENTITYINDEX_HPP
+
+#include "Components/UUID.hpp"
+
+#include <entt/entt.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace PiiXeL {
+
+// UUID -> entity lookup for one scene, stored in an open-addressing table with linear probing. The reverse
+// direction reads the UUID component the entity already carries. The index registers itself in its registry's
+// context, so code holding only a registry can still reach it.
+class EntityIndex {
+public:
+    explicit EntityIndex(entt::registry& registry);
+    ~EntityIndex();
+
+    EntityIndex(const EntityIndex&) = delete;
+    EntityIndex& operator=(const EntityIndex&) = delete;
+
+    // Index owned by the scene of this registry, or nullptr for a registry without a scene.
+    [[nodiscard]] static const EntityIndex* Find(const entt::registry& registry);
+    // Registers the index in its registry's context again; needed after the registry was swapped with another.
+    void BindContext();
+    // Exchanges the entries with another index after their registries were swapped, and rebinds both contexts.
+    void Swap(EntityIndex& other);
+
+    void Register(UUID uuid, entt::entity entity);
+    // Sizes the table once up front; used by scene loads.
+    void RegisterEntities(const std::vector<std::pair<UUID, entt::entity>>& entries);
+    void Unregister(UUID uuid);
+    void UnregisterEntities(const std::vector<UUID>& uuids);
+    void Reserve(size_t count);
+    void Clear();
+
+    [[nodiscard]] entt::entity GetEntity(UUID uuid) const;
+    [[nodiscard]] UUID GetUUID(entt::entity entity) const;
+    [[nodiscard]] bool HasEntity(UUID uuid) const { return GetEntity(uuid) != entt::null; }
+    [[nodiscard]] size_t GetCount() const { return m_Count; }
+
+    // Unique across all indices; changes whenever this index changes, so EntityRef can cache lookups.
+    [[nodiscard]] uint64_t GetGeneration() const { return m_Generation; }
+
+private:
+    struct Slot {
+        uint64_t key{0};
+        entt::entity entity{entt::null};
+    };
+
+    [[nodiscard]] size_t FindSlot(uint64_t key) const;
+    void Insert(uint64_t key, entt::entity entity);
+    void Erase(uint64_t key);
+    void Rehash(size_t capacity);
+    void Touch() { m_Generation = NextGeneration(); }
+    [[nodiscard]] static uint64_t NextGeneration() {
+        return s_GenerationCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    entt::registry& m_Registry;
+    std::vector<Slot> m_Slots;
+    size_t m_Count{0};
+    uint64_t m_Generation{NextGeneration()};
+
+    // Scenes are built on loader threads too, so indices may draw generations concurrently.
+    static std::atomic<uint64_t> s_GenerationCounter;
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_ENTITYINDEX_HPP
@@ -0,0 +1,47 @@
+#ifndef PIIXELENGINE_ENTITYORDER_HPP
+#define PIIXELENGINE_ENTITYORDER_HPP
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace PiiXeL {
+
+// Hierarchy order of a scene's entities. Removal leaves a tombstone found through a position table indexed
+// by entity id, and Compact() squeezes all tombstones out in one pass, so removing k entities costs O(n + k)
+// instead of O(n * k). Scene compacts before handing the order out, so readers never see tombstones.
+class EntityOrder {
+public:
+    using const_iterator = std::vector<entt::entity>::const_iterator;
+
+    void Add(entt::entity entity);
+    // Returns false when the entity is not part of the order.
+    bool Remove(entt::entity entity);
+    void Compact();
+    void Move(size_t from, size_t to);
+    void Clear();
+
+    [[nodiscard]] bool Contains(entt::entity entity) const;
+
+    [[nodiscard]] size_t size() const { return m_Entities.size(); }
+    [[nodiscard]] bool empty() const { return m_Entities.empty(); }
+    [[nodiscard]] entt::entity operator[](size_t index) const { return m_Entities[index]; }
+    [[nodiscard]] const_iterator begin() const { return m_Entities.begin(); }
+    [[nodiscard]] const_iterator end() const { return m_Entities.end(); }
+
+    [[nodiscard]] const std::vector<entt::entity>& GetEntities() const { return m_Entities; }
+
+private:
+    static constexpr uint32_t InvalidPosition{UINT32_MAX};
+
+    void SetPosition(entt::entity entity, uint32_t position);
+
+    std::vector<entt::entity> m_Entities;
+    std::vector<uint32_t> m_Positions;
+    size_t m_TombstoneCount{0};
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_ENTITYORDER_HPP
@@ -1,6 +1,10 @@
 #ifndef PIIXELENGINE_SCENE_HPP
 #define PIIXELENGINE_SCENE_HPP
 
+#include "Components/UUID.hpp"
+#include "Scene/EntityIndex.hpp"
+#include "Scene/EntityOrder.hpp"
+
 #include <entt/entt.hpp>
 
 #include <string>
@@ -17,14 +21,36 @@ public:
     void OnRender();
 
     [[nodiscard]] entt::entity CreateEntity(const std::string& name = "Entity");
+    // Queued; the entity stays alive until the next FlushDestroyedEntities(), which the engine calls once
+    // per frame. Safe to call from collision callbacks and while iterating views.
     void DestroyEntity(entt::entity entity);
+    // Leaves a hole in the entity order; holes are squeezed out together on the next flush or order access, so
+    // destroying many entities this way stays linear.
+    void DestroyEntityImmediate(entt::entity entity);
+    void FlushDestroyedEntities();
+    [[nodiscard]] bool HasPendingDestroys() const { return !m_PendingDestroy.empty(); }
 
     [[nodiscard]] const std::string& GetName() const { return m_Name; }
     void SetName(const std::string& name) { m_Name = name; }
 
     [[nodiscard]] entt::registry& GetRegistry() { return m_Registry; }
-    [[nodiscard]] const std::vector<entt::entity>& GetEntityOrder() const { return m_EntityOrder; }
-    [[nodiscard]] std::vector<entt::entity>& GetEntityOrder() { return m_EntityOrder; }
+    [[nodiscard]] EntityIndex& GetEntityIndex() { return m_EntityIndex; }
+    [[nodiscard]] const EntityIndex& GetEntityIndex() const { return m_EntityIndex; }
+    [[nodiscard]] const EntityOrder& GetEntityOrder() const {
+        m_EntityOrder.Compact();
+        return m_EntityOrder;
+    }
+    [[nodiscard]] EntityOrder& GetEntityOrder() {
+        m_EntityOrder.Compact();
+        return m_EntityOrder;
+    }
+
+    [[nodiscard]] const std::vector<UUID>& GetPreloadAssets() const { return m_PreloadAssets; }
+    void SetPreloadAssets(const std::vector<UUID>& assets) { m_PreloadAssets = assets; }
+
+    // Exchanges entities, name and preload manifest with another scene; loaders build into a staging scene and
+    // swap it in once it is complete. Both registries keep their own index bound in their context.
+    void Swap(Scene& other);
 
 private:
     void CreateDemoEntities();
@@ -32,7 +58,11 @@ private:
 private:
     std::string m_Name;
     entt::registry m_Registry;
-    std::vector<entt::entity> m_EntityOrder;
+    EntityIndex m_EntityIndex;
+    // Mutable so const readers can squeeze out the holes left by DestroyEntityImmediate.
+    mutable EntityOrder m_EntityOrder;
+    std::vector<entt::entity> m_PendingDestroy;
+    std::vector<UUID> m_PreloadAssets;
 };
 
 } // namespace PiiXeL
@@ -0,0 +1,85 @@
+#ifndef PIIXELENGINE_SCENEJSONSTREAM_HPP
+#define PIIXELENGINE_SCENEJSONSTREAM_HPP
+
+#include <nlohmann/json.hpp>
+
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace PiiXeL {
+
+// Writes a scene document one entity at a time. The output is byte-identical to dumping the whole scene DOM
+// with the same indent: members in key order ("delta" for delta-encoded scenes, "entities", "preload", "scene"),
+// indent -1 for compact output.
+class SceneJsonWriter {
+public:
+    SceneJsonWriter(std::ostream& stream, int indent, bool deltaEncoded);
+
+    void WriteEntity(const nlohmann::json& entityJson);
+    void Finish(const nlohmann::json& preload, const std::string& sceneName);
+
+private:
+    void WriteIndented(const std::string& text, int level);
+    void NewLine(int level);
+
+    std::ostream& m_Stream;
+    int m_Indent;
+    size_t m_EntityCount{0};
+};
+
+// SAX reader for scene documents. Each element of "entities" is handed to the callback as soon as its closing
+// brace is read and released afterwards, so only one entity is materialized at a time. Every other top-level
+// member is collected into GetHeader(); the callback also gets the members read so far.
+class SceneJsonReader final : public nlohmann::json_sax<nlohmann::json> {
+public:
+    using EntityCallback = std::function<void(const nlohmann::json& entityJson, const nlohmann::json& header)>;
+
+    explicit SceneJsonReader(EntityCallback onEntity);
+
+    // Returns false on malformed input; GetError() describes it. Entities before the error have been delivered.
+    bool Parse(std::istream& stream);
+    bool Parse(const std::string& text);
+
+    [[nodiscard]] const nlohmann::json& GetHeader() const { return m_Header; }
+    [[nodiscard]] const std::string& GetError() const { return m_Error; }
+
+    bool null() override;
+    bool boolean(bool val) override;
+    bool number_integer(number_integer_t val) override;
+    bool number_unsigned(number_unsigned_t val) override;
+    bool number_float(number_float_t val, const string_t& s) override;
+    bool string(string_t& val) override;
+    bool binary(binary_t& val) override;
+    bool start_object(std::size_t elements) override;
+    bool key(string_t& val) override;
+    bool end_object() override;
+    bool start_array(std::size_t elements) override;
+    bool end_array() override;
+    bool parse_error(std::size_t position, const std::string& lastToken,
+                     const nlohmann::detail::exception& ex) override;
+
+private:
+    bool AddValue(nlohmann::json&& value);
+    bool BeginContainer(nlohmann::json&& container);
+    bool EndContainer();
+    void Complete(nlohmann::json&& value);
+
+    EntityCallback m_OnEntity;
+    nlohmann::json m_Header = nlohmann::json::object();
+    std::string m_Error;
+
+    bool m_InRoot{false};
+    bool m_InEntities{false};
+    std::string m_TopLevelKey;
+
+    // The value being built: the current entity or top-level member, with its open containers on the stack.
+    nlohmann::json m_Current;
+    std::vector<nlohmann::json*> m_Stack;
+    std::string m_PendingKey;
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_SCENEJSONSTREAM_HPP
@@ -0,0 +1,146 @@
+#ifndef PIIXELENGINE_SCENELOADER_HPP
+#define PIIXELENGINE_SCENELOADER_HPP
+
+#include "Components/UUID.hpp"
+#include "Resources/AssetRegistry.hpp"
+
+#include <entt/entt.hpp>
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PiiXeL {
+
+class Scene;
+
+enum class SceneLoadMode {
+    // Builds a new scene that replaces the active one once fully loaded.
+    Single,
+    // Adds the entities to the active scene; they can be removed again as one sub-scene.
+    Additive
+};
+
+enum class SceneLoadState {
+    Parsing,
+    Prefetching,
+    Instantiating,
+    Completed,
+    Failed
+};
+
+// One asynchronous scene load, shared between the caller and the SceneLoader. Only the state may be read
+// from other threads; everything else is main-thread data, apart from what the loader's parse and read jobs fill in.
+class SceneLoadOperation {
+public:
+    SceneLoadOperation(std::string source, SceneLoadMode mode);
+    ~SceneLoadOperation();
+
+    [[nodiscard]] const std::string& GetSource() const { return m_Source; }
+    [[nodiscard]] SceneLoadMode GetMode() const { return m_Mode; }
+    [[nodiscard]] SceneLoadState GetState() const { return m_State.load(std::memory_order_acquire); }
+    [[nodiscard]] bool IsDone() const;
+    // 0 while parsing, then the share of referenced assets and entities already handled.
+    [[nodiscard]] float GetProgress() const;
+
+    // Entities created by this load, which is the sub-scene's entity set for additive loads.
+    [[nodiscard]] const std::vector<entt::entity>& GetEntities() const { return m_Entities; }
+    // The finished scene of a Single load; empty after it has been taken.
+    std::unique_ptr<Scene> TakeScene();
+
+    // Fails the load unless it has finished already. Entities an additive load created so far stay in the scene.
+    void Cancel();
+
+private:
+    friend class SceneLoader;
+
+    // Package of one referenced asset, read and unpacked in a job so the main thread only creates the asset.
+    struct PrefetchedAsset {
+        AssetSource source{};
+        AssetMetadata metadata{};
+        std::vector<uint8_t> data{};
+        bool read{false};
+    };
+
+    // Moves the state on unless it changed in the meantime, which is how a cancel wins over a running job.
+    bool Advance(SceneLoadState from, SceneLoadState to);
+
+    std::string m_Source;
+    SceneLoadMode m_Mode;
+    std::atomic<SceneLoadState> m_State{SceneLoadState::Parsing};
+
+    std::shared_ptr<const nlohmann::json> m_PackageScene;
+    nlohmann::json m_SceneJson;
+    // Contents of a binary scene file; it is instantiated in one step once read.
+    std::vector<uint8_t> m_BinaryScene;
+    std::vector<UUID> m_AudioClips;
+    std::vector<UUID> m_Assets;
+    std::vector<UUID> m_PreloadAssets;
+    // Parallel to m_Assets once prefetching started; the read job publishes each read through m_ReadCount.
+    std::vector<PrefetchedAsset> m_Prefetched;
+    std::atomic<size_t> m_ReadCount{0};
+    bool m_ReadRequested{false};
+    size_t m_NextAsset{0};
+    size_t m_NextEntity{0};
+    size_t m_EntityTotal{0};
+
+    std::unique_ptr<Scene> m_Scene;
+    std::vector<entt::entity> m_Entities;
+};
+
+// Loads scenes without stalling the frame. A JobSystem job reads and parses the scene and collects the assets it
+// references, and a second one reads their packages; Update() then creates those assets and instantiates entities
+// on the main thread, stopping once the frame budget is spent. Loads are applied one at a time in request order,
+// and a pass ends after a Single load completes so additive loads behind it go into the scene that replaces the
+// active one.
+// Binary scene files (BinarySceneSerializer::FileExtension) are read in the parse job and inserted column by column
+// in one step. The jobs only hold their operation, so they may outlive the loader.
+class SceneLoader {
+public:
+    static constexpr float DefaultFrameBudgetMs{4.0f};
+
+    SceneLoader() = default;
+    ~SceneLoader();
+
+    SceneLoader(const SceneLoader&) = delete;
+    SceneLoader& operator=(const SceneLoader&) = delete;
+
+    std::shared_ptr<SceneLoadOperation> LoadAsync(const std::string& filepath, SceneLoadMode mode);
+    // Scene data that is already in memory, such as a game package scene; the load keeps it alive.
+    std::shared_ptr<SceneLoadOperation> LoadAsync(std::shared_ptr<const nlohmann::json> sceneData,
+                                                  const std::string& sceneName, SceneLoadMode mode);
+    // Binary scene contents already in memory, such as a world partition cell from a game package.
+    std::shared_ptr<SceneLoadOperation> LoadAsync(std::vector<uint8_t> binaryScene, const std::string& sceneName,
+                                                  SceneLoadMode mode);
+
+    // Main thread. Additive loads go into activeScene. Returns the loads that finished during this call.
+    std::vector<std::shared_ptr<SceneLoadOperation>> Update(Scene* activeScene);
+    // Fails every pending load; jobs still running for them stop early.
+    void Clear();
+
+    void SetFrameBudget(float milliseconds) { m_FrameBudgetMs = milliseconds; }
+    [[nodiscard]] float GetFrameBudget() const { return m_FrameBudgetMs; }
+    [[nodiscard]] bool IsBusy() const { return !m_Operations.empty(); }
+
+private:
+    void Enqueue(const std::shared_ptr<SceneLoadOperation>& operation);
+    static void Parse(SceneLoadOperation& operation);
+    static void ReadAssets(SceneLoadOperation& operation);
+    // Each returns true once its stage is finished.
+    bool Prefetch(const std::shared_ptr<SceneLoadOperation>& operation, std::chrono::steady_clock::time_point deadline);
+    bool Instantiate(SceneLoadOperation& operation, Scene& scene,
+                     std::chrono::steady_clock::time_point deadline) const;
+    // Returns false when the file is rejected.
+    bool InstantiateBinary(SceneLoadOperation& operation, Scene& scene) const;
+
+    std::deque<std::shared_ptr<SceneLoadOperation>> m_Operations;
+    float m_FrameBudgetMs{DefaultFrameBudgetMs};
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_SCENELOADER_HPP
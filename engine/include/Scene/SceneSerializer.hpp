@@ -1,30 +1,70 @@
 #ifndef PIIXELENGINE_SCENESERIALIZER_HPP
 #define PIIXELENGINE_SCENESERIALIZER_HPP
 
+#include "Components/UUID.hpp"
+
 #include <entt/entt.hpp>
 #include <nlohmann/json.hpp>
 
+#include <iosfwd>
 #include <string>
+#include <vector>
 
 namespace PiiXeL {
 
 class Scene;
+class SceneJsonReader;
+class ScriptComponent;
+struct Script;
 
+// JSON scene files. Both directions stream: entities are written one at a time and instantiated as soon as
+// each one has been parsed, so the document as a whole is never held in memory. Loads build a staging scene and
+// swap it into the target only once the whole file has parsed, so a malformed file leaves the open scene as it was.
+//
+// Delta-encoded scenes carry "delta": true and write each component as the fields that differ from the type
+// default. Prefab instances are written against their prefab instead, named by the entity's "base" key, so
+// unchanged components are left out and pick up later edits of the prefab.
 class SceneSerializer {
 public:
     explicit SceneSerializer(Scene* scene);
 
+    // Encoding written by Serialize() and expected by DeserializeEntity(); Deserialize() follows the file.
+    void SetDeltaEncoding(bool deltaEncoding) { m_DeltaEncoding = deltaEncoding; }
+    [[nodiscard]] bool IsDeltaEncoding() const { return m_DeltaEncoding; }
+
     bool Serialize(const std::string& filepath);
     bool Deserialize(const std::string& filepath);
 
     std::string SerializeToString();
     bool DeserializeFromString(const std::string& data);
 
+    // Creates one entity in the scene and registers its UUID; it is not added to the entity order.
+    entt::entity DeserializeEntity(const nlohmann::json& entityJson);
+
+    [[nodiscard]] static bool IsDeltaEncoded(const nlohmann::json& sceneJson);
+    // Components of an entity JSON object, resolving the prefab base of delta-encoded entities. The "uuid" and
+    // script keys are left to the caller.
+    static void DeserializeComponents(entt::registry& registry, entt::entity entity, const nlohmann::json& entityJson,
+                                      bool deltaEncoded);
+    [[nodiscard]] static std::vector<UUID> ReadPreloadManifest(const nlohmann::json& sceneJson);
+    // The "Scripts" array of an entity: names, enabled flags and reflected properties of live instances.
+    [[nodiscard]] static nlohmann::json SerializeScripts(const Script& scriptComponent);
+    static void ApplyScriptProperties(ScriptComponent& script, const nlohmann::json& scriptJson);
+
 private:
     Scene* m_Scene;
+    bool m_DeltaEncoding{false};
+    // Encoding the streamed entities were created with, fixed by the header when the first one arrived.
+    bool m_EntitiesRead{false};
+    bool m_EntitiesDelta{false};
+
+    void WriteScene(std::ostream& stream, int indent);
+    void AddEntity(const nlohmann::json& entityJson, const nlohmann::json& header);
+    entt::entity CreateEntity(const nlohmann::json& entityJson, bool deltaEncoded);
+    bool FinishRead(const SceneJsonReader& reader, bool parsed);
 
     nlohmann::json SerializeEntity(entt::entity entity);
-    entt::entity DeserializeEntity(const nlohmann::json& entityJson);
+    nlohmann::json SerializePreloadManifest();
 };
 
 } // namespace PiiXeL
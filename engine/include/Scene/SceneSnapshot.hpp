@@ -0,0 +1,53 @@
+#ifndef PIIXELENGINE_SCENESNAPSHOT_HPP
+#define PIIXELENGINE_SCENESNAPSHOT_HPP
+
+#include "Scene/EntityOrder.hpp"
+
+#include <entt/entt.hpp>
+
+#include <any>
+#include <cstdint>
+#include <vector>
+
+namespace PiiXeL {
+
+class Scene;
+
+namespace Reflection {
+class TypeInfo;
+}
+
+// In-memory copy of a scene used to enter and leave play mode. Capture() copies every component storage into a
+// private registry with the same entity identifiers, one bulk insert per type. Script instances are not copied;
+// their serializable properties are recorded instead, plain data fields as one contiguous byte block. Restore()
+// swaps the copy back into the scene's registry and rebuilds the script instances from those records.
+class SceneSnapshot {
+public:
+    void Capture(Scene& scene);
+    // Returns false when nothing was captured. The snapshot is empty afterwards.
+    bool Restore(Scene& scene);
+    void Clear();
+
+    [[nodiscard]] bool IsEmpty() const { return !m_Captured; }
+
+private:
+    struct ScriptState {
+        entt::entity entity;
+        uint32_t scriptIndex;
+        bool enabled;
+        const Reflection::TypeInfo* typeInfo;
+        size_t dataOffset;
+        size_t valueOffset;
+    };
+
+    entt::registry m_Registry;
+    EntityOrder m_EntityOrder;
+    std::vector<ScriptState> m_Scripts;
+    std::vector<uint8_t> m_PropertyData;
+    std::vector<std::any> m_PropertyValues;
+    bool m_Captured{false};
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_SCENESNAPSHOT_HPP
@@ -0,0 +1,87 @@
+#ifndef PIIXELENGINE_WORLDPARTITION_HPP
+#define PIIXELENGINE_WORLDPARTITION_HPP
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <raylib.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PiiXeL {
+
+class GamePackage;
+class Scene;
+class SceneLoader;
+class SceneLoadOperation;
+
+struct WorldPartitionSettings {
+    float cellSize{2048.0f};
+    // Cells up to loadRadius cells away from the camera's cell are loaded. A loaded cell stays until it is more
+    // than unloadRadius cells away, so walking back and forth over a cell border does not reload anything.
+    int loadRadius{1};
+    int unloadRadius{2};
+};
+
+// Splits a scene into square cells stored as separate binary chunks, and streams them around a focus point.
+// Entities are assigned to the cell holding their position when the partition is built and belong to it from
+// then on. Entities without a Transform, cameras and audio listeners go to the persistent chunk, which is
+// loaded once with the world. Cells are loaded additively through the SceneLoader and unloaded as sub-scenes.
+class WorldPartition {
+public:
+    static constexpr const char* FileExtension{".partition"};
+
+    // Writes the manifest to manifestPath and the chunks to a "<name>_cells" directory next to it.
+    static bool Build(Scene& scene, const std::string& manifestPath, const WorldPartitionSettings& settings);
+
+    bool Open(const std::string& manifestPath);
+    // A world packaged into a game package, with its chunks stored under their paths relative to the manifest.
+    // The package must outlive the open partition; cell chunks are copied out of it as they are requested.
+    bool Open(const GamePackage& package, const std::string& manifestPath);
+    // Replaces the scene's contents with the persistent chunk, from disk or from the package.
+    bool LoadPersistentChunk(Scene& scene) const;
+    // Forgets every cell and cancels the cell loads still in flight; entities already loaded stay in the scene.
+    void Close();
+
+    // Requests the cells that came into range, nearest first, and returns the finished loads of the cells that
+    // went out of range. The caller unloads those. A cell whose load failed is requested again on the next update
+    // while it is in range, and skipped after a few failed attempts.
+    std::vector<std::shared_ptr<SceneLoadOperation>> Update(Vector2 focus, SceneLoader& loader);
+
+    [[nodiscard]] bool IsOpen() const { return m_Open; }
+    [[nodiscard]] const std::string& GetPersistentChunk() const { return m_PersistentChunk; }
+    [[nodiscard]] const WorldPartitionSettings& GetSettings() const { return m_Settings; }
+    [[nodiscard]] size_t GetCellCount() const { return m_Cells.size(); }
+    [[nodiscard]] size_t GetActiveCellCount() const { return m_ActiveCells.size(); }
+
+private:
+    struct Cell {
+        int32_t x{0};
+        int32_t y{0};
+        std::string chunk;
+        std::shared_ptr<SceneLoadOperation> operation;
+        uint32_t failedLoads{0};
+    };
+
+    bool ReadManifest(const nlohmann::json& manifestJson, const std::string& manifestPath);
+
+    [[nodiscard]] static uint64_t CellKey(int32_t x, int32_t y);
+    [[nodiscard]] int32_t CellCoordinate(float position) const;
+
+    bool m_Open{false};
+    const GamePackage* m_Package{nullptr};
+    WorldPartitionSettings m_Settings;
+    std::string m_PersistentChunk;
+    std::unordered_map<uint64_t, Cell> m_Cells;
+    // Cells with a load in flight or loaded, so an update only looks at the neighbourhood of the focus.
+    std::vector<uint64_t> m_ActiveCells;
+    int32_t m_FocusX{0};
+    int32_t m_FocusY{0};
+    bool m_HasFocus{false};
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_WORLDPARTITION_HPP
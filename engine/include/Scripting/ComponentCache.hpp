@@ -0,0 +1,101 @@
+#ifndef PIIXELENGINE_COMPONENTCACHE_HPP
+#define PIIXELENGINE_COMPONENTCACHE_HPP
+
+#include "Scripting/ScriptCommandBuffer.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace PiiXeL {
+
+// Bumped whenever a component of one type is constructed or destroyed. Destruction may move the last
+// element into the freed slot, so a cached component pointer is only trusted while the counter is unchanged.
+struct StorageGeneration {
+    uint64_t value{1};
+
+    void Bump(entt::registry& registry, entt::entity entity) {
+        (void)registry;
+        (void)entity;
+        ++value;
+    }
+};
+
+// Registry context slot; the counter lives on the heap so the signal connection survives context rehashing.
+template <typename T>
+struct StorageGenerationSlot {
+    std::unique_ptr<StorageGeneration> generation;
+};
+
+// Returns nullptr when the counter does not exist yet and cannot be created, i.e. during OnParallelUpdate,
+// where the registry must not be modified.
+template <typename T>
+const StorageGeneration* GetStorageGeneration(entt::registry& registry) {
+    if (StorageGenerationSlot<T>* slot = registry.ctx().template find<StorageGenerationSlot<T>>()) {
+        return slot->generation.get();
+    }
+
+    if (ScriptCommandBuffer::GetCurrent()) {
+        return nullptr;
+    }
+
+    StorageGenerationSlot<T>& slot =
+        registry.ctx().template emplace<StorageGenerationSlot<T>>(std::make_unique<StorageGeneration>());
+    registry.on_construct<T>().template connect<&StorageGeneration::Bump>(*slot.generation);
+    registry.on_destroy<T>().template connect<&StorageGeneration::Bump>(*slot.generation);
+    return slot.generation.get();
+}
+
+// Component pointers of one entity, revalidated against the storage generation instead of looked up again.
+class ComponentCache {
+public:
+    template <typename T>
+    T* Get(entt::registry& registry, entt::entity entity) {
+        if (entity != m_Entity || &registry != m_Registry) {
+            m_Entries.clear();
+            m_Entity = entity;
+            m_Registry = &registry;
+        }
+
+        const entt::id_type type = entt::type_hash<T>::value();
+        for (Entry& entry : m_Entries) {
+            if (entry.type == type) {
+                if (entry.cachedGeneration != entry.generation->value) {
+                    entry.component = registry.try_get<T>(entity);
+                    entry.cachedGeneration = entry.generation->value;
+                }
+                return static_cast<T*>(entry.component);
+            }
+        }
+
+        T* component = registry.try_get<T>(entity);
+        if (const StorageGeneration* generation = GetStorageGeneration<T>(registry)) {
+            m_Entries.push_back({type, component, generation, generation->value});
+        }
+        return component;
+    }
+
+    void Clear() {
+        m_Entries.clear();
+        m_Entity = entt::null;
+        m_Registry = nullptr;
+    }
+
+private:
+    struct Entry {
+        entt::id_type type;
+        void* component;
+        const StorageGeneration* generation;
+        uint64_t cachedGeneration;
+    };
+
+    std::vector<Entry> m_Entries;
+    entt::entity m_Entity{entt::null};
+    entt::registry* m_Registry{nullptr};
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_COMPONENTCACHE_HPP
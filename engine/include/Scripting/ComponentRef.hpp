@@ -2,30 +2,46 @@
 #define PIIXELENGINE_COMPONENTREF_HPP
 
 #include "Components/UUID.hpp"
+#include "Scripting/ComponentCache.hpp"
 #include "Scripting/EntityRef.hpp"
 
 #include <entt/entt.hpp>
 
+#include <cstdint>
 #include <optional>
 
 namespace PiiXeL {
 
+// Resolves to the component on the referenced entity; the pointer is cached and only looked up again when
+// the entity or the component storage changed.
 template <typename T>
 class ComponentRef {
 public:
     ComponentRef() = default;
     explicit ComponentRef(UUID entityUUID) : m_EntityRef{entityUUID} {}
-    explicit ComponentRef(entt::entity entity) : m_EntityRef{entity} {}
+    ComponentRef(entt::registry& registry, entt::entity entity)
+        : m_EntityRef{registry, entity}, m_Registry{&registry} {}
 
-    void SetEntity(entt::entity entity) { m_EntityRef.Set(entity); }
+    // Needs the registry first, since the entity is stored by the UUID it carries there.
+    void SetEntity(entt::entity entity) {
+        if (m_Registry) {
+            m_EntityRef.Set(*m_Registry, entity);
+        }
+    }
 
     void SetEntityUUID(UUID uuid) { m_EntityRef.SetUUID(uuid); }
 
+    void SetRegistry(entt::registry* registry) {
+        m_Registry = registry;
+        m_Generation = nullptr;
+        m_CachedEntity = entt::null;
+    }
+
     [[nodiscard]] UUID GetEntityUUID() const { return m_EntityRef.GetUUID(); }
 
-    [[nodiscard]] entt::entity GetEntity() const { return m_EntityRef.Get(); }
+    [[nodiscard]] entt::entity GetEntity() const { return m_Registry ? m_EntityRef.Get(*m_Registry) : entt::null; }
 
-    [[nodiscard]] bool IsValid() const { return m_EntityRef.IsValid(); }
+    [[nodiscard]] bool IsValid() const { return GetEntity() != entt::null; }
 
     [[nodiscard]] bool HasComponent() const;
 
@@ -38,9 +54,58 @@ public:
     explicit operator bool() const { return IsValid() && HasComponent(); }
 
 private:
+    T* Resolve() const;
+
     EntityRef m_EntityRef;
+    entt::registry* m_Registry{nullptr};
+    mutable const StorageGeneration* m_Generation{nullptr};
+    mutable T* m_CachedComponent{nullptr};
+    mutable entt::entity m_CachedEntity{entt::null};
+    mutable uint64_t m_CachedGeneration{0};
 };
 
+template <typename T>
+T* ComponentRef<T>::Resolve() const {
+    if (!m_Registry) {
+        return nullptr;
+    }
+
+    entt::entity entity = m_EntityRef.Get(*m_Registry);
+    if (entity == entt::null) {
+        return nullptr;
+    }
+
+    if (!m_Generation) {
+        m_Generation = GetStorageGeneration<T>(*m_Registry);
+        if (!m_Generation) {
+            return m_Registry->valid(entity) ? m_Registry->try_get<T>(entity) : nullptr;
+        }
+    }
+
+    // The entity handle carries its version, so a recycled entity never matches the cached one.
+    if (entity != m_CachedEntity || m_CachedGeneration != m_Generation->value) {
+        m_CachedComponent = m_Registry->valid(entity) ? m_Registry->try_get<T>(entity) : nullptr;
+        m_CachedEntity = entity;
+        m_CachedGeneration = m_Generation->value;
+    }
+    return m_CachedComponent;
+}
+
+template <typename T>
+bool ComponentRef<T>::HasComponent() const {
+    return Resolve() != nullptr;
+}
+
+template <typename T>
+T* ComponentRef<T>::Get() {
+    return Resolve();
+}
+
+template <typename T>
+const T* ComponentRef<T>::Get() const {
+    return Resolve();
+}
+
 } // namespace PiiXeL
 
 #endif
@@ -0,0 +1,147 @@
+#ifndef PIIXELENGINE_COROUTINE_HPP
+#define PIIXELENGINE_COROUTINE_HPP
+
+#include <entt/entt.hpp>
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace PiiXeL {
+
+class CoroutineScheduler;
+
+// Size-class pool for coroutine frames; blocks are recycled instead of going back to the heap.
+class CoroutineFrameAllocator {
+public:
+    static constexpr size_t MinBlockSize{128};
+    static constexpr size_t ClassCount{5};
+    static constexpr size_t ChunkSize{64 * 1024};
+
+    CoroutineFrameAllocator(const CoroutineFrameAllocator&) = delete;
+    CoroutineFrameAllocator& operator=(const CoroutineFrameAllocator&) = delete;
+
+    static CoroutineFrameAllocator& Instance();
+
+    void* Allocate(size_t size);
+    void Deallocate(void* ptr, size_t size);
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    CoroutineFrameAllocator() = default;
+    ~CoroutineFrameAllocator();
+
+    [[nodiscard]] static size_t GetSizeClass(size_t size);
+
+    std::array<FreeBlock*, ClassCount> m_FreeLists{};
+    std::vector<void*> m_Chunks;
+    std::mutex m_Mutex;
+};
+
+struct CoroutineId {
+    uint32_t index{UINT32_MAX};
+    uint32_t generation{0};
+
+    [[nodiscard]] bool IsValid() const { return index != UINT32_MAX; }
+};
+
+// Return type for script coroutines; hand it to ScriptComponent::StartCoroutine.
+class Coroutine {
+public:
+    struct promise_type {
+        CoroutineScheduler* scheduler{nullptr};
+        uint32_t record{0};
+
+        Coroutine get_return_object() { return Coroutine{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception();
+
+        static void* operator new(size_t size) { return CoroutineFrameAllocator::Instance().Allocate(size); }
+        static void operator delete(void* ptr, size_t size) { CoroutineFrameAllocator::Instance().Deallocate(ptr, size); }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Coroutine() = default;
+    explicit Coroutine(Handle handle) : m_Handle{handle} {}
+    Coroutine(Coroutine&& other) noexcept : m_Handle{std::exchange(other.m_Handle, nullptr)} {}
+    Coroutine& operator=(Coroutine&& other) noexcept {
+        if (this != &other) {
+            if (m_Handle) {
+                m_Handle.destroy();
+            }
+            m_Handle = std::exchange(other.m_Handle, nullptr);
+        }
+        return *this;
+    }
+    Coroutine(const Coroutine&) = delete;
+    Coroutine& operator=(const Coroutine&) = delete;
+    ~Coroutine() {
+        if (m_Handle) {
+            m_Handle.destroy();
+        }
+    }
+
+    [[nodiscard]] Handle Release() { return std::exchange(m_Handle, nullptr); }
+
+private:
+    Handle m_Handle{nullptr};
+};
+
+struct WaitSeconds {
+    float seconds{0.0f};
+
+    explicit WaitSeconds(float duration) : seconds{duration} {}
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Coroutine::Handle handle) const;
+    void await_resume() const noexcept {}
+};
+
+struct NextFrame {
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Coroutine::Handle handle) const;
+    void await_resume() const noexcept {}
+};
+
+struct NextFixedStep {
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Coroutine::Handle handle) const;
+    void await_resume() const noexcept {}
+};
+
+// Polled once per frame while suspended; prefer the timer-based awaitables when the wake time is known.
+struct WaitUntil {
+    std::function<bool()> predicate;
+
+    explicit WaitUntil(std::function<bool()> condition) : predicate{std::move(condition)} {}
+
+    bool await_ready() const { return predicate && predicate(); }
+    void await_suspend(Coroutine::Handle handle);
+    void await_resume() const noexcept {}
+};
+
+// Resumes once the entity's Animator finishes a non-looping state, or the entity is gone.
+struct AnimationFinished {
+    entt::entity entity{entt::null};
+
+    explicit AnimationFinished(entt::entity target) : entity{target} {}
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Coroutine::Handle handle) const;
+    void await_resume() const noexcept {}
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_COROUTINE_HPP
@@ -0,0 +1,91 @@
+#ifndef PIIXELENGINE_COROUTINESCHEDULER_HPP
+#define PIIXELENGINE_COROUTINESCHEDULER_HPP
+
+#include "Scripting/Coroutine.hpp"
+#include "Scripting/TimerWheel.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace PiiXeL {
+
+// Resumes script coroutines for one registry. Lives in the registry context, so every suspended frame is
+// destroyed along with the scene; destroying a Script component cancels the coroutines of its entity.
+class CoroutineScheduler {
+public:
+    static constexpr float TickSeconds{0.001f};
+
+    explicit CoroutineScheduler(entt::registry& registry);
+    ~CoroutineScheduler();
+
+    CoroutineScheduler(const CoroutineScheduler&) = delete;
+    CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+
+    static CoroutineScheduler& Get(entt::registry& registry);
+
+    CoroutineId Start(Coroutine coroutine, entt::entity entity, const std::shared_ptr<void>& owner);
+    void Stop(CoroutineId id);
+    void StopOwner(const void* owner);
+    void StopEntity(entt::entity entity);
+
+    void Update(float deltaTime);
+    void FixedStep();
+
+    void ScheduleAfter(uint32_t record, float seconds);
+    void ScheduleNextFrame(uint32_t record);
+    void ScheduleNextFixedStep(uint32_t record);
+    void ScheduleWhen(uint32_t record, std::function<bool()> predicate);
+
+    [[nodiscard]] bool IsRunning(CoroutineId id) const;
+    [[nodiscard]] size_t GetActiveCount() const { return m_ActiveCount; }
+    [[nodiscard]] entt::registry& GetRegistry() { return m_Registry; }
+
+private:
+    struct Record {
+        Coroutine::Handle handle{nullptr};
+        std::weak_ptr<void> owner{};
+        const void* ownerKey{nullptr};
+        entt::entity entity{entt::null};
+        uint32_t generation{0};
+        bool waiting{false};
+        bool running{false};
+        bool cancelled{false};
+    };
+
+    struct Condition {
+        CoroutineId id{};
+        std::function<bool()> predicate;
+    };
+
+    void OnScriptDestroyed(entt::registry& registry, entt::entity entity);
+    void Resume(CoroutineId id);
+    void Cancel(uint32_t index);
+    void Release(uint32_t index);
+    void ResumeAll(std::vector<CoroutineId>& ids);
+    [[nodiscard]] CoroutineId MakeId(uint32_t index) const { return CoroutineId{index, m_Records[index].generation}; }
+    [[nodiscard]] bool IsLive(CoroutineId id) const;
+    [[nodiscard]] static uint64_t Pack(CoroutineId id);
+    [[nodiscard]] static CoroutineId Unpack(uint64_t value);
+
+    entt::registry& m_Registry;
+    std::vector<Record> m_Records;
+    std::vector<uint32_t> m_FreeRecords;
+    std::unordered_map<entt::entity, std::vector<uint32_t>> m_EntityRecords;
+    TimerWheel m_Timers;
+    std::vector<CoroutineId> m_NextFrame;
+    std::vector<CoroutineId> m_NextFixedStep;
+    std::vector<Condition> m_Conditions;
+    std::vector<CoroutineId> m_Ready;
+    std::vector<Condition> m_Polling;
+    double m_TickAccumulator{0.0};
+    size_t m_ActiveCount{0};
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_COROUTINESCHEDULER_HPP
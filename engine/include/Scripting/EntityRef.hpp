@@ -5,27 +5,50 @@
 
 #include <entt/entt.hpp>
 
+#include <atomic>
+#include <cstdint>
+
 namespace PiiXeL {
 
+class EntityIndex;
+
+// Stores the referenced entity's UUID and resolves it against the index of the scene it is used in, either passed
+// directly or found through that scene's registry. The lookup cache is guarded by a sequence counter, so const
+// accessors stay safe while parallel script batches share a reference.
 class EntityRef {
 public:
     EntityRef() = default;
     explicit EntityRef(UUID uuid) : m_UUID{uuid} {}
-    explicit EntityRef(entt::entity entity);
-
-    [[nodiscard]] entt::entity Get() const;
-    void Set(entt::entity entity);
+    EntityRef(const entt::registry& registry, entt::entity entity);
+
+    // Copies the reference only; the cache validates itself against the UUID and index generation.
+    EntityRef(const EntityRef& other) : m_UUID{other.m_UUID} {}
+    EntityRef& operator=(const EntityRef& other) {
+        m_UUID = other.m_UUID;
+        return *this;
+    }
+
+    [[nodiscard]] entt::entity Get(const EntityIndex& index) const;
+    [[nodiscard]] entt::entity Get(const entt::registry& registry) const;
+    // Takes the UUID component of the entity, or clears the reference when it has none.
+    void Set(const entt::registry& registry, entt::entity entity);
     void SetUUID(UUID uuid) { m_UUID = uuid; }
     [[nodiscard]] UUID GetUUID() const { return m_UUID; }
 
-    [[nodiscard]] bool IsValid() const;
-
-    operator entt::entity() const { return Get(); }
+    [[nodiscard]] bool IsSet() const { return m_UUID.Get() != 0; }
+    [[nodiscard]] bool IsValid(const entt::registry& registry) const { return Get(registry) != entt::null; }
 
     bool operator==(const EntityRef& other) const { return m_UUID == other.m_UUID; }
     bool operator!=(const EntityRef& other) const { return m_UUID != other.m_UUID; }
 
     UUID m_UUID{0};
+
+private:
+    // Odd while a thread is writing the cache; readers that see it change fall back to a plain lookup.
+    mutable std::atomic<uint32_t> m_CacheSequence{0};
+    mutable std::atomic<uint32_t> m_CachedEntity{entt::to_integral(entt::entity{entt::null})};
+    mutable std::atomic<uint64_t> m_CachedUUID{0};
+    mutable std::atomic<uint64_t> m_CachedGeneration{0};
 };
 
 } // namespace PiiXeL
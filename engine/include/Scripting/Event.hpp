@@ -5,12 +5,13 @@
 
 #include <functional>
 #include <memory>
-#include <typeindex>
-#include <unordered_map>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace PiiXeL {
 
+// Immediate callbacks, invoked in subscription order.
 template <typename... Args>
 class Event {
 public:
@@ -18,86 +19,244 @@ public:
     using CallbackId = size_t;
 
     CallbackId Subscribe(Callback callback) {
-        CallbackId id = m_NextId++;
-        m_Callbacks[id] = std::move(callback);
+        CallbackId id = ++m_LastId;
+        m_Callbacks.push_back({id, std::move(callback)});
         return id;
     }
 
-    void Unsubscribe(CallbackId id) { m_Callbacks.erase(id); }
+    void Unsubscribe(CallbackId id) {
+        std::erase_if(m_Callbacks, [id](const Entry& entry) { return entry.id == id; });
+    }
 
     void Invoke(Args... args) {
-        for (auto& [id, callback] : m_Callbacks) {
-            callback(args...);
+        for (size_t i = 0; i < m_Callbacks.size(); ++i) {
+            m_Callbacks[i].callback(args...);
         }
     }
 
     void Clear() { m_Callbacks.clear(); }
 
 private:
-    std::unordered_map<CallbackId, Callback> m_Callbacks;
-    CallbackId m_NextId{0};
+    struct Entry {
+        CallbackId id;
+        Callback callback;
+    };
+
+    std::vector<Entry> m_Callbacks;
+    CallbackId m_LastId{0};
+};
+
+enum class ContactPhase {
+    Enter,
+    Stay,
+    Exit
 };
 
 struct CollisionEvent {
     entt::entity self;
     entt::entity other;
+    ContactPhase phase;
 };
 
 struct TriggerEvent {
     entt::entity self;
     entt::entity other;
+    ContactPhase phase;
+};
+
+class EventQueueBase {
+public:
+    virtual ~EventQueueBase() = default;
+
+    virtual void Flush() = 0;
+    virtual void Clear() = 0;
 };
 
-class EventDispatcher {
+// Events of one type, stored contiguously until the next flush. Listeners run in subscription order; batch
+// listeners receive every flushed event at once. Events enqueued while flushing wait for the next flush; a Flush
+// called from inside a listener is deferred until the running one has finished and then delivers them.
+template <typename EventType>
+class EventQueue final : public EventQueueBase {
 public:
-    static EventDispatcher& Instance() {
-        static EventDispatcher instance;
-        return instance;
+    using Listener = std::function<void(const EventType&)>;
+    using BatchListener = std::function<void(std::span<const EventType>)>;
+
+    size_t Subscribe(Listener listener) { return AddListener({++m_LastId, std::move(listener), {}}); }
+    size_t SubscribeBatch(BatchListener listener) { return AddListener({++m_LastId, {}, std::move(listener)}); }
+
+    void Unsubscribe(size_t id) {
+        std::erase_if(m_AddedListeners, [id](const ListenerEntry& entry) { return entry.id == id; });
+        for (ListenerEntry& entry : m_Listeners) {
+            if (entry.id == id) {
+                entry.id = 0;
+                m_HasRemovedListeners = true;
+            }
+        }
+
+        if (!m_Flushing) {
+            RemoveDeadListeners();
+        }
     }
 
-    template <typename EventType>
-    size_t Subscribe(std::function<void(const EventType&)> callback) {
-        auto& event = GetEvent<EventType>();
-        return event.Subscribe(callback);
+    void Enqueue(const EventType& event) { m_Pending.push_back(event); }
+
+    template <typename... Args>
+    void Emplace(Args&&... args) {
+        m_Pending.push_back(EventType{std::forward<Args>(args)...});
+    }
+
+    [[nodiscard]] bool HasListeners() const { return !m_Listeners.empty() || !m_AddedListeners.empty(); }
+    [[nodiscard]] size_t GetPendingCount() const { return m_Pending.size(); }
+
+    void Flush() override {
+        if (m_Flushing) {
+            m_FlushRequested = true;
+            return;
+        }
+
+        do {
+            m_FlushRequested = false;
+            Deliver();
+        } while (m_FlushRequested);
+    }
+
+    void Clear() override {
+        m_Pending.clear();
+        if (!m_Flushing) {
+            m_Delivering.clear();
+        }
+    }
+
+private:
+    struct ListenerEntry {
+        size_t id;
+        Listener listener;
+        BatchListener batchListener;
+    };
+
+    void Deliver() {
+        if (m_Pending.empty()) {
+            return;
+        }
+
+        std::swap(m_Pending, m_Delivering);
+        m_Flushing = true;
+
+        std::span<const EventType> events{m_Delivering};
+        for (size_t i = 0; i < m_Listeners.size(); ++i) {
+            if (m_Listeners[i].id == 0) {
+                continue;
+            }
+
+            if (m_Listeners[i].batchListener) {
+                m_Listeners[i].batchListener(events);
+                continue;
+            }
+
+            for (const EventType& event : events) {
+                m_Listeners[i].listener(event);
+                if (m_Listeners[i].id == 0) {
+                    break;
+                }
+            }
+        }
+
+        m_Flushing = false;
+        m_Delivering.clear();
+        RemoveDeadListeners();
+
+        for (ListenerEntry& entry : m_AddedListeners) {
+            m_Listeners.push_back(std::move(entry));
+        }
+        m_AddedListeners.clear();
+    }
+
+    // Listeners subscribed from inside a flush are held back so the listener array is never reallocated
+    // while one of its callbacks is running.
+    size_t AddListener(ListenerEntry entry) {
+        size_t id = entry.id;
+        if (m_Flushing) {
+            m_AddedListeners.push_back(std::move(entry));
+        }
+        else {
+            m_Listeners.push_back(std::move(entry));
+        }
+        return id;
+    }
+
+    void RemoveDeadListeners() {
+        if (m_HasRemovedListeners) {
+            std::erase_if(m_Listeners, [](const ListenerEntry& entry) { return entry.id == 0; });
+            m_HasRemovedListeners = false;
+        }
     }
 
+    std::vector<ListenerEntry> m_Listeners;
+    std::vector<ListenerEntry> m_AddedListeners;
+    std::vector<EventType> m_Pending;
+    std::vector<EventType> m_Delivering;
+    size_t m_LastId{0};
+    bool m_Flushing{false};
+    bool m_FlushRequested{false};
+    bool m_HasRemovedListeners{false};
+};
+
+// Deferred event bus for one registry, living in its context. Events are queued during the frame and
+// delivered when the engine flushes at its sync points. Main thread only.
+class EventBus {
+public:
+    static EventBus& Get(entt::registry& registry);
+
     template <typename EventType>
-    void Unsubscribe(size_t id) {
-        auto& event = GetEvent<EventType>();
-        event.Unsubscribe(id);
+    EventQueue<EventType>& GetQueue() {
+        size_t index = entt::type_index<EventType>::value();
+        if (index >= m_Queues.size()) {
+            m_Queues.resize(index + 1);
+        }
+
+        std::unique_ptr<EventQueueBase>& queue = m_Queues[index];
+        if (!queue) {
+            queue = std::make_unique<EventQueue<EventType>>();
+        }
+        return static_cast<EventQueue<EventType>&>(*queue);
     }
 
     template <typename EventType>
-    void Dispatch(const EventType& eventData) {
-        auto& event = GetEvent<EventType>();
-        event.Invoke(eventData);
+    size_t Subscribe(typename EventQueue<EventType>::Listener listener) {
+        return GetQueue<EventType>().Subscribe(std::move(listener));
     }
 
     template <typename EventType>
-    void Clear() {
-        auto& event = GetEvent<EventType>();
-        event.Clear();
+    size_t SubscribeBatch(typename EventQueue<EventType>::BatchListener listener) {
+        return GetQueue<EventType>().SubscribeBatch(std::move(listener));
     }
 
-private:
-    EventDispatcher() = default;
+    template <typename EventType>
+    void Unsubscribe(size_t id) {
+        GetQueue<EventType>().Unsubscribe(id);
+    }
 
     template <typename EventType>
-    Event<const EventType&>& GetEvent() {
-        std::type_index typeIndex = std::type_index(typeid(EventType));
-
-        auto it = m_Events.find(typeIndex);
-        if (it == m_Events.end()) {
-            auto event = std::make_unique<Event<const EventType&>>();
-            Event<const EventType&>* eventPtr = event.get();
-            m_Events[typeIndex] = std::move(event);
-            return *eventPtr;
-        }
+    void Enqueue(const EventType& event) {
+        GetQueue<EventType>().Enqueue(event);
+    }
 
-        return *static_cast<Event<const EventType&>*>(it->second.get());
+    template <typename EventType>
+    [[nodiscard]] bool HasListeners() const {
+        size_t index = entt::type_index<EventType>::value();
+        return index < m_Queues.size() && m_Queues[index] &&
+               static_cast<const EventQueue<EventType>&>(*m_Queues[index]).HasListeners();
     }
 
-    std::unordered_map<std::type_index, std::unique_ptr<void, void (*)(void*)>> m_Events;
+    // Sync point: delivers everything queued so far, one event type after another. Calling it from a listener only
+    // requests another pass, which runs once the current one returns.
+    void Flush();
+    void Clear();
+
+private:
+    std::vector<std::unique_ptr<EventQueueBase>> m_Queues;
+    bool m_Flushing{false};
+    bool m_FlushRequested{false};
 };
 
 } // namespace PiiXeL
@@ -0,0 +1,35 @@
+#ifndef PIIXELENGINE_SCRIPTCOMMANDBUFFER_HPP
+#define PIIXELENGINE_SCRIPTCOMMANDBUFFER_HPP
+
+#include <functional>
+#include <vector>
+
+namespace PiiXeL {
+
+class Scene;
+
+// Structural changes recorded by scripts during the parallel update phase, replayed on the main thread.
+class ScriptCommandBuffer {
+public:
+    using Command = std::function<void(Scene&)>;
+
+    void Record(Command command) { m_Commands.push_back(std::move(command)); }
+    void Apply(Scene& scene);
+    void Clear() { m_Commands.clear(); }
+
+    [[nodiscard]] bool IsEmpty() const { return m_Commands.empty(); }
+    [[nodiscard]] size_t GetCommandCount() const { return m_Commands.size(); }
+
+    // Non-null only on a thread that is running OnParallelUpdate.
+    [[nodiscard]] static ScriptCommandBuffer* GetCurrent() { return s_Current; }
+    static void SetCurrent(ScriptCommandBuffer* buffer) { s_Current = buffer; }
+
+private:
+    std::vector<Command> m_Commands;
+
+    static thread_local ScriptCommandBuffer* s_Current;
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_SCRIPTCOMMANDBUFFER_HPP
@@ -2,17 +2,24 @@
 #define PIIXELENGINE_SCRIPTCOMPONENT_HPP
 
 #include "Physics/ComponentHandles.hpp"
+#include "Scripting/ComponentCache.hpp"
+#include "Scripting/Coroutine.hpp"
 
 #include <entt/entt.hpp>
 
+#include <functional>
+#include <memory>
 #include <optional>
 #include <raylib.h>
+#include <string>
 
 namespace PiiXeL {
 
 class Scene;
 
-class ScriptComponent {
+// Scripts are normally owned through a shared_ptr by their Script component; the scheduler locks that ownership
+// while it resumes one of the script's coroutines, so the script cannot be destroyed under a running coroutine.
+class ScriptComponent : public std::enable_shared_from_this<ScriptComponent> {
 public:
     ScriptComponent() = default;
     virtual ~ScriptComponent() = default;
@@ -40,14 +47,25 @@ public:
         }
     }
 
+    void ExecuteParallelUpdate(float deltaTime) {
+        if (m_Initialized && m_Enabled && m_Started) {
+            OnParallelUpdate(deltaTime);
+        }
+    }
+
+    // Opt-in: scripts returning true get OnParallelUpdate on a worker thread before the serial OnUpdate pass.
+    [[nodiscard]] virtual bool UsesParallelUpdate() const { return false; }
+
     void SetEnabled(bool enabled) { m_Enabled = enabled; }
     [[nodiscard]] bool IsEnabled() const { return m_Enabled; }
     [[nodiscard]] entt::entity GetEntity() const { return m_Entity; }
     [[nodiscard]] Scene* GetScene() const { return m_Scene; }
 
+    // Pointers are cached per component type and only looked up again after that storage changed.
     template <typename T>
     T* GetComponent();
 
+    // During OnParallelUpdate the add is deferred to the main thread and nullptr is returned.
     template <typename T>
     T* AddComponent();
 
@@ -58,9 +76,20 @@ public:
     void SetPosition(Vector2 position);
     void Translate(Vector2 offset);
 
+    // Deferred when called from OnParallelUpdate: CreateEntity then returns entt::null and reports the
+    // entity through onCreated once it exists.
+    entt::entity CreateEntity(const std::string& name = "Entity", std::function<void(entt::entity)> onCreated = {});
+    void DestroyEntity(entt::entity entity);
+
     template <typename Component>
     [[nodiscard]] std::optional<typename ComponentHandle<Component>::Type> GetHandle();
 
+    // Deferred when called from OnParallelUpdate, returning an invalid id; that needs the script to be owned by a
+    // shared_ptr, and the start is refused otherwise.
+    CoroutineId StartCoroutine(Coroutine coroutine);
+    void StopCoroutine(CoroutineId id);
+    void StopAllCoroutines();
+
     virtual void OnCollisionEnter(entt::entity other) { (void)other; }
     virtual void OnCollisionStay(entt::entity other) { (void)other; }
     virtual void OnCollisionExit(entt::entity other) { (void)other; }
@@ -77,11 +106,17 @@ protected:
     virtual void OnStart() {}
     virtual void OnUpdate(float deltaTime) { (void)deltaTime; }
     virtual void OnFixedUpdate(float fixedDeltaTime) { (void)fixedDeltaTime; }
+    virtual void OnParallelUpdate(float deltaTime) { (void)deltaTime; }
     virtual void OnDestroy() {}
 
 private:
+    [[nodiscard]] std::shared_ptr<void> GetCoroutineOwner();
+
     bool m_Initialized{false};
     bool m_Started{false};
+    // Stand-in owner for scripts that are not held by a shared_ptr; it dies with the script.
+    std::shared_ptr<bool> m_CoroutineOwner;
+    ComponentCache m_ComponentCache;
 };
 
 } // namespace PiiXeL
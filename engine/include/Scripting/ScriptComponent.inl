@@ -2,22 +2,31 @@
 #define PIIXELENGINE_SCRIPTCOMPONENT_INL
 
 #include "Scene/Scene.hpp"
+#include "Scripting/ScriptCommandBuffer.hpp"
 
 namespace PiiXeL {
 
 template<typename T>
 T* ScriptComponent::GetComponent() {
     if (m_Scene && m_Entity != entt::null) {
-        entt::registry& registry = m_Scene->GetRegistry();
-        if (registry.all_of<T>(m_Entity)) {
-            return &registry.get<T>(m_Entity);
-        }
+        return m_ComponentCache.Get<T>(m_Scene->GetRegistry(), m_Entity);
     }
     return nullptr;
 }
 
 template<typename T>
 T* ScriptComponent::AddComponent() {
+    if (ScriptCommandBuffer* commands = ScriptCommandBuffer::GetCurrent()) {
+        entt::entity entity = m_Entity;
+        commands->Record([entity](Scene& scene) {
+            entt::registry& registry = scene.GetRegistry();
+            if (registry.valid(entity) && !registry.all_of<T>(entity)) {
+                registry.emplace<T>(entity);
+            }
+        });
+        return nullptr;
+    }
+
     if (m_Scene && m_Entity != entt::null) {
         entt::registry& registry = m_Scene->GetRegistry();
         if (!registry.all_of<T>(m_Entity)) {
@@ -30,6 +39,17 @@ T* ScriptComponent::AddComponent() {
 
 template<typename T>
 void ScriptComponent::RemoveComponent() {
+    if (ScriptCommandBuffer* commands = ScriptCommandBuffer::GetCurrent()) {
+        entt::entity entity = m_Entity;
+        commands->Record([entity](Scene& scene) {
+            entt::registry& registry = scene.GetRegistry();
+            if (registry.valid(entity) && registry.all_of<T>(entity)) {
+                registry.remove<T>(entity);
+            }
+        });
+        return;
+    }
+
     if (m_Scene && m_Entity != entt::null) {
         entt::registry& registry = m_Scene->GetRegistry();
         if (registry.all_of<T>(m_Entity)) {
@@ -20,46 +20,31 @@ std::optional<typename ComponentHandle<Component>::Type> ScriptComponent::GetHan
 
 template<>
 inline std::optional<RigidBodyHandle> ScriptComponent::GetHandle<RigidBody2D>() {
-    if (!m_Scene || m_Entity == entt::null) {
+    RigidBody2D* rb = GetComponent<RigidBody2D>();
+    if (!rb) {
         return std::nullopt;
     }
 
-    entt::registry& registry = m_Scene->GetRegistry();
-    if (!registry.all_of<RigidBody2D>(m_Entity)) {
-        return std::nullopt;
-    }
-
-    RigidBody2D* rb = &registry.get<RigidBody2D>(m_Entity);
     return RigidBodyHandle{m_Scene, m_Entity, rb};
 }
 
 template<>
 inline std::optional<AnimatorHandle> ScriptComponent::GetHandle<Animator>() {
-    if (!m_Scene || m_Entity == entt::null) {
+    Animator* animator = GetComponent<Animator>();
+    if (!animator) {
         return std::nullopt;
     }
 
-    entt::registry& registry = m_Scene->GetRegistry();
-    if (!registry.all_of<Animator>(m_Entity)) {
-        return std::nullopt;
-    }
-
-    Animator* animator = &registry.get<Animator>(m_Entity);
     return AnimatorHandle{m_Scene, m_Entity, animator};
 }
 
 template<>
 inline std::optional<AudioSourceHandle> ScriptComponent::GetHandle<AudioSource>() {
-    if (!m_Scene || m_Entity == entt::null) {
-        return std::nullopt;
-    }
-
-    entt::registry& registry = m_Scene->GetRegistry();
-    if (!registry.all_of<AudioSource>(m_Entity)) {
+    AudioSource* audioSource = GetComponent<AudioSource>();
+    if (!audioSource) {
         return std::nullopt;
     }
 
-    AudioSource* audioSource = &registry.get<AudioSource>(m_Entity);
     return AudioSourceHandle{m_Scene, m_Entity, audioSource};
 }
 
@@ -0,0 +1,114 @@
+#ifndef PIIXELENGINE_SCRIPTPOOL_HPP
+#define PIIXELENGINE_SCRIPTPOOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace PiiXeL {
+
+// Fixed-size slab pool with one instance per pooled type; released blocks go on an intrusive free list.
+template <typename T>
+class ScriptSlabPool {
+public:
+    static constexpr size_t BlocksPerSlab{64};
+
+    ScriptSlabPool(const ScriptSlabPool&) = delete;
+    ScriptSlabPool& operator=(const ScriptSlabPool&) = delete;
+
+    // Never destroyed: scripts held by other statics or by scenes torn down during exit would otherwise hand their
+    // blocks back to a pool whose slabs are already gone.
+    static ScriptSlabPool& Instance() {
+        static ScriptSlabPool* instance = new ScriptSlabPool();
+        return *instance;
+    }
+
+    void* Allocate() {
+        std::lock_guard<std::mutex> lock{m_Mutex};
+        if (!m_FreeList) {
+            AddSlab();
+        }
+
+        Block* block = m_FreeList;
+        m_FreeList = block->next;
+        ++m_LiveCount;
+        return block->storage;
+    }
+
+    void Deallocate(void* ptr) {
+        std::lock_guard<std::mutex> lock{m_Mutex};
+        Block* block = static_cast<Block*>(ptr);
+        block->next = m_FreeList;
+        m_FreeList = block;
+        --m_LiveCount;
+    }
+
+    [[nodiscard]] size_t GetLiveCount() const { return m_LiveCount; }
+    [[nodiscard]] size_t GetCapacity() const { return m_Slabs.size() * BlocksPerSlab; }
+
+private:
+    union Block {
+        Block* next;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    ScriptSlabPool() = default;
+    ~ScriptSlabPool() = default;
+
+    void AddSlab() {
+        std::unique_ptr<Block[]>& slab = m_Slabs.emplace_back(std::make_unique<Block[]>(BlocksPerSlab));
+        for (size_t i = BlocksPerSlab; i > 0; --i) {
+            slab[i - 1].next = m_FreeList;
+            m_FreeList = &slab[i - 1];
+        }
+    }
+
+    std::vector<std::unique_ptr<Block[]>> m_Slabs;
+    Block* m_FreeList{nullptr};
+    size_t m_LiveCount{0};
+    std::mutex m_Mutex;
+};
+
+// Stateless allocator for std::allocate_shared. The rebound type is the shared_ptr control block with the
+// script embedded, so every script type gets its own slab pool and a single allocation per instance.
+template <typename T>
+class ScriptPoolAllocator {
+public:
+    using value_type = T;
+
+    ScriptPoolAllocator() = default;
+    template <typename U>
+    ScriptPoolAllocator(const ScriptPoolAllocator<U>&) noexcept {}
+
+    T* allocate(size_t count) {
+        if (count != 1) {
+            return std::allocator<T>{}.allocate(count);
+        }
+        return static_cast<T*>(ScriptSlabPool<T>::Instance().Allocate());
+    }
+
+    void deallocate(T* ptr, size_t count) {
+        if (count != 1) {
+            std::allocator<T>{}.deallocate(ptr, count);
+            return;
+        }
+        ScriptSlabPool<T>::Instance().Deallocate(ptr);
+    }
+
+    template <typename U>
+    bool operator==(const ScriptPoolAllocator<U>&) const noexcept {
+        return true;
+    }
+};
+
+// Scripts stay behind std::shared_ptr rather than an index/generation handle: coroutines lock the script through
+// weak_from_this() while they resume, and editor and prefab code hand instances around by shared_ptr.
+template <typename T>
+std::shared_ptr<T> CreatePooledScript() {
+    return std::allocate_shared<T>(ScriptPoolAllocator<T>{});
+}
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_SCRIPTPOOL_HPP
@@ -1,6 +1,8 @@
 #ifndef PIIXELENGINE_SCRIPTREGISTRY_HPP
 #define PIIXELENGINE_SCRIPTREGISTRY_HPP
 
+#include "Scripting/ScriptPool.hpp"
+
 #include <functional>
 #include <memory>
 #include <string>
@@ -33,7 +35,9 @@ private:
         ClassName##Registrar() {                                                                                       \
             PiiXeL::ScriptRegistry::Instance().RegisterScript(                                                         \
                 #ClassName,                                                                                            \
-                []() -> std::shared_ptr<PiiXeL::ScriptComponent> { return std::make_shared<ClassName>(); });           \
+                []() -> std::shared_ptr<PiiXeL::ScriptComponent> {                                                     \
+                    return PiiXeL::CreatePooledScript<ClassName>();                                                    \
+                });                                                                                                    \
         }                                                                                                              \
     };                                                                                                                 \
     static ClassName##Registrar g_##ClassName##Registrar;                                                              \
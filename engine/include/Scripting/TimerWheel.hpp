@@ -0,0 +1,149 @@
+#ifndef PIIXELENGINE_TIMERWHEEL_HPP
+#define PIIXELENGINE_TIMERWHEEL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PiiXeL {
+
+// Hierarchical timer wheel: scheduling is O(1) and an idle timer is never touched until its slot comes due.
+class TimerWheel {
+public:
+    static constexpr uint32_t SlotBits{6};
+    static constexpr uint32_t SlotCount{1u << SlotBits};
+    static constexpr uint32_t LevelCount{4};
+
+    TimerWheel() { Clear(); }
+
+    void Schedule(uint64_t deadline, uint64_t value) {
+        uint32_t node = AllocateNode();
+        m_Nodes[node].deadline = deadline > m_Now ? deadline : m_Now + 1;
+        m_Nodes[node].value = value;
+        Insert(node);
+        ++m_Count;
+    }
+
+    // Advances the wheel tick by tick and calls onExpire(value) for every timer whose deadline is reached.
+    template <typename Callback>
+    void Advance(uint64_t ticks, Callback&& onExpire) {
+        for (uint64_t i = 0; i < ticks; ++i) {
+            ++m_Now;
+            Cascade();
+
+            uint32_t slot = static_cast<uint32_t>(m_Now & (SlotCount - 1));
+            uint32_t node = m_Slots[0][slot];
+            m_Slots[0][slot] = InvalidNode;
+
+            while (node != InvalidNode) {
+                uint32_t next = m_Nodes[node].next;
+                if (m_Nodes[node].deadline <= m_Now) {
+                    uint64_t value = m_Nodes[node].value;
+                    FreeNode(node);
+                    --m_Count;
+                    onExpire(value);
+                }
+                else {
+                    Insert(node);
+                }
+                node = next;
+            }
+        }
+    }
+
+    void Clear() {
+        m_Nodes.clear();
+        m_Overflow = InvalidNode;
+        m_FreeList = InvalidNode;
+        m_Count = 0;
+        for (std::array<uint32_t, SlotCount>& level : m_Slots) {
+            level.fill(InvalidNode);
+        }
+    }
+
+    [[nodiscard]] uint64_t GetNow() const { return m_Now; }
+    [[nodiscard]] size_t GetCount() const { return m_Count; }
+
+private:
+    static constexpr uint32_t InvalidNode{UINT32_MAX};
+
+    struct Node {
+        uint64_t deadline{0};
+        uint64_t value{0};
+        uint32_t next{InvalidNode};
+    };
+
+    // A timer sits on the lowest level whose parent block it shares with the current tick, so it is
+    // cascaded down exactly when the wheel enters its block.
+    void Insert(uint32_t node) {
+        uint64_t deadline = m_Nodes[node].deadline > m_Now ? m_Nodes[node].deadline : m_Now;
+
+        for (uint32_t level = 0; level < LevelCount; ++level) {
+            uint32_t shift = SlotBits * (level + 1);
+            if ((deadline >> shift) == (m_Now >> shift)) {
+                uint32_t slot = static_cast<uint32_t>((deadline >> (SlotBits * level)) & (SlotCount - 1));
+                m_Nodes[node].next = m_Slots[level][slot];
+                m_Slots[level][slot] = node;
+                return;
+            }
+        }
+
+        m_Nodes[node].next = m_Overflow;
+        m_Overflow = node;
+    }
+
+    void Cascade() {
+        uint32_t topLevel = 0;
+        while (topLevel < LevelCount && ((m_Now >> (SlotBits * (topLevel + 1))) << (SlotBits * (topLevel + 1))) == m_Now) {
+            ++topLevel;
+        }
+
+        if (topLevel == LevelCount) {
+            Reinsert(m_Overflow);
+            m_Overflow = InvalidNode;
+            topLevel = LevelCount - 1;
+        }
+
+        for (uint32_t level = topLevel; level > 0; --level) {
+            uint32_t slot = static_cast<uint32_t>((m_Now >> (SlotBits * level)) & (SlotCount - 1));
+            uint32_t node = m_Slots[level][slot];
+            m_Slots[level][slot] = InvalidNode;
+            Reinsert(node);
+        }
+    }
+
+    void Reinsert(uint32_t node) {
+        while (node != InvalidNode) {
+            uint32_t next = m_Nodes[node].next;
+            Insert(node);
+            node = next;
+        }
+    }
+
+    uint32_t AllocateNode() {
+        if (m_FreeList != InvalidNode) {
+            uint32_t node = m_FreeList;
+            m_FreeList = m_Nodes[node].next;
+            return node;
+        }
+        m_Nodes.emplace_back();
+        return static_cast<uint32_t>(m_Nodes.size() - 1);
+    }
+
+    void FreeNode(uint32_t node) {
+        m_Nodes[node].next = m_FreeList;
+        m_FreeList = node;
+    }
+
+    std::vector<Node> m_Nodes;
+    std::array<std::array<uint32_t, SlotCount>, LevelCount> m_Slots{};
+    uint32_t m_Overflow{InvalidNode};
+    uint32_t m_FreeList{InvalidNode};
+    uint64_t m_Now{0};
+    size_t m_Count{0};
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_TIMERWHEEL_HPP
@@ -1,13 +1,23 @@
 #ifndef PIIXELENGINE_AUDIOSYSTEM_HPP
 #define PIIXELENGINE_AUDIOSYSTEM_HPP
 
+#include "Audio/AudioBackend.hpp"
+#include "Audio/AudioBusGraph.hpp"
+#include "Audio/AudioVoicePool.hpp"
+
 #include <entt/entt.hpp>
 
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <raylib.h>
+#include <vector>
 
 namespace PiiXeL {
 
+class AudioAsset;
 class Scene;
+struct AudioSource;
 
 class AudioSystem {
 public:
@@ -26,18 +36,60 @@ public:
     void StopAllSources(entt::registry& registry);
 
     static void ResetAudioSources(entt::registry& registry);
+    static void PreloadClips(const std::vector<UUID>& clips);
 
     void SetMasterVolume(float volume);
     [[nodiscard]] float GetMasterVolume() const { return m_MasterVolume; }
 
+    void SetMaxVoices(uint32_t maxVoices);
+    [[nodiscard]] uint32_t GetMaxVoices() const { return m_MaxVoices; }
+    [[nodiscard]] uint32_t GetActiveVoiceCount() const { return m_VoicePool.GetActiveVoiceCount(); }
+
+    void SetBusGain(AudioBus bus, float gain);
+    [[nodiscard]] float GetBusGain(AudioBus bus) const;
+    void SetBusDucking(AudioBus target, AudioBus trigger, float amount);
+    void SetBusParent(AudioBus bus, AudioBus parent);
+    [[nodiscard]] AudioBus GetBusParent(AudioBus bus) const { return m_BusGraph.GetParent(bus); }
+
+    void SetBackendType(AudioBackendType type);
+    [[nodiscard]] AudioBackendType GetBackendType() const { return m_BackendType; }
+    [[nodiscard]] AudioBackend* GetBackend() const { return m_Backend.get(); }
+
 private:
-    void UpdateSources(entt::registry& registry);
+    struct BusDucking {
+        AudioBus trigger{AudioBus::Master};
+        float amount{0.0f};
+    };
+
+    void UpdateSources(float deltaTime, entt::registry& registry);
     void UpdateListener(entt::registry& registry);
     void UpdateSpatialAudio(entt::registry& registry);
 
+    static void UpdatePendingSource(AudioSource& source);
+    void UpdateStreamingSource(AudioSource& source, AudioAsset& stream);
+    void StartStream(AudioSource& source, AudioAsset& stream);
+    // A voice that cannot get a pool slot goes virtual at startPosition and keeps its place from there.
+    void StartVoice(entt::registry& registry, entt::entity entity, AudioSource& source, const AudioAsset& clip,
+                    float startPosition = 0.0f);
+    void AdvanceVirtual(entt::registry& registry, entt::entity entity, AudioSource& source, const AudioAsset& clip,
+                        float deltaTime);
+    [[nodiscard]] float ComputeAudibility(entt::registry& registry, entt::entity entity,
+                                          const AudioSource& source) const;
+
+    static float ComputeAttenuation(const AudioSource& source, Vector2 sourcePos, Vector2 listenerPos);
+    static AudioAsset* ResolveClip(AudioSource& source);
+
 private:
     Scene* m_Scene{nullptr};
     entt::entity m_ListenerEntity{entt::null};
+    std::unique_ptr<AudioBackend> m_Backend;
+    AudioBackendType m_BackendType{AudioBackendType::Device};
+    AudioVoicePool m_VoicePool;
+    uint32_t m_MaxVoices{AudioVoicePool::DefaultMaxVoices};
+    uint32_t m_UnloadListenerId{0};
+    std::array<float, static_cast<size_t>(AudioBus::Count)> m_BusGains{1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+    std::array<BusDucking, static_cast<size_t>(AudioBus::Count)> m_BusDucking{};
+    AudioBusGraph m_BusGraph;
     float m_MasterVolume{1.0f};
     bool m_IsInitialized{false};
 };
@@ -25,6 +25,7 @@ public:
     [[nodiscard]] b2WorldId GetWorldId() const { return m_WorldId; }
 
     void CreateBody(entt::registry& registry, entt::entity entity);
+    void DestroyBody(entt::registry& registry, entt::entity entity);
     void DestroyAllBodies(entt::registry& registry);
 
     void SetGravity(const Vector2& gravity);
@@ -3,14 +3,52 @@
 
 #include <entt/entt.hpp>
 
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace PiiXeL {
 
 class Scene;
+class ScriptCommandBuffer;
 class ScriptComponent;
 
+// Active scripts of one concrete type, stored contiguously so they are updated back to back.
+struct ScriptBatch {
+    std::type_index type{typeid(void)};
+    std::string name;
+    uint32_t profileSlot{std::numeric_limits<uint32_t>::max()};
+    std::vector<std::shared_ptr<ScriptComponent>> scripts;
+};
+
+// Lives in the registry context so it shares the registry's lifetime. Script signals mark it dirty and record the
+// entity, so scripts removed after the last activation pass are recognised without waiting for the rebuild.
+struct ScriptBatchCache {
+    std::vector<ScriptBatch> batches;
+    std::unordered_map<std::type_index, size_t> batchIndices;
+
+    // Scripts opted into OnParallelUpdate, grouped by entity; chunk boundaries never split an entity.
+    std::vector<std::shared_ptr<ScriptComponent>> parallelScripts;
+    std::vector<size_t> parallelChunks;
+
+    std::unordered_set<entt::entity> changedEntities;
+    bool dirty{true};
+
+    void MarkDirty(entt::registry& registry, entt::entity entity) {
+        (void)registry;
+        changedEntities.insert(entity);
+        dirty = true;
+    }
+
+    // False once the script's entity is gone or its Script component no longer holds this instance.
+    [[nodiscard]] bool IsLive(const entt::registry& registry, const ScriptComponent& script) const;
+};
+
 class ScriptSystem {
 public:
     ScriptSystem();
@@ -20,6 +58,13 @@ public:
     void OnFixedUpdate(Scene* scene, float fixedDeltaTime);
 
     std::shared_ptr<ScriptComponent> CreateScript(const std::string& name);
+
+private:
+    ScriptBatchCache& PrepareBatches(Scene* scene);
+    void ActivateScripts(Scene* scene, ScriptBatchCache& cache);
+    void RunParallelUpdate(Scene* scene, ScriptBatchCache& cache, float deltaTime);
+
+    std::vector<ScriptCommandBuffer> m_CommandBuffers;
 };
 
 } // namespace PiiXeL
@@ -0,0 +1,133 @@
+#ifndef PIIXELENGINE_SYSTEMSCHEDULER_HPP
+#define PIIXELENGINE_SYSTEMSCHEDULER_HPP
+
+#include <entt/entt.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace PiiXeL {
+
+// What a system touches during its update. Components are registry storages; resources are any other shared
+// state (a system object, the asset registry) named by its type. Two systems conflict when one of them writes
+// something the other reads or writes, or when either of them is exclusive.
+class SystemAccess {
+public:
+    template <typename... Components>
+    SystemAccess& Read() {
+        (AddComponent<Components>(m_Reads), ...);
+        return *this;
+    }
+
+    template <typename... Components>
+    SystemAccess& Write() {
+        (AddComponent<Components>(m_Writes), ...);
+        return *this;
+    }
+
+    template <typename... Resources>
+    SystemAccess& ReadResource() {
+        (m_Reads.push_back(entt::type_hash<Resources>::value()), ...);
+        return *this;
+    }
+
+    template <typename... Resources>
+    SystemAccess& WriteResource() {
+        (m_Writes.push_back(entt::type_hash<Resources>::value()), ...);
+        return *this;
+    }
+
+    // Conflicts with every other system, for updates that can reach anything (script callbacks, event dispatch).
+    // Exclusive systems run on the main thread.
+    SystemAccess& Exclusive() {
+        m_Exclusive = true;
+        return *this;
+    }
+
+    // Runs on the thread calling SystemScheduler::Run, for systems that call into raylib.
+    SystemAccess& MainThread() {
+        m_MainThread = true;
+        return *this;
+    }
+
+    [[nodiscard]] bool ConflictsWith(const SystemAccess& other) const;
+    [[nodiscard]] bool IsExclusive() const { return m_Exclusive; }
+    [[nodiscard]] bool IsMainThread() const { return m_MainThread || m_Exclusive; }
+
+    // Creates the storages of the declared components up front; entt creates them lazily, which is not safe while
+    // other systems use the registry.
+    void PrepareStorages(entt::registry& registry) const;
+
+private:
+    template <typename Component>
+    void AddComponent(std::vector<entt::id_type>& ids) {
+        ids.push_back(entt::type_hash<Component>::value());
+        m_Storages.push_back(+[](entt::registry& registry) { registry.storage<Component>(); });
+    }
+
+    std::vector<entt::id_type> m_Reads;
+    std::vector<entt::id_type> m_Writes;
+    std::vector<void (*)(entt::registry&)> m_Storages;
+    bool m_Exclusive{false};
+    bool m_MainThread{false};
+};
+
+// Runs the per-frame systems as a task graph. Each system depends on every earlier-registered system it conflicts
+// with, so conflicting systems always run in registration order and a parallel run produces the same result as a
+// serial one; systems that don't conflict run at the same time as jobs on the JobSystem workers and on the calling
+// thread.
+// Systems must declare everything they touch and must not create or destroy entities or add or remove components.
+class SystemScheduler {
+public:
+    using SystemFunction = std::function<void(float deltaTime)>;
+
+    SystemScheduler() = default;
+
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    void AddSystem(const std::string& name, const SystemAccess& access, SystemFunction function);
+
+    // Runs every system once. Serial mode, or a JobSystem without workers, runs them one after another in
+    // registration order on the calling thread.
+    void Run(entt::registry& registry, float deltaTime);
+
+    void SetParallel(bool parallel) { m_Parallel = parallel; }
+    [[nodiscard]] bool IsParallel() const { return m_Parallel; }
+    [[nodiscard]] size_t GetSystemCount() const { return m_Systems.size(); }
+
+private:
+    struct System {
+        std::string name;
+        SystemAccess access;
+        SystemFunction function;
+        std::vector<size_t> dependents;
+        uint32_t dependencyCount{0};
+    };
+
+    void RunParallel(entt::registry& registry, float deltaTime);
+    void Dispatch(size_t index);
+    void Execute(size_t index, uint32_t threadIndex);
+    void Complete(size_t index);
+
+    std::vector<System> m_Systems;
+    bool m_Parallel{true};
+
+    std::mutex m_Mutex;
+    std::condition_variable m_WorkReady;
+    // Main-thread systems whose dependencies have finished; the others are scheduled as jobs right away.
+    std::deque<size_t> m_MainReady;
+    std::vector<uint32_t> m_PendingDependencies;
+    size_t m_Remaining{0};
+    float m_DeltaTime{0.0f};
+    bool m_Profiling{false};
+};
+
+} // namespace PiiXeL
+
+#endif // PIIXELENGINE_SYSTEMSCHEDULER_HPP
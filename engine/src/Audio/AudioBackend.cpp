@@ -0,0 +1,33 @@
+#include "Audio/AudioBackend.hpp"
+
+#include "Audio/DeviceAudioBackend.hpp"
+#include "Audio/MixerAudioBackend.hpp"
+#include "Audio/OfflineAudioBackend.hpp"
+
+namespace PiiXeL {
+
+std::unique_ptr<AudioBackend> AudioBackend::Create(AudioBackendType type) {
+    switch (type) {
+        case AudioBackendType::Offline:
+            return std::make_unique<OfflineAudioBackend>();
+        case AudioBackendType::Mixer:
+            return std::make_unique<MixerAudioBackend>();
+        case AudioBackendType::Device:
+        default:
+            return std::make_unique<DeviceAudioBackend>();
+    }
+}
+
+const char* AudioBackend::GetTypeName(AudioBackendType type) {
+    switch (type) {
+        case AudioBackendType::Offline:
+            return "Offline";
+        case AudioBackendType::Mixer:
+            return "Mixer";
+        case AudioBackendType::Device:
+        default:
+            return "Device";
+    }
+}
+
+} // namespace PiiXeL
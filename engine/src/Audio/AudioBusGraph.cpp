@@ -0,0 +1,58 @@
+#include "Audio/AudioBusGraph.hpp"
+
+#include <algorithm>
+
+namespace PiiXeL {
+
+AudioBusGraph::AudioBusGraph() {
+    m_Parents.fill(AudioBus::Master);
+    m_Parents[static_cast<size_t>(AudioBus::Ambience)] = AudioBus::Sfx;
+    RebuildMixOrder();
+}
+
+bool AudioBusGraph::SetParent(AudioBus bus, AudioBus parent) {
+    if (bus == AudioBus::Master || bus >= AudioBus::Count || parent >= AudioBus::Count || IsWithin(parent, bus)) {
+        return false;
+    }
+
+    m_Parents[static_cast<size_t>(bus)] = parent;
+    RebuildMixOrder();
+    return true;
+}
+
+AudioBus AudioBusGraph::GetParent(AudioBus bus) const {
+    return bus < AudioBus::Count ? m_Parents[static_cast<size_t>(bus)] : AudioBus::Master;
+}
+
+bool AudioBusGraph::IsWithin(AudioBus bus, AudioBus ancestor) const {
+    for (uint32_t depth = 0; depth < BusCount; ++depth) {
+        if (bus == ancestor) {
+            return true;
+        }
+        if (bus == AudioBus::Master || bus >= AudioBus::Count) {
+            return false;
+        }
+        bus = m_Parents[static_cast<size_t>(bus)];
+    }
+    return false;
+}
+
+void AudioBusGraph::RebuildMixOrder() {
+    std::array<uint32_t, BusCount> depths{};
+    for (uint32_t bus = 1; bus < BusCount; ++bus) {
+        AudioBus current = static_cast<AudioBus>(bus);
+        while (current != AudioBus::Master && depths[bus] < BusCount) {
+            current = m_Parents[static_cast<size_t>(current)];
+            ++depths[bus];
+        }
+    }
+
+    for (uint32_t i = 0; i < BusCount - 1; ++i) {
+        m_MixOrder[i] = static_cast<AudioBus>(i + 1);
+    }
+    std::stable_sort(m_MixOrder.begin(), m_MixOrder.end(), [&depths](AudioBus a, AudioBus b) {
+        return depths[static_cast<size_t>(a)] > depths[static_cast<size_t>(b)];
+    });
+}
+
+} // namespace PiiXeL
@@ -0,0 +1,35 @@
+#include "Audio/AudioCommandQueue.hpp"
+
+namespace PiiXeL {
+
+bool AudioCommandQueue::Push(const AudioCommand& command) {
+    size_t tail = m_Tail.load(std::memory_order_relaxed);
+    if (tail - m_Head.load(std::memory_order_acquire) >= Capacity) {
+        return false;
+    }
+
+    m_Buffer[tail & (Capacity - 1)] = command;
+    m_Tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool AudioCommandQueue::Pop(AudioCommand& command) {
+    size_t head = m_Head.load(std::memory_order_relaxed);
+    if (head == m_Tail.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    command = m_Buffer[head & (Capacity - 1)];
+    m_Head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+void AudioCommandQueue::Clear() {
+    m_Head.store(m_Tail.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+bool AudioCommandQueue::IsEmpty() const {
+    return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire);
+}
+
+} // namespace PiiXeL
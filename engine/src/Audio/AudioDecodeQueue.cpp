@@ -0,0 +1,177 @@
+#include "Audio/AudioDecodeQueue.hpp"
+
+#include "Core/JobSystem.hpp"
+#include "Core/Logger.hpp"
+#include "Resources/AssetPackage.hpp"
+#include "Resources/AudioAsset.hpp"
+
+#include <cinttypes>
+
+namespace PiiXeL {
+
+namespace {
+constexpr auto FirstRetryDelay = std::chrono::milliseconds{250};
+} // namespace
+
+AudioDecodeQueue& AudioDecodeQueue::Instance() {
+    static AudioDecodeQueue instance{};
+    return instance;
+}
+
+void AudioDecodeQueue::Request(UUID uuid) {
+    if (uuid.Get() == 0) {
+        return;
+    }
+
+    {
+        // Clips that failed before are re-queued by Update() once their backoff runs out.
+        std::lock_guard<std::mutex> lock{m_Mutex};
+        if (m_Pending.count(uuid) > 0 || m_Failures.count(uuid) > 0) {
+            return;
+        }
+    }
+
+    Enqueue(uuid);
+}
+
+void AudioDecodeQueue::Enqueue(UUID uuid) {
+    Job job{};
+    job.uuid = uuid;
+    job.pcmSampleRate = AudioAsset::GetPcmSampleRate();
+
+    if (!AssetRegistry::Instance().GetAssetSource(uuid, job.source)) {
+        PX_LOG_WARNING(ASSET, "Audio asset not found in registry: %" PRIu64, uuid.Get());
+        std::lock_guard<std::mutex> lock{m_Mutex};
+        RecordFailure(uuid);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{m_Mutex};
+        job.epoch = m_Epoch;
+        m_Pending.insert(uuid);
+    }
+
+    JobSystem::Instance().Schedule([this, job = std::move(job)]() { Run(job); });
+}
+
+void AudioDecodeQueue::Update() {
+    std::vector<Result> completed{};
+    std::vector<UUID> retries{};
+    {
+        std::lock_guard<std::mutex> lock{m_Mutex};
+        completed.swap(m_Completed);
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        for (const auto& [uuid, failure] : m_Failures) {
+            if (failure.attempts < MaxAttempts && failure.retryAt <= now && m_Pending.count(uuid) == 0) {
+                retries.push_back(uuid);
+            }
+        }
+    }
+
+    AssetRegistry& registry = AssetRegistry::Instance();
+    for (Result& result : completed) {
+        bool loaded = result.asset && result.asset->FinishLoad();
+        if (loaded && !registry.AddLoadedAsset(result.asset)) {
+            result.asset->Unload();
+        }
+
+        std::lock_guard<std::mutex> lock{m_Mutex};
+        m_Pending.erase(result.uuid);
+        if (loaded) {
+            m_Failures.erase(result.uuid);
+        }
+        else {
+            RecordFailure(result.uuid);
+        }
+    }
+
+    for (UUID uuid : retries) {
+        if (registry.IsAssetLoaded(uuid)) {
+            std::lock_guard<std::mutex> lock{m_Mutex};
+            m_Failures.erase(uuid);
+            continue;
+        }
+        Enqueue(uuid);
+    }
+}
+
+void AudioDecodeQueue::RecordFailure(UUID uuid) {
+    Failure& failure = m_Failures[uuid];
+    ++failure.attempts;
+    if (failure.attempts >= MaxAttempts) {
+        PX_LOG_ERROR(ASSET, "Giving up on audio clip %" PRIu64 " after %u failed decodes", uuid.Get(),
+                     failure.attempts);
+        return;
+    }
+
+    std::chrono::milliseconds delay = FirstRetryDelay * (1 << (failure.attempts - 1));
+    failure.retryAt = std::chrono::steady_clock::now() + delay;
+    PX_LOG_WARNING(ASSET, "Audio clip %" PRIu64 " failed to decode, retrying in %lld ms", uuid.Get(),
+                   static_cast<long long>(delay.count()));
+}
+
+void AudioDecodeQueue::Clear() {
+    std::lock_guard<std::mutex> lock{m_Mutex};
+    ++m_Epoch;
+    m_Pending.clear();
+    m_Failures.clear();
+    m_Completed.clear();
+}
+
+bool AudioDecodeQueue::IsPending(UUID uuid) const {
+    std::lock_guard<std::mutex> lock{m_Mutex};
+    if (m_Pending.count(uuid) > 0) {
+        return true;
+    }
+
+    auto it = m_Failures.find(uuid);
+    return it != m_Failures.end() && it->second.attempts < MaxAttempts;
+}
+
+bool AudioDecodeQueue::HasFailed(UUID uuid) const {
+    std::lock_guard<std::mutex> lock{m_Mutex};
+    auto it = m_Failures.find(uuid);
+    return it != m_Failures.end() && it->second.attempts >= MaxAttempts;
+}
+
+size_t AudioDecodeQueue::GetPendingCount() const {
+    std::lock_guard<std::mutex> lock{m_Mutex};
+    return m_Pending.size();
+}
+
+void AudioDecodeQueue::Run(const Job& job) {
+    std::shared_ptr<AudioAsset> asset = Decode(job);
+
+    std::lock_guard<std::mutex> lock{m_Mutex};
+    if (job.epoch == m_Epoch) {
+        m_Completed.push_back(Result{job.uuid, std::move(asset)});
+    }
+}
+
+std::shared_ptr<AudioAsset> AudioDecodeQueue::Decode(const Job& job) {
+    AssetMetadata metadata{};
+    std::vector<uint8_t> data{};
+
+    AssetPackage package{};
+    bool read = job.source.packageData.empty()
+                    ? package.LoadFromFile(job.source.packagePath, metadata, data)
+                    : package.LoadFromMemory(job.source.packageData.data(), job.source.packageData.size(), metadata,
+                                             data);
+    if (!read || metadata.type != AssetType::Audio) {
+        PX_LOG_ERROR(ASSET, "Failed to read audio package: %s", job.source.sourcePath.c_str());
+        return nullptr;
+    }
+
+    std::shared_ptr<AudioAsset> asset = std::make_shared<AudioAsset>(metadata.uuid, metadata.name);
+    metadata.sourceFile = job.source.sourcePath;
+    asset->SetMetadata(metadata);
+
+    if (!asset->Decode(data.data(), data.size(), job.pcmSampleRate)) {
+        return nullptr;
+    }
+    return asset;
+}
+
+} // namespace PiiXeL
@@ -0,0 +1,170 @@
+#include "Audio/AudioMixKernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PX_AUDIO_SSE2 1
+#include <emmintrin.h>
+#else
+#define PX_AUDIO_SSE2 0
+#endif
+
+namespace PiiXeL::AudioMixKernels {
+
+uint32_t ResampleAdd(float* output, uint32_t frameCount, const float* source, size_t sourceFrames, double& cursor,
+                     double step, StereoGain from, StereoGain to) {
+    if (sourceFrames == 0 || frameCount == 0) {
+        return 0;
+    }
+
+    float invFrames = 1.0f / static_cast<float>(frameCount);
+    float stepLeft = (to.left - from.left) * invFrames;
+    float stepRight = (to.right - from.right) * invFrames;
+    size_t lastFrame = sourceFrames - 1;
+    uint32_t i = 0;
+
+#if PX_AUDIO_SSE2
+    __m128 gain = _mm_setr_ps(from.left, from.right, from.left + stepLeft, from.right + stepRight);
+    __m128 gainStep = _mm_setr_ps(stepLeft * 2.0f, stepRight * 2.0f, stepLeft * 2.0f, stepRight * 2.0f);
+
+    for (; i + 1 < frameCount; i += 2) {
+        double nextCursor = cursor + step;
+        size_t index0 = static_cast<size_t>(cursor);
+        size_t index1 = static_cast<size_t>(nextCursor);
+        if (index1 >= lastFrame) {
+            break;
+        }
+
+        float fraction0 = static_cast<float>(cursor - static_cast<double>(index0));
+        float fraction1 = static_cast<float>(nextCursor - static_cast<double>(index1));
+
+        const float* a0 = source + index0 * 2;
+        const float* a1 = source + index1 * 2;
+        __m128 current = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(a0)),
+                                      reinterpret_cast<const __m64*>(a1));
+        __m128 next = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(a0 + 2)),
+                                   reinterpret_cast<const __m64*>(a1 + 2));
+        __m128 fraction = _mm_setr_ps(fraction0, fraction0, fraction1, fraction1);
+        __m128 sample = _mm_add_ps(current, _mm_mul_ps(_mm_sub_ps(next, current), fraction));
+
+        float* out = output + static_cast<size_t>(i) * 2;
+        _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(sample, gain)));
+
+        gain = _mm_add_ps(gain, gainStep);
+        cursor = nextCursor + step;
+    }
+#endif
+
+    for (; i < frameCount; ++i) {
+        size_t index = static_cast<size_t>(cursor);
+        if (index >= sourceFrames) {
+            return i;
+        }
+
+        size_t next = std::min(index + 1, lastFrame);
+        float fraction = static_cast<float>(cursor - static_cast<double>(index));
+        float left = source[index * 2] + (source[next * 2] - source[index * 2]) * fraction;
+        float right = source[index * 2 + 1] + (source[next * 2 + 1] - source[index * 2 + 1]) * fraction;
+
+        float frame = static_cast<float>(i);
+        output[static_cast<size_t>(i) * 2] += left * (from.left + stepLeft * frame);
+        output[static_cast<size_t>(i) * 2 + 1] += right * (from.right + stepRight * frame);
+
+        cursor += step;
+    }
+
+    return frameCount;
+}
+
+void AddScaled(float* output, const float* input, uint32_t frameCount, float from, float to) {
+    float step = frameCount > 0 ? (to - from) / static_cast<float>(frameCount) : 0.0f;
+    uint32_t i = 0;
+
+#if PX_AUDIO_SSE2
+    __m128 gain = _mm_setr_ps(from, from, from + step, from + step);
+    __m128 gainStep = _mm_set1_ps(step * 2.0f);
+    for (; i + 1 < frameCount; i += 2) {
+        size_t offset = static_cast<size_t>(i) * 2;
+        __m128 sample = _mm_mul_ps(_mm_loadu_ps(input + offset), gain);
+        _mm_storeu_ps(output + offset, _mm_add_ps(_mm_loadu_ps(output + offset), sample));
+        gain = _mm_add_ps(gain, gainStep);
+    }
+#endif
+
+    for (; i < frameCount; ++i) {
+        float gain = from + step * static_cast<float>(i);
+        output[static_cast<size_t>(i) * 2] += input[static_cast<size_t>(i) * 2] * gain;
+        output[static_cast<size_t>(i) * 2 + 1] += input[static_cast<size_t>(i) * 2 + 1] * gain;
+    }
+}
+
+void Scale(float* buffer, uint32_t frameCount, float from, float to) {
+    float step = frameCount > 0 ? (to - from) / static_cast<float>(frameCount) : 0.0f;
+    uint32_t i = 0;
+
+#if PX_AUDIO_SSE2
+    __m128 gain = _mm_setr_ps(from, from, from + step, from + step);
+    __m128 gainStep = _mm_set1_ps(step * 2.0f);
+    for (; i + 1 < frameCount; i += 2) {
+        float* out = buffer + static_cast<size_t>(i) * 2;
+        _mm_storeu_ps(out, _mm_mul_ps(_mm_loadu_ps(out), gain));
+        gain = _mm_add_ps(gain, gainStep);
+    }
+#endif
+
+    for (; i < frameCount; ++i) {
+        float gain = from + step * static_cast<float>(i);
+        buffer[static_cast<size_t>(i) * 2] *= gain;
+        buffer[static_cast<size_t>(i) * 2 + 1] *= gain;
+    }
+}
+
+void Clamp(float* buffer, uint32_t frameCount) {
+    size_t count = static_cast<size_t>(frameCount) * 2;
+    size_t i = 0;
+
+#if PX_AUDIO_SSE2
+    __m128 low = _mm_set1_ps(-1.0f);
+    __m128 high = _mm_set1_ps(1.0f);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(buffer + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(buffer + i), low), high));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        buffer[i] = std::clamp(buffer[i], -1.0f, 1.0f);
+    }
+}
+
+float Peak(const float* buffer, uint32_t frameCount) {
+    size_t count = static_cast<size_t>(frameCount) * 2;
+    size_t i = 0;
+    float peak = 0.0f;
+
+#if PX_AUDIO_SSE2
+    __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    __m128 peaks = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        peaks = _mm_max_ps(peaks, _mm_and_ps(_mm_loadu_ps(buffer + i), absMask));
+    }
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, peaks);
+    peak = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+#endif
+
+    for (; i < count; ++i) {
+        peak = std::max(peak, std::fabs(buffer[i]));
+    }
+    return peak;
+}
+
+const char* GetInstructionSet() {
+#if PX_AUDIO_SSE2
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+} // namespace PiiXeL::AudioMixKernels
@@ -0,0 +1,541 @@
+#include "Audio/AudioMixer.hpp"
+
+#include "Core/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace PiiXeL {
+
+namespace {
+constexpr float DuckThreshold{0.01f};
+constexpr float DuckAttackSeconds{0.01f};
+constexpr float DuckReleaseSeconds{0.25f};
+constexpr auto FlushTimeout = std::chrono::milliseconds{200};
+
+static_assert(AudioMixer::OutputRingFrames % AudioMixer::OutputBlockFrames == 0,
+              "The output ring must hold a whole number of blocks");
+
+AudioMixKernels::StereoGain ComputeGain(float volume, float pan) {
+    float left = pan;
+    float right = 1.0f - pan;
+    return AudioMixKernels::StereoGain{volume * 0.5f * left * (3.0f - left * left),
+                                       volume * 0.5f * right * (3.0f - right * right)};
+}
+} // namespace
+
+AudioMixer::~AudioMixer() {
+    Shutdown();
+}
+
+void AudioMixer::Initialize(uint32_t sampleRate, bool threaded) {
+    Shutdown();
+
+    m_SampleRate = sampleRate > 0 ? sampleRate : 1;
+    m_Threaded = threaded;
+
+    m_Controls.assign(MaxVoices, VoiceControl{});
+    m_Voices.assign(MaxVoices, VoiceState{});
+    m_FinishedSerials = std::make_unique<std::atomic<uint32_t>[]>(MaxVoices);
+    m_FreeVoices.clear();
+    for (uint32_t i = MaxVoices; i > 0; --i) {
+        m_FreeVoices.push_back(i - 1);
+    }
+
+    m_Buses.fill(BusState{});
+    m_BusGraph = AudioBusGraph{};
+    m_ControlGraph = AudioBusGraph{};
+    for (std::vector<float>& buffer : m_BusBuffers) {
+        buffer.assign(static_cast<size_t>(MaxBlockFrames) * 2, 0.0f);
+    }
+
+    m_Commands.Clear();
+    m_SubmittedCommands = 0;
+    m_ProcessedCommands.store(0);
+    m_LastMixNanos.store(0);
+    m_PeakMixNanos.store(0);
+    m_TotalMixNanos.store(0);
+    m_RenderedFrames.store(0);
+    m_ActiveVoices.store(0);
+    m_MasterVolume = 1.0f;
+    m_AppliedMasterVolume = 1.0f;
+    m_Underruns.store(0);
+    m_IsInitialized = true;
+
+    if (m_Threaded) {
+        m_OutputRing.assign(static_cast<size_t>(OutputRingFrames) * 2, 0.0f);
+        m_OutputRead.store(0);
+        m_OutputWrite.store(0);
+        m_WakeRequested.store(false);
+        m_StopRequested = false;
+        m_MixThread = std::thread{&AudioMixer::MixThreadMain, this};
+    }
+
+    PX_LOG_INFO(ENGINE, "Audio mixer initialized (%u Hz, %s kernels, %s)", m_SampleRate,
+                AudioMixKernels::GetInstructionSet(), m_Threaded ? "mixer thread" : "inline");
+}
+
+void AudioMixer::Shutdown() {
+    if (!m_IsInitialized) {
+        return;
+    }
+
+    if (m_MixThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock{m_MixMutex};
+            m_StopRequested = true;
+        }
+        m_MixWake.notify_one();
+        m_FlushDone.notify_all();
+        m_MixThread.join();
+    }
+    m_OutputRing.clear();
+
+    m_Commands.Clear();
+    m_Controls.clear();
+    m_Voices.clear();
+    m_FreeVoices.clear();
+    m_FinishedSerials.reset();
+    for (std::vector<float>& buffer : m_BusBuffers) {
+        buffer.clear();
+    }
+    m_IsInitialized = false;
+}
+
+uint32_t AudioMixer::CreateVoice(const float* pcm, uint32_t frameCount) {
+    if (!m_IsInitialized || !pcm || frameCount == 0) {
+        return 0;
+    }
+
+    if (m_FreeVoices.empty()) {
+        PX_LOG_WARNING(ENGINE, "Audio mixer out of voices (%u)", MaxVoices);
+        return 0;
+    }
+
+    uint32_t index = m_FreeVoices.back();
+    m_FreeVoices.pop_back();
+
+    VoiceControl& control = m_Controls[index];
+    control.alive = true;
+    control.playing = false;
+    control.paused = false;
+
+    Submit(AudioCommand{AudioCommandType::CreateVoice, index, 0, 0.0f, pcm, frameCount});
+    return index + 1;
+}
+
+void AudioMixer::DestroyVoice(uint32_t voice) {
+    VoiceControl* control = GetControl(voice);
+    if (!control) {
+        return;
+    }
+
+    control->alive = false;
+    control->playing = false;
+    control->paused = false;
+    m_FreeVoices.push_back(voice - 1);
+    Submit(AudioCommand{AudioCommandType::DestroyVoice, voice - 1});
+}
+
+void AudioMixer::PlayVoice(uint32_t voice) {
+    VoiceControl* control = GetControl(voice);
+    if (!control) {
+        return;
+    }
+
+    ++control->serial;
+    control->playing = true;
+    control->paused = false;
+    Submit(AudioCommand{AudioCommandType::PlayVoice, voice - 1, control->serial});
+}
+
+void AudioMixer::StopVoice(uint32_t voice) {
+    VoiceControl* control = GetControl(voice);
+    if (!control) {
+        return;
+    }
+
+    control->playing = false;
+    control->paused = false;
+    Submit(AudioCommand{AudioCommandType::StopVoice, voice - 1});
+}
+
+void AudioMixer::PauseVoice(uint32_t voice) {
+    if (VoiceControl* control = GetControl(voice)) {
+        control->paused = true;
+        Submit(AudioCommand{AudioCommandType::PauseVoice, voice - 1});
+    }
+}
+
+void AudioMixer::ResumeVoice(uint32_t voice) {
+    if (VoiceControl* control = GetControl(voice)) {
+        control->paused = false;
+        Submit(AudioCommand{AudioCommandType::ResumeVoice, voice - 1});
+    }
+}
+
+bool AudioMixer::IsVoicePlaying(uint32_t voice) const {
+    const VoiceControl* control = GetControl(voice);
+    if (!control || !control->playing || control->paused) {
+        return false;
+    }
+    return m_FinishedSerials[voice - 1].load(std::memory_order_acquire) != control->serial;
+}
+
+void AudioMixer::SeekVoice(uint32_t voice, float seconds) {
+    if (GetControl(voice)) {
+        Submit(AudioCommand{AudioCommandType::SeekVoice, voice - 1, 0, std::max(seconds, 0.0f)});
+    }
+}
+
+void AudioMixer::SetVoiceVolume(uint32_t voice, float volume) {
+    if (GetControl(voice)) {
+        Submit(AudioCommand{AudioCommandType::SetVoiceVolume, voice - 1, 0, std::max(volume, 0.0f)});
+    }
+}
+
+void AudioMixer::SetVoicePitch(uint32_t voice, float pitch) {
+    if (GetControl(voice)) {
+        Submit(AudioCommand{AudioCommandType::SetVoicePitch, voice - 1, 0, std::max(pitch, 0.0f)});
+    }
+}
+
+void AudioMixer::SetVoicePan(uint32_t voice, float pan) {
+    if (GetControl(voice)) {
+        Submit(AudioCommand{AudioCommandType::SetVoicePan, voice - 1, 0, std::clamp(pan, 0.0f, 1.0f)});
+    }
+}
+
+void AudioMixer::SetVoiceBus(uint32_t voice, AudioBus bus) {
+    if (GetControl(voice) && bus < AudioBus::Count) {
+        Submit(AudioCommand{AudioCommandType::SetVoiceBus, voice - 1, static_cast<uint32_t>(bus)});
+    }
+}
+
+void AudioMixer::SetBusGain(AudioBus bus, float gain) {
+    if (m_IsInitialized && bus < AudioBus::Count) {
+        Submit(AudioCommand{AudioCommandType::SetBusGain, static_cast<uint32_t>(bus), 0, std::max(gain, 0.0f)});
+    }
+}
+
+void AudioMixer::SetBusDucking(AudioBus target, AudioBus trigger, float amount) {
+    if (m_IsInitialized && target != AudioBus::Master && target < AudioBus::Count && trigger < AudioBus::Count) {
+        Submit(AudioCommand{AudioCommandType::SetBusDucking, static_cast<uint32_t>(target),
+                            static_cast<uint32_t>(trigger), std::clamp(amount, 0.0f, 1.0f)});
+    }
+}
+
+void AudioMixer::SetBusParent(AudioBus bus, AudioBus parent) {
+    if (!m_IsInitialized) {
+        return;
+    }
+
+    if (!m_ControlGraph.SetParent(bus, parent)) {
+        PX_LOG_WARNING(ENGINE, "Rejected audio bus route %u -> %u", static_cast<uint32_t>(bus),
+                       static_cast<uint32_t>(parent));
+        return;
+    }
+    Submit(AudioCommand{AudioCommandType::SetBusParent, static_cast<uint32_t>(bus), static_cast<uint32_t>(parent)});
+}
+
+void AudioMixer::SetMasterVolume(float volume) {
+    if (m_IsInitialized) {
+        Submit(AudioCommand{AudioCommandType::SetMasterVolume, 0, 0, std::clamp(volume, 0.0f, 1.0f)});
+    }
+}
+
+void AudioMixer::Flush() {
+    if (!m_IsInitialized) {
+        return;
+    }
+
+    if (!m_Threaded) {
+        ProcessCommands();
+        return;
+    }
+
+    uint64_t target = m_SubmittedCommands;
+    std::unique_lock<std::mutex> lock{m_MixMutex};
+    m_WakeRequested.store(true, std::memory_order_relaxed);
+    m_MixWake.notify_one();
+
+    bool done = m_FlushDone.wait_for(lock, FlushTimeout, [this, target]() {
+        return m_StopRequested || m_ProcessedCommands.load(std::memory_order_acquire) >= target;
+    });
+    if (!done) {
+        PX_LOG_WARNING(ENGINE, "Audio mixer flush timed out");
+    }
+}
+
+void AudioMixer::ReadOutput(float* output, uint32_t frameCount) {
+    uint64_t read = m_OutputRead.load(std::memory_order_relaxed);
+    uint64_t available = m_OutputWrite.load(std::memory_order_acquire) - read;
+    uint32_t frames = static_cast<uint32_t>(std::min<uint64_t>(frameCount, available));
+
+    uint32_t copied = 0;
+    while (copied < frames) {
+        uint32_t offset = static_cast<uint32_t>((read + copied) % OutputRingFrames);
+        uint32_t chunk = std::min(frames - copied, OutputRingFrames - offset);
+        const float* source = m_OutputRing.data() + static_cast<size_t>(offset) * 2;
+        std::copy(source, source + static_cast<size_t>(chunk) * 2, output + static_cast<size_t>(copied) * 2);
+        copied += chunk;
+    }
+
+    if (frames < frameCount) {
+        std::fill(output + static_cast<size_t>(frames) * 2, output + static_cast<size_t>(frameCount) * 2, 0.0f);
+        m_Underruns.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    m_OutputRead.store(read + frames, std::memory_order_release);
+    WakeMixThread();
+}
+
+void AudioMixer::Render(float* output, uint32_t frameCount) {
+    if (!m_IsInitialized) {
+        std::fill(output, output + static_cast<size_t>(frameCount) * 2, 0.0f);
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    ProcessCommands();
+
+    uint32_t offset = 0;
+    while (offset < frameCount) {
+        uint32_t block = std::min(frameCount - offset, MaxBlockFrames);
+        RenderBlock(output + static_cast<size_t>(offset) * 2, block);
+        offset += block;
+    }
+
+    uint64_t elapsed = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    m_LastMixNanos.store(elapsed, std::memory_order_relaxed);
+    if (elapsed > m_PeakMixNanos.load(std::memory_order_relaxed)) {
+        m_PeakMixNanos.store(elapsed, std::memory_order_relaxed);
+    }
+    m_TotalMixNanos.fetch_add(elapsed, std::memory_order_relaxed);
+    m_RenderedFrames.fetch_add(frameCount, std::memory_order_relaxed);
+}
+
+void AudioMixer::RenderBlock(float* output, uint32_t frameCount) {
+    size_t sampleCount = static_cast<size_t>(frameCount) * 2;
+    for (std::vector<float>& buffer : m_BusBuffers) {
+        std::fill(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(sampleCount), 0.0f);
+    }
+
+    uint32_t activeVoices = 0;
+    for (uint32_t i = 0; i < MaxVoices; ++i) {
+        VoiceState& voice = m_Voices[i];
+        if (!voice.playing || voice.paused || !voice.pcm) {
+            continue;
+        }
+
+        ++activeVoices;
+        AudioMixKernels::StereoGain target = ComputeGain(voice.volume, voice.pan);
+        float* busBuffer = m_BusBuffers[static_cast<size_t>(voice.bus)].data();
+        uint32_t written = AudioMixKernels::ResampleAdd(busBuffer, frameCount, voice.pcm, voice.frameCount,
+                                                        voice.cursor, voice.pitch, voice.gain, target);
+        voice.gain = target;
+
+        if (written < frameCount) {
+            voice.playing = false;
+            voice.cursor = 0.0;
+            m_FinishedSerials[i].store(voice.serial, std::memory_order_release);
+        }
+    }
+    m_ActiveVoices.store(activeVoices, std::memory_order_relaxed);
+
+    // A trigger bus counts as loud when anything routed through it is, so peaks are carried up the tree.
+    std::array<float, BusCount> peaks{};
+    for (uint32_t bus = 1; bus < BusCount; ++bus) {
+        peaks[bus] = AudioMixKernels::Peak(m_BusBuffers[bus].data(), frameCount);
+    }
+    for (AudioBus bus : m_BusGraph.GetMixOrder()) {
+        float& parentPeak = peaks[static_cast<size_t>(m_BusGraph.GetParent(bus))];
+        parentPeak = std::max(parentPeak, peaks[static_cast<size_t>(bus)]);
+    }
+
+    float blockSeconds = static_cast<float>(frameCount) / static_cast<float>(m_SampleRate);
+    for (AudioBus bus : m_BusGraph.GetMixOrder()) {
+        BusState& state = m_Buses[static_cast<size_t>(bus)];
+
+        float gain = state.gain;
+        if (state.duckAmount > 0.0f) {
+            bool triggered = peaks[static_cast<size_t>(state.duckTrigger)] > DuckThreshold;
+            float time = triggered ? DuckAttackSeconds : DuckReleaseSeconds;
+            float coefficient = 1.0f - std::exp(-blockSeconds / time);
+            state.duckEnvelope += ((triggered ? 1.0f : 0.0f) - state.duckEnvelope) * coefficient;
+            gain *= 1.0f - state.duckAmount * state.duckEnvelope;
+        }
+
+        float* parent = m_BusBuffers[static_cast<size_t>(m_BusGraph.GetParent(bus))].data();
+        AudioMixKernels::AddScaled(parent, m_BusBuffers[static_cast<size_t>(bus)].data(), frameCount, state.appliedGain,
+                                   gain);
+        state.appliedGain = gain;
+    }
+
+    BusState& master = m_Buses[0];
+    float masterGain = master.gain * m_MasterVolume;
+    std::copy(m_BusBuffers[0].begin(), m_BusBuffers[0].begin() + static_cast<std::ptrdiff_t>(sampleCount), output);
+    AudioMixKernels::Scale(output, frameCount, master.appliedGain * m_AppliedMasterVolume, masterGain);
+    AudioMixKernels::Clamp(output, frameCount);
+    master.appliedGain = master.gain;
+    m_AppliedMasterVolume = m_MasterVolume;
+}
+
+AudioMixerStats AudioMixer::GetStats() const {
+    AudioMixerStats stats{};
+    stats.lastMixMs = static_cast<double>(m_LastMixNanos.load(std::memory_order_relaxed)) / 1.0e6;
+    stats.peakMixMs = static_cast<double>(m_PeakMixNanos.load(std::memory_order_relaxed)) / 1.0e6;
+    stats.renderedFrames = m_RenderedFrames.load(std::memory_order_relaxed);
+    stats.underruns = m_Underruns.load(std::memory_order_relaxed);
+    stats.activeVoices = m_ActiveVoices.load(std::memory_order_relaxed);
+
+    if (stats.renderedFrames > 0) {
+        double audioSeconds = static_cast<double>(stats.renderedFrames) / static_cast<double>(m_SampleRate);
+        double mixSeconds = static_cast<double>(m_TotalMixNanos.load(std::memory_order_relaxed)) / 1.0e9;
+        stats.load = mixSeconds / audioSeconds;
+    }
+    return stats;
+}
+
+AudioMixer::VoiceControl* AudioMixer::GetControl(uint32_t voice) {
+    if (voice == 0 || voice > m_Controls.size() || !m_Controls[voice - 1].alive) {
+        return nullptr;
+    }
+    return &m_Controls[voice - 1];
+}
+
+const AudioMixer::VoiceControl* AudioMixer::GetControl(uint32_t voice) const {
+    if (voice == 0 || voice > m_Controls.size() || !m_Controls[voice - 1].alive) {
+        return nullptr;
+    }
+    return &m_Controls[voice - 1];
+}
+
+void AudioMixer::Submit(const AudioCommand& command) {
+    while (!m_Commands.Push(command)) {
+        if (!m_Threaded) {
+            ProcessCommands();
+        }
+        else {
+            WakeMixThread();
+            std::this_thread::yield();
+        }
+    }
+    ++m_SubmittedCommands;
+}
+
+void AudioMixer::WakeMixThread() {
+    // Lock free so the device callback can call it; a missed wake-up costs at most one block period.
+    m_WakeRequested.store(true, std::memory_order_relaxed);
+    m_MixWake.notify_one();
+}
+
+void AudioMixer::MixThreadMain() {
+    auto period = std::chrono::microseconds{1000000LL * OutputBlockFrames / m_SampleRate};
+
+    std::unique_lock<std::mutex> lock{m_MixMutex};
+    while (!m_StopRequested) {
+        m_WakeRequested.store(false, std::memory_order_relaxed);
+        lock.unlock();
+
+        ProcessCommands();
+        uint64_t write = m_OutputWrite.load(std::memory_order_relaxed);
+        while (write + OutputBlockFrames - m_OutputRead.load(std::memory_order_acquire) <= OutputRingFrames) {
+            size_t offset = static_cast<size_t>(write % OutputRingFrames) * 2;
+            Render(m_OutputRing.data() + offset, OutputBlockFrames);
+            write += OutputBlockFrames;
+            m_OutputWrite.store(write, std::memory_order_release);
+        }
+
+        lock.lock();
+        m_FlushDone.notify_all();
+        m_MixWake.wait_for(lock, period, [this]() {
+            return m_StopRequested || m_WakeRequested.load(std::memory_order_relaxed);
+        });
+    }
+}
+
+void AudioMixer::ProcessCommands() {
+    AudioCommand command{};
+    uint64_t processed = 0;
+    while (m_Commands.Pop(command)) {
+        Apply(command);
+        ++processed;
+    }
+
+    if (processed > 0) {
+        m_ProcessedCommands.fetch_add(processed, std::memory_order_release);
+    }
+}
+
+void AudioMixer::Apply(const AudioCommand& command) {
+    switch (command.type) {
+        case AudioCommandType::CreateVoice: {
+            VoiceState& voice = m_Voices[command.target];
+            voice = VoiceState{};
+            voice.pcm = command.pcm;
+            voice.frameCount = command.frameCount;
+            break;
+        }
+        case AudioCommandType::DestroyVoice:
+            m_Voices[command.target] = VoiceState{};
+            break;
+        case AudioCommandType::PlayVoice: {
+            VoiceState& voice = m_Voices[command.target];
+            voice.serial = command.argument;
+            voice.cursor = 0.0;
+            voice.gain = ComputeGain(voice.volume, voice.pan);
+            voice.playing = true;
+            voice.paused = false;
+            break;
+        }
+        case AudioCommandType::StopVoice:
+            m_Voices[command.target].playing = false;
+            m_Voices[command.target].paused = false;
+            m_Voices[command.target].cursor = 0.0;
+            break;
+        case AudioCommandType::PauseVoice:
+            m_Voices[command.target].paused = true;
+            break;
+        case AudioCommandType::ResumeVoice:
+            m_Voices[command.target].paused = false;
+            break;
+        case AudioCommandType::SeekVoice: {
+            VoiceState& voice = m_Voices[command.target];
+            voice.cursor = std::min(static_cast<double>(command.value) * m_SampleRate,
+                                    static_cast<double>(voice.frameCount));
+            break;
+        }
+        case AudioCommandType::SetVoiceVolume:
+            m_Voices[command.target].volume = command.value;
+            break;
+        case AudioCommandType::SetVoicePitch:
+            m_Voices[command.target].pitch = command.value;
+            break;
+        case AudioCommandType::SetVoicePan:
+            m_Voices[command.target].pan = command.value;
+            break;
+        case AudioCommandType::SetVoiceBus:
+            m_Voices[command.target].bus = static_cast<AudioBus>(command.argument);
+            break;
+        case AudioCommandType::SetBusGain:
+            m_Buses[command.target].gain = command.value;
+            break;
+        case AudioCommandType::SetBusDucking:
+            m_Buses[command.target].duckTrigger = static_cast<AudioBus>(command.argument);
+            m_Buses[command.target].duckAmount = command.value;
+            break;
+        case AudioCommandType::SetBusParent:
+            m_BusGraph.SetParent(static_cast<AudioBus>(command.target), static_cast<AudioBus>(command.argument));
+            break;
+        case AudioCommandType::SetMasterVolume:
+            m_MasterVolume = command.value;
+            break;
+    }
+}
+
+} // namespace PiiXeL
@@ -0,0 +1,66 @@
+#include "Audio/AudioStreamPump.hpp"
+
+#include "Resources/AudioAsset.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace PiiXeL {
+
+namespace {
+constexpr std::chrono::milliseconds PumpInterval{5};
+} // namespace
+
+AudioStreamPump& AudioStreamPump::Instance() {
+    static AudioStreamPump instance{};
+    return instance;
+}
+
+AudioStreamPump::~AudioStreamPump() {
+    m_Running = false;
+    if (m_Thread.joinable()) {
+        m_Thread.join();
+    }
+}
+
+void AudioStreamPump::Register(AudioAsset* asset) {
+    std::lock_guard<std::mutex> lock{m_Mutex};
+    if (std::find(m_Streams.begin(), m_Streams.end(), asset) == m_Streams.end()) {
+        m_Streams.push_back(asset);
+    }
+
+    if (!m_Running.exchange(true)) {
+        if (m_Thread.joinable()) {
+            m_Thread.join();
+        }
+        m_Thread = std::thread{&AudioStreamPump::Run, this};
+    }
+}
+
+void AudioStreamPump::Unregister(AudioAsset* asset) {
+    std::lock_guard<std::mutex> lock{m_Mutex};
+    m_Streams.erase(std::remove(m_Streams.begin(), m_Streams.end(), asset), m_Streams.end());
+}
+
+size_t AudioStreamPump::GetStreamCount() const {
+    std::lock_guard<std::mutex> lock{m_Mutex};
+    return m_Streams.size();
+}
+
+void AudioStreamPump::Run() {
+    while (m_Running) {
+        {
+            std::lock_guard<std::mutex> lock{m_Mutex};
+            if (m_Streams.empty()) {
+                m_Running = false;
+                break;
+            }
+            for (AudioAsset* asset : m_Streams) {
+                asset->RefillStream();
+            }
+        }
+        std::this_thread::sleep_for(PumpInterval);
+    }
+}
+
+} // namespace PiiXeL
@@ -0,0 +1,216 @@
+#include "Audio/AudioVoicePool.hpp"
+
+#include "Audio/AudioBackend.hpp"
+#include "Core/Logger.hpp"
+
+#include <algorithm>
+
+namespace PiiXeL {
+
+namespace {
+constexpr float PriorityWeight{0.5f};
+constexpr float AudibilityWeight{0.35f};
+constexpr float AgeWeight{0.15f};
+constexpr float StealThreshold{0.05f};
+} // namespace
+
+AudioVoicePool::~AudioVoicePool() {
+    Shutdown();
+}
+
+void AudioVoicePool::Initialize(AudioBackend* backend, uint32_t maxVoices) {
+    Shutdown();
+    m_Backend = backend;
+    m_Voices.resize(std::max<uint32_t>(maxVoices, 1));
+    m_Time = 0.0;
+}
+
+void AudioVoicePool::Shutdown() {
+    for (AudioVoice& voice : m_Voices) {
+        ReleaseBackendVoice(voice);
+    }
+    m_Voices.clear();
+    m_Backend = nullptr;
+}
+
+AudioVoiceHandle AudioVoicePool::Acquire(const AudioAsset& asset, UUID clip, entt::entity owner, float priority,
+                                         float audibility) {
+    if (!m_Backend || m_Voices.empty()) {
+        return AudioVoiceHandle{};
+    }
+
+    int32_t freeIndex{-1};
+    int32_t victimIndex{-1};
+    float victimScore{0.0f};
+
+    for (size_t i = 0; i < m_Voices.size(); ++i) {
+        const AudioVoice& voice = m_Voices[i];
+        if (IsFree(voice)) {
+            if (freeIndex < 0 || voice.clip == clip) {
+                freeIndex = static_cast<int32_t>(i);
+            }
+            if (voice.clip == clip) {
+                break;
+            }
+            continue;
+        }
+
+        float score = ComputeScore(voice.priority, voice.audibility, voice.startTime);
+        if (victimIndex < 0 || score < victimScore) {
+            victimIndex = static_cast<int32_t>(i);
+            victimScore = score;
+        }
+    }
+
+    int32_t index = freeIndex;
+    if (index < 0) {
+        float candidateScore = ComputeScore(priority, audibility, m_Time);
+        if (victimIndex < 0 || candidateScore <= victimScore + StealThreshold) {
+            return AudioVoiceHandle{};
+        }
+        index = victimIndex;
+    }
+
+    AudioVoice& voice = m_Voices[static_cast<size_t>(index)];
+    if (voice.clip != clip || voice.backendVoice == 0) {
+        ReleaseBackendVoice(voice);
+        voice.backendVoice = m_Backend->CreateVoice(asset);
+        if (voice.backendVoice == 0) {
+            PX_LOG_WARNING(ENGINE, "Failed to create backend voice %d", index);
+            return AudioVoiceHandle{};
+        }
+        voice.clip = clip;
+    }
+    else {
+        m_Backend->StopVoice(voice.backendVoice);
+    }
+
+    ++voice.serial;
+    voice.owner = owner;
+    voice.priority = priority;
+    voice.audibility = audibility;
+    voice.startTime = m_Time;
+    voice.active = true;
+    voice.paused = false;
+
+    return AudioVoiceHandle{index, voice.serial};
+}
+
+void AudioVoicePool::Release(AudioVoiceHandle handle) {
+    AudioVoice* voice = Resolve(handle);
+    if (!voice) {
+        return;
+    }
+
+    m_Backend->StopVoice(voice->backendVoice);
+    voice->owner = entt::null;
+    voice->active = false;
+    voice->paused = false;
+    ++voice->serial;
+}
+
+void AudioVoicePool::ReleaseClip(UUID clip) {
+    for (AudioVoice& voice : m_Voices) {
+        if (voice.clip == clip) {
+            ReleaseBackendVoice(voice);
+        }
+    }
+}
+
+void AudioVoicePool::ReleaseAll() {
+    for (AudioVoice& voice : m_Voices) {
+        ReleaseBackendVoice(voice);
+    }
+}
+
+uint32_t AudioVoicePool::GetBackendVoice(AudioVoiceHandle handle) {
+    AudioVoice* voice = Resolve(handle);
+    return voice ? voice->backendVoice : 0;
+}
+
+void AudioVoicePool::SetAudibility(AudioVoiceHandle handle, float audibility) {
+    if (AudioVoice* voice = Resolve(handle)) {
+        voice->audibility = audibility;
+    }
+}
+
+void AudioVoicePool::SetPaused(AudioVoiceHandle handle, bool paused) {
+    if (AudioVoice* voice = Resolve(handle)) {
+        voice->paused = paused;
+    }
+}
+
+bool AudioVoicePool::IsPaused(AudioVoiceHandle handle) {
+    AudioVoice* voice = Resolve(handle);
+    return voice && voice->paused;
+}
+
+void AudioVoicePool::SetMaxVoices(uint32_t maxVoices) {
+    maxVoices = std::max<uint32_t>(maxVoices, 1);
+    for (size_t i = maxVoices; i < m_Voices.size(); ++i) {
+        ReleaseBackendVoice(m_Voices[i]);
+    }
+    m_Voices.resize(maxVoices);
+}
+
+uint32_t AudioVoicePool::GetActiveVoiceCount() const {
+    uint32_t count = 0;
+    for (const AudioVoice& voice : m_Voices) {
+        if (!IsFree(voice)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+bool AudioVoicePool::HasFreeVoice() const {
+    if (!m_Backend) {
+        return false;
+    }
+    for (const AudioVoice& voice : m_Voices) {
+        if (IsFree(voice)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+AudioVoice* AudioVoicePool::Resolve(AudioVoiceHandle handle) {
+    if (handle.index < 0 || static_cast<size_t>(handle.index) >= m_Voices.size()) {
+        return nullptr;
+    }
+
+    AudioVoice& voice = m_Voices[static_cast<size_t>(handle.index)];
+    if (!voice.active || voice.serial != handle.serial) {
+        return nullptr;
+    }
+    return &voice;
+}
+
+bool AudioVoicePool::IsFree(const AudioVoice& voice) const {
+    if (!voice.active) {
+        return true;
+    }
+    return !voice.paused && !m_Backend->IsVoicePlaying(voice.backendVoice);
+}
+
+float AudioVoicePool::ComputeScore(float priority, float audibility, double startTime) const {
+    float priorityTerm = 1.0f - std::clamp(priority, 0.0f, 256.0f) / 256.0f;
+    float age = static_cast<float>(m_Time - startTime);
+    float ageTerm = 1.0f / (1.0f + std::max(age, 0.0f));
+    return priorityTerm * PriorityWeight + std::clamp(audibility, 0.0f, 1.0f) * AudibilityWeight + ageTerm * AgeWeight;
+}
+
+void AudioVoicePool::ReleaseBackendVoice(AudioVoice& voice) {
+    if (voice.backendVoice != 0 && m_Backend) {
+        m_Backend->DestroyVoice(voice.backendVoice);
+    }
+    voice.backendVoice = 0;
+    voice.clip = UUID{0};
+    voice.owner = entt::null;
+    voice.active = false;
+    voice.paused = false;
+    ++voice.serial;
+}
+
+} // namespace PiiXeL
@@ -0,0 +1,244 @@
+#include "Audio/DeviceAudioBackend.hpp"
+
+#include "Core/Logger.hpp"
+#include "Resources/AudioAsset.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace PiiXeL {
+
+namespace {
+constexpr float DuckAttackSeconds{0.01f};
+constexpr float DuckReleaseSeconds{0.25f};
+constexpr float VolumeEpsilon{1.0e-4f};
+} // namespace
+
+DeviceAudioBackend::~DeviceAudioBackend() {
+    Shutdown();
+}
+
+bool DeviceAudioBackend::Initialize() {
+    if (m_IsInitialized) {
+        return true;
+    }
+
+    InitAudioDevice();
+
+    if (!IsAudioDeviceReady()) {
+        PX_LOG_ERROR(ENGINE, "Failed to initialize audio device");
+        return false;
+    }
+
+    m_IsInitialized = true;
+    return true;
+}
+
+void DeviceAudioBackend::Shutdown() {
+    if (!m_IsInitialized) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < m_Voices.size(); ++i) {
+        DestroyVoice(i + 1);
+    }
+    m_Voices.clear();
+    m_FreeVoices.clear();
+    m_Buses.fill(BusState{});
+    m_BusGraph = AudioBusGraph{};
+
+    CloseAudioDevice();
+    m_IsInitialized = false;
+}
+
+void DeviceAudioBackend::Advance(float deltaTime) {
+    bool ducking = false;
+    for (BusState& state : m_Buses) {
+        if (state.duckAmount <= 0.0f && state.duckEnvelope <= 0.0f) {
+            continue;
+        }
+
+        bool triggered = false;
+        for (const Voice& voice : m_Voices) {
+            if (voice.sound.frameCount > 0 && m_BusGraph.IsWithin(voice.bus, state.duckTrigger) &&
+                IsSoundPlaying(voice.sound))
+            {
+                triggered = true;
+                break;
+            }
+        }
+
+        float time = triggered ? DuckAttackSeconds : DuckReleaseSeconds;
+        float coefficient = 1.0f - std::exp(-std::max(deltaTime, 0.0f) / time);
+        state.duckEnvelope += ((triggered ? 1.0f : 0.0f) - state.duckEnvelope) * coefficient;
+        if (state.duckAmount <= 0.0f && state.duckEnvelope < VolumeEpsilon) {
+            state.duckEnvelope = 0.0f;
+        }
+        ducking = true;
+    }
+
+    if (ducking) {
+        ApplyAllVolumes();
+    }
+}
+
+void DeviceAudioBackend::SetMasterVolume(float volume) {
+    if (m_IsInitialized) {
+        ::SetMasterVolume(volume);
+    }
+}
+
+uint32_t DeviceAudioBackend::CreateVoice(const AudioAsset& clip) {
+    Sound base = clip.GetSound();
+    if (base.frameCount == 0) {
+        return 0;
+    }
+
+    Sound alias = LoadSoundAlias(base);
+    if (alias.frameCount == 0) {
+        return 0;
+    }
+
+    if (!m_FreeVoices.empty()) {
+        uint32_t index = m_FreeVoices.back();
+        m_FreeVoices.pop_back();
+        m_Voices[index] = Voice{alias};
+        ApplyVolume(m_Voices[index]);
+        return index + 1;
+    }
+
+    m_Voices.push_back(Voice{alias});
+    ApplyVolume(m_Voices.back());
+    return static_cast<uint32_t>(m_Voices.size());
+}
+
+void DeviceAudioBackend::DestroyVoice(uint32_t voice) {
+    const Sound* sound = GetSound(voice);
+    if (!sound) {
+        return;
+    }
+
+    StopSound(*sound);
+    UnloadSoundAlias(*sound);
+    m_Voices[voice - 1] = Voice{};
+    m_FreeVoices.push_back(voice - 1);
+}
+
+void DeviceAudioBackend::PlayVoice(uint32_t voice) {
+    if (const Sound* sound = GetSound(voice)) {
+        PlaySound(*sound);
+    }
+}
+
+void DeviceAudioBackend::StopVoice(uint32_t voice) {
+    if (const Sound* sound = GetSound(voice)) {
+        StopSound(*sound);
+    }
+}
+
+void DeviceAudioBackend::PauseVoice(uint32_t voice) {
+    if (const Sound* sound = GetSound(voice)) {
+        PauseSound(*sound);
+    }
+}
+
+void DeviceAudioBackend::ResumeVoice(uint32_t voice) {
+    if (const Sound* sound = GetSound(voice)) {
+        ResumeSound(*sound);
+    }
+}
+
+bool DeviceAudioBackend::IsVoicePlaying(uint32_t voice) const {
+    const Sound* sound = GetSound(voice);
+    return sound && IsSoundPlaying(*sound);
+}
+
+void DeviceAudioBackend::SetVoiceVolume(uint32_t voice, float volume) {
+    if (GetSound(voice)) {
+        m_Voices[voice - 1].volume = std::max(volume, 0.0f);
+        ApplyVolume(m_Voices[voice - 1]);
+    }
+}
+
+void DeviceAudioBackend::SetVoicePitch(uint32_t voice, float pitch) {
+    if (const Sound* sound = GetSound(voice)) {
+        SetSoundPitch(*sound, pitch);
+    }
+}
+
+void DeviceAudioBackend::SetVoicePan(uint32_t voice, float pan) {
+    if (const Sound* sound = GetSound(voice)) {
+        SetSoundPan(*sound, pan);
+    }
+}
+
+void DeviceAudioBackend::SetVoiceBus(uint32_t voice, AudioBus bus) {
+    if (GetSound(voice) && bus < AudioBus::Count) {
+        m_Voices[voice - 1].bus = bus;
+        ApplyVolume(m_Voices[voice - 1]);
+    }
+}
+
+void DeviceAudioBackend::SetBusGain(AudioBus bus, float gain) {
+    if (bus < AudioBus::Count) {
+        m_Buses[static_cast<size_t>(bus)].gain = std::max(gain, 0.0f);
+        ApplyAllVolumes();
+    }
+}
+
+void DeviceAudioBackend::SetBusDucking(AudioBus target, AudioBus trigger, float amount) {
+    if (target != AudioBus::Master && target < AudioBus::Count && trigger < AudioBus::Count) {
+        BusState& state = m_Buses[static_cast<size_t>(target)];
+        state.duckTrigger = trigger;
+        state.duckAmount = std::clamp(amount, 0.0f, 1.0f);
+    }
+}
+
+void DeviceAudioBackend::SetBusParent(AudioBus bus, AudioBus parent) {
+    if (!m_BusGraph.SetParent(bus, parent)) {
+        PX_LOG_WARNING(ENGINE, "Rejected audio bus route %u -> %u", static_cast<uint32_t>(bus),
+                       static_cast<uint32_t>(parent));
+        return;
+    }
+    ApplyAllVolumes();
+}
+
+const Sound* DeviceAudioBackend::GetSound(uint32_t voice) const {
+    if (voice == 0 || voice > m_Voices.size()) {
+        return nullptr;
+    }
+
+    const Sound& sound = m_Voices[voice - 1].sound;
+    return sound.frameCount > 0 ? &sound : nullptr;
+}
+
+float DeviceAudioBackend::GetRouteGain(AudioBus bus) const {
+    float gain = 1.0f;
+    for (uint32_t depth = 0; depth < AudioBusGraph::BusCount; ++depth) {
+        const BusState& state = m_Buses[static_cast<size_t>(bus)];
+        gain *= state.gain * (1.0f - state.duckAmount * state.duckEnvelope);
+        if (bus == AudioBus::Master) {
+            break;
+        }
+        bus = m_BusGraph.GetParent(bus);
+    }
+    return gain;
+}
+
+void DeviceAudioBackend::ApplyVolume(Voice& voice) const {
+    float volume = voice.volume * GetRouteGain(voice.bus);
+    if (std::fabs(volume - voice.appliedVolume) > VolumeEpsilon) {
+        SetSoundVolume(voice.sound, volume);
+        voice.appliedVolume = volume;
+    }
+}
+
+void DeviceAudioBackend::ApplyAllVolumes() {
+    for (Voice& voice : m_Voices) {
+        if (voice.sound.frameCount > 0) {
+            ApplyVolume(voice);
+        }
+    }
+}
+
+} // namespace PiiXeL
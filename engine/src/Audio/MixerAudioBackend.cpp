@@ -0,0 +1,84 @@
+#include "Audio/MixerAudioBackend.hpp"
+
+#include "Core/Logger.hpp"
+#include "Resources/AudioAsset.hpp"
+
+namespace PiiXeL {
+
+std::atomic<MixerAudioBackend*> MixerAudioBackend::s_Active{nullptr};
+
+MixerAudioBackend::MixerAudioBackend(uint32_t sampleRate) : m_SampleRate{sampleRate > 0 ? sampleRate : 1} {}
+
+MixerAudioBackend::~MixerAudioBackend() {
+    MixerAudioBackend::Shutdown();
+}
+
+bool MixerAudioBackend::Initialize() {
+    if (m_IsDeviceOpen) {
+        return true;
+    }
+
+    if (s_Active.load() != nullptr) {
+        PX_LOG_ERROR(ENGINE, "Only one mixer audio backend can own the device");
+        return false;
+    }
+
+    InitAudioDevice();
+
+    if (!IsAudioDeviceReady()) {
+        PX_LOG_ERROR(ENGINE, "Failed to initialize audio device");
+        return false;
+    }
+
+    m_Mixer.Initialize(m_SampleRate, true);
+
+    SetAudioStreamBufferSizeDefault(static_cast<int>(StreamBufferFrames));
+    m_Stream = LoadAudioStream(m_SampleRate, 32, Channels);
+    SetAudioStreamBufferSizeDefault(0);
+
+    if (!IsAudioStreamValid(m_Stream)) {
+        PX_LOG_ERROR(ENGINE, "Failed to open mixer output stream");
+        m_Mixer.Shutdown();
+        CloseAudioDevice();
+        return false;
+    }
+
+    s_Active.store(this);
+    SetAudioStreamCallback(m_Stream, &MixerAudioBackend::StreamCallback);
+    PlayAudioStream(m_Stream);
+    m_IsDeviceOpen = true;
+    return true;
+}
+
+void MixerAudioBackend::Shutdown() {
+    if (!m_IsDeviceOpen) {
+        return;
+    }
+
+    StopAudioStream(m_Stream);
+    UnloadAudioStream(m_Stream);
+    m_Stream = AudioStream{};
+    s_Active.store(nullptr);
+
+    m_Mixer.Shutdown();
+    CloseAudioDevice();
+    m_IsDeviceOpen = false;
+}
+
+uint32_t MixerAudioBackend::CreateVoice(const AudioAsset& clip) {
+    const std::vector<float>& pcm = clip.GetPcm();
+    if (pcm.empty()) {
+        PX_LOG_WARNING(ENGINE, "Mixer audio backend needs PCM data for clip: %s", clip.GetName().c_str());
+        return 0;
+    }
+
+    return m_Mixer.CreateVoice(pcm.data(), static_cast<uint32_t>(pcm.size() / Channels));
+}
+
+void MixerAudioBackend::StreamCallback(void* bufferData, unsigned int frames) {
+    if (MixerAudioBackend* backend = s_Active.load(std::memory_order_acquire)) {
+        backend->m_Mixer.ReadOutput(static_cast<float*>(bufferData), frames);
+    }
+}
+
+} // namespace PiiXeL
@@ -0,0 +1,49 @@
+#include "Audio/OfflineAudioBackend.hpp"
+
+#include "Core/Logger.hpp"
+
+#include <cmath>
+
+namespace PiiXeL {
+
+OfflineAudioBackend::OfflineAudioBackend(uint32_t sampleRate) : MixerAudioBackend{sampleRate} {}
+
+OfflineAudioBackend::~OfflineAudioBackend() {
+    OfflineAudioBackend::Shutdown();
+}
+
+bool OfflineAudioBackend::Initialize() {
+    m_Mixer.Initialize(m_SampleRate, false);
+    m_Capture.clear();
+    m_PendingFrames = 0.0;
+    m_RenderedFrames = 0;
+    PX_LOG_INFO(ENGINE, "Offline audio backend initialized (%u Hz)", m_SampleRate);
+    return true;
+}
+
+void OfflineAudioBackend::Shutdown() {
+    m_Mixer.Shutdown();
+    m_MixBuffer.clear();
+}
+
+void OfflineAudioBackend::Advance(float deltaTime) {
+    m_PendingFrames += static_cast<double>(deltaTime) * static_cast<double>(m_SampleRate);
+    double frames = std::floor(m_PendingFrames);
+    m_PendingFrames -= frames;
+
+    if (frames > 0.0) {
+        Render(static_cast<uint32_t>(frames));
+    }
+}
+
+void OfflineAudioBackend::Render(uint32_t frameCount) {
+    m_MixBuffer.resize(static_cast<size_t>(frameCount) * Channels);
+    m_Mixer.Render(m_MixBuffer.data(), frameCount);
+
+    if (m_CaptureEnabled) {
+        m_Capture.insert(m_Capture.end(), m_MixBuffer.begin(), m_MixBuffer.end());
+    }
+    m_RenderedFrames += frameCount;
+}
+
+} // namespace PiiXeL
@@ -20,10 +20,10 @@ bool GamePackage::SaveToFile(const std::string& filepath) {
                              {"engineVersion", m_Header.engineVersion}};
 
     packageJson["scenes"] = nlohmann::json::array();
-    for (const std::pair<std::string, nlohmann::json>& scenePair : m_Scenes) {
+    for (const std::pair<std::string, std::shared_ptr<const nlohmann::json>>& scenePair : m_Scenes) {
         nlohmann::json sceneEntry{};
         sceneEntry["name"] = scenePair.first;
-        sceneEntry["data"] = scenePair.second;
+        sceneEntry["data"] = *scenePair.second;
         packageJson["scenes"].push_back(sceneEntry);
     }
 
@@ -106,7 +106,7 @@ bool GamePackage::LoadFromFile(const std::string& filepath) {
         for (const nlohmann::json& sceneEntry : packageJson["scenes"]) {
             std::string name = sceneEntry.value("name", "Unnamed Scene");
             nlohmann::json sceneData = sceneEntry.value("data", nlohmann::json{});
-            m_Scenes.push_back({name, sceneData});
+            m_Scenes.push_back({name, std::make_shared<const nlohmann::json>(std::move(sceneData))});
         }
     }
 
@@ -163,7 +163,7 @@ void GamePackage::SetHeader(const GamePackageHeader& header) {
 }
 
 void GamePackage::AddScene(const std::string& name, const nlohmann::json& sceneData) {
-    m_Scenes.push_back({name, sceneData});
+    m_Scenes.push_back({name, std::make_shared<const nlohmann::json>(sceneData)});
     m_Header.sceneCount = static_cast<uint32_t>(m_Scenes.size());
 }
 
@@ -1,6 +1,12 @@
 #include "Build/GamePackageBuilder.hpp"
 
 #include "Core/Logger.hpp"
+#include "Resources/AssetPackage.hpp"
+#include "Resources/AssetRegistry.hpp"
+#include "Resources/PrefabAsset.hpp"
+#include "Scene/BinarySceneSerializer.hpp"
+#include "Scene/SceneSerializer.hpp"
+#include "Scene/WorldPartition.hpp"
 
 #include <cinttypes>
 #include <filesystem>
@@ -94,6 +100,8 @@ bool GamePackageBuilder::BuildFromProject(const std::string& projectPath, const
     config["targetFPS"] = projectConfig.value("window", nlohmann::json{}).value("targetFPS", 60);
     config["vsync"] = projectConfig.value("window", nlohmann::json{}).value("vsync", true);
     config["mainScene"] = projectConfig.value("startScene", "content/scenes/Default_Scene.scene");
+    // The runtime has no game.config.json of its own; it reads physics, audio and job settings from this copy.
+    config["project"] = projectConfig;
 
     std::string iconPath = projectConfig.value("window", nlohmann::json{}).value("icon", "");
     if (!iconPath.empty()) {
@@ -149,7 +157,8 @@ bool GamePackageBuilder::BuildFromProject(const std::string& projectPath, const
                     try {
                         file >> sceneData;
                         std::string sceneName = std::filesystem::path(fullPath).stem().string();
-                        package.AddScene(sceneName, sceneData);
+                        AddScene(package, sceneName, sceneData);
+                        AddWorldPartition(package, sceneName, fullPath);
                         PX_LOG_INFO(BUILD, "Added scene: %s", sceneName.c_str());
                     }
                     catch (const nlohmann::json::exception& e) {
@@ -221,6 +230,11 @@ bool GamePackageBuilder::BuildFromProject(const std::string& projectPath, const
         CollectAssetsFromScenes(package, basePath);
     }
 
+    if (!AddBinaryScenes(package)) {
+        PX_LOG_ERROR(BUILD, "Failed to build game package: scenes reference missing prefabs");
+        return false;
+    }
+
     if (!package.SaveToFile(outputPath)) {
         PX_LOG_ERROR(BUILD, "Failed to save game package");
         return false;
@@ -244,7 +258,8 @@ void GamePackageBuilder::ScanScenes(const std::string& scenesPath, GamePackage&
                 try {
                     file >> sceneData;
                     std::string sceneName = entry.path().stem().string();
-                    package.AddScene(sceneName, sceneData);
+                    AddScene(package, sceneName, sceneData);
+                    AddWorldPartition(package, sceneName, entry.path());
                     PX_LOG_INFO(BUILD, "Added scene: %s", sceneName.c_str());
                 }
                 catch (const nlohmann::json::exception& e) {
@@ -256,6 +271,116 @@ void GamePackageBuilder::ScanScenes(const std::string& scenesPath, GamePackage&
     }
 }
 
+void GamePackageBuilder::AddScene(GamePackage& package, const std::string& sceneName,
+                                  const nlohmann::json& sceneData) {
+    package.AddScene(sceneName, sceneData);
+}
+
+void GamePackageBuilder::AddWorldPartition(GamePackage& package, const std::string& sceneName,
+                                           const std::filesystem::path& scenePath) {
+    std::filesystem::path manifestPath = scenePath;
+    manifestPath.replace_extension(WorldPartition::FileExtension);
+    if (!std::filesystem::exists(manifestPath)) {
+        return;
+    }
+
+    AssetData manifest = LoadAssetFile(manifestPath.string(), "data");
+    nlohmann::json manifestJson = nlohmann::json::parse(manifest.data.begin(), manifest.data.end(), nullptr, false);
+    if (manifestJson.is_discarded() || !manifestJson.contains("persistent") || !manifestJson.contains("cells")) {
+        PX_LOG_ERROR(BUILD, "Invalid world partition, not packaged: %s", manifestPath.string().c_str());
+        return;
+    }
+
+    std::vector<std::string> chunks{manifestJson["persistent"].get<std::string>()};
+    for (const nlohmann::json& cell : manifestJson["cells"]) {
+        chunks.push_back(cell.value("chunk", ""));
+    }
+
+    std::filesystem::path directory = manifestPath.parent_path();
+    for (const std::string& chunk : chunks) {
+        AssetData asset = LoadAssetFile((directory / chunk).string(), "data");
+        if (asset.data.empty()) {
+            PX_LOG_WARNING(BUILD, "World partition chunk missing: %s", chunk.c_str());
+            continue;
+        }
+        asset.path = "scenes/" + std::filesystem::path(chunk).generic_string();
+        package.AddAsset(asset);
+    }
+
+    manifest.path = "scenes/" + sceneName + WorldPartition::FileExtension;
+    package.AddAsset(manifest);
+    PX_LOG_INFO(BUILD, "Added world partition: %s (%zu chunks)", sceneName.c_str(), chunks.size());
+}
+
+bool GamePackageBuilder::AddBinaryScenes(GamePackage& package) {
+    // The converter expands delta-encoded prefab instances through the AssetRegistry, so it is given the packaged
+    // assets the same way GamePackageLoader hands them to the runtime.
+    AssetRegistry& assetRegistry = AssetRegistry::Instance();
+    for (const AssetData& asset : package.GetAssets()) {
+        if (!asset.path.ends_with(".pxa")) {
+            continue;
+        }
+
+        AssetMetadata metadata{};
+        std::vector<uint8_t> assetData{};
+        AssetPackage assetPackage{};
+        if (assetPackage.LoadFromMemory(asset.data.data(), asset.data.size(), metadata, assetData, asset.path)) {
+            assetRegistry.RegisterAssetFromMemory(metadata.uuid, metadata.sourceFile, asset.data);
+        }
+    }
+
+    bool succeeded = true;
+    for (const std::pair<std::string, std::shared_ptr<const nlohmann::json>>& scenePair : package.GetScenes()) {
+        const std::string& sceneName = scenePair.first;
+        const nlohmann::json& sceneData = *scenePair.second;
+        if (!ResolvePrefabBases(sceneName, sceneData)) {
+            succeeded = false;
+            continue;
+        }
+
+        AssetData binaryScene{};
+        binaryScene.path = "scenes/" + sceneName + BinarySceneSerializer::FileExtension;
+        binaryScene.type = "scene";
+        if (BinarySceneSerializer::ConvertJsonToBinary(sceneData, binaryScene.data)) {
+            package.AddAsset(binaryScene);
+        }
+        else {
+            PX_LOG_WARNING(BUILD, "Failed to convert scene to binary: %s", sceneName.c_str());
+        }
+    }
+
+    assetRegistry.UnloadAll();
+    return succeeded;
+}
+
+bool GamePackageBuilder::ResolvePrefabBases(const std::string& sceneName, const nlohmann::json& sceneData) {
+    if (!SceneSerializer::IsDeltaEncoded(sceneData) || !sceneData.contains("entities") ||
+        !sceneData["entities"].is_array())
+    {
+        return true;
+    }
+
+    bool resolved = true;
+    std::unordered_set<uint64_t> checked{};
+    for (const nlohmann::json& entity : sceneData["entities"]) {
+        if (!entity.contains("base") || !entity["base"].is_number_unsigned()) {
+            continue;
+        }
+
+        uint64_t prefabUUID = entity["base"].get<uint64_t>();
+        if (!checked.insert(prefabUUID).second) {
+            continue;
+        }
+
+        if (!std::dynamic_pointer_cast<PrefabAsset>(AssetRegistry::Instance().LoadAsset(UUID{prefabUUID}))) {
+            PX_LOG_ERROR(BUILD, "Scene %s: prefab %" PRIu64 " is not in the package; its instances cannot be built",
+                         sceneName.c_str(), prefabUUID);
+            resolved = false;
+        }
+    }
+    return resolved;
+}
+
 void GamePackageBuilder::ScanAssets(const std::string& assetsPath, GamePackage& package) {
     if (!std::filesystem::exists(assetsPath)) {
         PX_LOG_WARNING(BUILD, "Assets directory not found: %s", assetsPath.c_str());
@@ -410,8 +535,8 @@ void GamePackageBuilder::CollectAssetsFromScenes(GamePackage& package, const std
     }
 
     std::vector<uint64_t> uuidsToProcess;
-    for (const std::pair<std::string, nlohmann::json>& scenePair : package.GetScenes()) {
-        const nlohmann::json& sceneData = scenePair.second;
+    for (const std::pair<std::string, std::shared_ptr<const nlohmann::json>>& scenePair : package.GetScenes()) {
+        const nlohmann::json& sceneData = *scenePair.second;
         if (sceneData.contains("entities") && sceneData["entities"].is_array()) {
             for (const nlohmann::json& entity : sceneData["entities"]) {
                 for (auto it = entity.begin(); it != entity.end(); ++it) {
@@ -419,6 +544,11 @@ void GamePackageBuilder::CollectAssetsFromScenes(GamePackage& package, const std
                         CollectUUIDsFromComponent(it.value(), uuidsToProcess);
                     }
                 }
+
+                // Delta-encoded prefab instances need the prefab they were written against.
+                if (entity.contains("base") && entity["base"].is_number_unsigned()) {
+                    uuidsToProcess.push_back(entity["base"].get<uint64_t>());
+                }
             }
         }
     }
@@ -6,17 +6,15 @@
 #include "Components/CircleCollider2D.hpp"
 #include "Components/RigidBody2D.hpp"
 #include "Components/Script.hpp"
-#include "Components/Sprite.hpp"
 #include "Components/Tag.hpp"
 #include "Components/Transform.hpp"
 #include "Components/UUID.hpp"
 #include "Core/Logger.hpp"
-#include "Reflection/Reflection.hpp"
 #include "Resources/AssetPackage.hpp"
 #include "Resources/AssetRegistry.hpp"
-#include "Scene/ComponentRegistry.hpp"
-#include "Scene/EntityRegistry.hpp"
+#include "Scene/BinarySceneSerializer.hpp"
 #include "Scene/Scene.hpp"
+#include "Scene/SceneSerializer.hpp"
 #include "Scripting/ScriptComponent.hpp"
 #include "Systems/ScriptSystem.hpp"
 
@@ -49,10 +47,21 @@ std::unique_ptr<Scene> GamePackageLoader::LoadScene(const std::string& sceneName
         return nullptr;
     }
 
+    const AssetData* binaryScene = m_Package.GetAsset("scenes/" + sceneName + BinarySceneSerializer::FileExtension);
+    if (binaryScene) {
+        std::unique_ptr<Scene> scene = std::make_unique<Scene>(sceneName);
+        BinarySceneSerializer serializer{scene.get()};
+        if (serializer.DeserializeFromMemory(binaryScene->data.data(), binaryScene->data.size())) {
+            PX_LOG_INFO(BUILD, "Scene loaded from package: %s (binary)", sceneName.c_str());
+            return scene;
+        }
+        PX_LOG_WARNING(BUILD, "Binary scene rejected, loading the JSON scene instead: %s", sceneName.c_str());
+    }
+
     const nlohmann::json* sceneData = nullptr;
-    for (const std::pair<std::string, nlohmann::json>& scenePair : m_Package.GetScenes()) {
+    for (const std::pair<std::string, std::shared_ptr<const nlohmann::json>>& scenePair : m_Package.GetScenes()) {
         if (scenePair.first == sceneName) {
-            sceneData = &scenePair.second;
+            sceneData = scenePair.second.get();
             break;
         }
     }
@@ -65,9 +74,11 @@ std::unique_ptr<Scene> GamePackageLoader::LoadScene(const std::string& sceneName
     std::unique_ptr<Scene> scene = std::make_unique<Scene>(sceneName);
     entt::registry& registry = scene->GetRegistry();
 
-    EntityRegistry::Instance().Clear();
+    std::vector<std::pair<UUID, entt::entity>> indexEntries{};
+    const bool deltaEncoded = SceneSerializer::IsDeltaEncoded(*sceneData);
 
     if (sceneData->contains("entities") && (*sceneData)["entities"].is_array()) {
+        indexEntries.reserve((*sceneData)["entities"].size());
         for (const nlohmann::json& entityJson : (*sceneData)["entities"]) {
             entt::entity entity = registry.create();
 
@@ -76,50 +87,37 @@ std::unique_ptr<Scene> GamePackageLoader::LoadScene(const std::string& sceneName
                 uuid = UUID(entityJson["uuid"].get<uint64_t>());
             }
             registry.emplace<UUID>(entity, uuid);
-            EntityRegistry::Instance().RegisterEntity(uuid, entity);
-            scene->GetEntityOrder().push_back(entity);
-
-            ComponentRegistry& componentRegistry = ComponentRegistry::Instance();
-
-            for (auto it = entityJson.begin(); it != entityJson.end(); ++it) {
-                const std::string& componentName = it.key();
-                const nlohmann::json& componentData = it.value();
+            indexEntries.emplace_back(uuid, entity);
+            scene->GetEntityOrder().Add(entity);
 
-                if (componentName == "uuid") {
-                    continue;
-                }
-
-                if (componentName == "Scripts" && componentData.is_array()) {
-                    Script script{};
-                    for (const nlohmann::json& scriptJson : componentData) {
-                        std::string scriptName = scriptJson.value("scriptName", "");
-                        if (!scriptName.empty()) {
-                            script.AddScript(scriptName);
-                        }
-                    }
-                    if (script.GetScriptCount() > 0) {
-                        registry.emplace<Script>(entity, script);
-                    }
-                    continue;
-                }
+            SceneSerializer::DeserializeComponents(registry, entity, entityJson, deltaEncoded);
 
-                if (componentName == "Script") {
-                    Script script{};
-                    std::string scriptName = componentData.value("scriptName", "");
+            if (entityJson.contains("Scripts") && entityJson["Scripts"].is_array()) {
+                Script script{};
+                for (const nlohmann::json& scriptJson : entityJson["Scripts"]) {
+                    std::string scriptName = scriptJson.value("scriptName", "");
                     if (!scriptName.empty()) {
                         script.AddScript(scriptName);
-                        registry.emplace<Script>(entity, script);
                     }
-                    continue;
                 }
-
-                if (componentRegistry.HasComponent(componentName)) {
-                    componentRegistry.DeserializeComponent(componentName, registry, entity, componentData);
+                if (script.GetScriptCount() > 0) {
+                    registry.emplace<Script>(entity, script);
+                }
+            }
+            else if (entityJson.contains("Script")) {
+                Script script{};
+                std::string scriptName = entityJson["Script"].value("scriptName", "");
+                if (!scriptName.empty()) {
+                    script.AddScript(scriptName);
+                    registry.emplace<Script>(entity, script);
                 }
             }
         }
     }
 
+    // Scripts resolve EntityRefs from OnAwake, so the index has to be complete before they are attached.
+    scene->GetEntityIndex().RegisterEntities(indexEntries);
+
     if (scriptSystem && sceneData->contains("entities") && (*sceneData)["entities"].is_array()) {
         size_t entityIndex = 0;
         for (entt::entity entity : scene->GetEntityOrder()) {
@@ -142,29 +140,7 @@ std::unique_ptr<Scene> GamePackageLoader::LoadScene(const std::string& sceneName
 
                             if (script.instance) {
                                 script.instance->Initialize(entity, scene.get());
-
-                                if (scriptJson.contains("properties")) {
-                                    const nlohmann::json& propertiesJson = scriptJson["properties"];
-                                    const Reflection::TypeInfo* typeInfo =
-                                        Reflection::TypeRegistry::Instance().GetTypeInfo(typeid(*script.instance));
-
-                                    if (typeInfo) {
-                                        for (const Reflection::FieldInfo& field : typeInfo->GetFields()) {
-                                            if ((field.flags & Reflection::FieldFlags::Serializable) &&
-                                                propertiesJson.contains(field.name))
-                                            {
-                                                void* fieldPtr =
-                                                    field.getPtr(static_cast<void*>(script.instance.get()));
-                                                Reflection::JsonSerializer::DeserializeField(
-                                                    field, propertiesJson[field.name], fieldPtr);
-                                            }
-                                        }
-                                    }
-                                }
-
-                                if (scriptJson.contains("enabled")) {
-                                    script.instance->m_Enabled = scriptJson["enabled"].get<bool>();
-                                }
+                                SceneSerializer::ApplyScriptProperties(*script.instance, scriptJson);
                             }
                         }
                     }
@@ -179,29 +155,7 @@ std::unique_ptr<Scene> GamePackageLoader::LoadScene(const std::string& sceneName
 
                             if (script.instance) {
                                 script.instance->Initialize(entity, scene.get());
-
-                                if (scriptJson.contains("properties")) {
-                                    const nlohmann::json& propertiesJson = scriptJson["properties"];
-                                    const Reflection::TypeInfo* typeInfo =
-                                        Reflection::TypeRegistry::Instance().GetTypeInfo(typeid(*script.instance));
-
-                                    if (typeInfo) {
-                                        for (const Reflection::FieldInfo& field : typeInfo->GetFields()) {
-                                            if ((field.flags & Reflection::FieldFlags::Serializable) &&
-                                                propertiesJson.contains(field.name))
-                                            {
-                                                void* fieldPtr =
-                                                    field.getPtr(static_cast<void*>(script.instance.get()));
-                                                Reflection::JsonSerializer::DeserializeField(
-                                                    field, propertiesJson[field.name], fieldPtr);
-                                            }
-                                        }
-                                    }
-                                }
-
-                                if (scriptJson.contains("enabled")) {
-                                    script.instance->m_Enabled = scriptJson["enabled"].get<bool>();
-                                }
+                                SceneSerializer::ApplyScriptProperties(*script.instance, scriptJson);
                             }
                         }
                     }
@@ -212,6 +166,8 @@ std::unique_ptr<Scene> GamePackageLoader::LoadScene(const std::string& sceneName
         }
     }
 
+    scene->SetPreloadAssets(SceneSerializer::ReadPreloadManifest(*sceneData));
+
     PX_LOG_INFO(BUILD, "Scene loaded from package: %s", sceneName.c_str());
     return scene;
 }
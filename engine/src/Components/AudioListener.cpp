@@ -18,6 +18,7 @@ reflectionBuilder.Field("pauseOnFocusLoss", &ReflectedType::pauseOnFocusLoss);
 END_REFLECT_MODULE()
 
 AUTO_SERIALIZATION()
+RECORD_SERIALIZATION()
 
 #ifdef BUILD_WITH_EDITOR
 EDITOR_DISPLAY_ORDER(51)
@@ -50,7 +50,9 @@ module->SetSerializer([](const ReflectedType& source) -> nlohmann::json {
                           {"spatialBlend", source.spatialBlend},
                           {"minDistance", source.minDistance},
                           {"maxDistance", source.maxDistance},
-                          {"priority", source.priority}};
+                          {"priority", source.priority},
+                          {"bus", static_cast<int>(source.bus)},
+                          {"pendingPolicy", static_cast<int>(source.pendingPolicy)}};
 });
 
 module->SetDeserializer([](ReflectedType& source, const nlohmann::json& data) {
@@ -67,12 +69,42 @@ module->SetDeserializer([](ReflectedType& source, const nlohmann::json& data) {
     source.minDistance = data.value("minDistance", 1.0f);
     source.maxDistance = data.value("maxDistance", 500.0f);
     source.priority = data.value("priority", 128.0f);
+    source.bus = static_cast<AudioBus>(data.value("bus", static_cast<int>(AudioBus::Sfx)));
+    source.pendingPolicy = static_cast<AudioPendingPolicy>(data.value("pendingPolicy", 0));
+});
+
+module->SetRecordCodec([](const ReflectedType& source, ReflectedType& persistent) {
+    persistent.audioClip = source.audioClip;
+    persistent.playOnAwake = source.playOnAwake;
+    persistent.loop = source.loop;
+    persistent.mute = source.mute;
+    persistent.spatialize = source.spatialize;
+    persistent.volume = source.volume;
+    persistent.pitch = source.pitch;
+    persistent.spatialBlend = source.spatialBlend;
+    persistent.minDistance = source.minDistance;
+    persistent.maxDistance = source.maxDistance;
+    persistent.priority = source.priority;
+    persistent.bus = source.bus;
+    persistent.pendingPolicy = source.pendingPolicy;
 });
 
 #ifdef BUILD_WITH_EDITOR
 EDITOR_DISPLAY_ORDER(50)
 
 EDITOR_UI() {
+    const char* busNames[] = {"Master", "Music", "Sfx", "UI", "Ambience"};
+    int currentBus = static_cast<int>(component.bus);
+    if (ImGui::Combo("Bus", &currentBus, busNames, static_cast<int>(AudioBus::Count))) {
+        component.bus = static_cast<AudioBus>(currentBus);
+    }
+
+    const char* pendingPolicyNames[] = {"Delay", "Skip"};
+    int currentPolicy = static_cast<int>(component.pendingPolicy);
+    if (ImGui::Combo("If Not Loaded", &currentPolicy, pendingPolicyNames, 2)) {
+        component.pendingPolicy = static_cast<AudioPendingPolicy>(currentPolicy);
+    }
+
     ::PiiXeL::Reflection::ImGuiRenderer::RenderProperties(component, entityPicker, assetPicker);
 }
 EDITOR_UI_END()
@@ -103,6 +135,8 @@ EDITOR_DUPLICATE() {
     copy.minDistance = original.minDistance;
     copy.maxDistance = original.maxDistance;
     copy.priority = original.priority;
+    copy.bus = original.bus;
+    copy.pendingPolicy = original.pendingPolicy;
     return copy;
 }
 EDITOR_DUPLICATE_END()
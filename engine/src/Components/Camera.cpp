@@ -22,6 +22,7 @@ reflectionBuilder.Field("rotation", &ReflectedType::rotation,
 END_REFLECT_MODULE()
 
 AUTO_SERIALIZATION()
+RECORD_SERIALIZATION()
 
 #ifdef BUILD_WITH_EDITOR
 EDITOR_DISPLAY_ORDER(5)
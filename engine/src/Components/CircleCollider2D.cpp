@@ -18,6 +18,7 @@ reflectionBuilder.Field("isTrigger", &ReflectedType::isTrigger);
 END_REFLECT_MODULE()
 
 AUTO_SERIALIZATION()
+RECORD_SERIALIZATION()
 
 #ifdef BUILD_WITH_EDITOR
 EDITOR_DISPLAY_ORDER(30)
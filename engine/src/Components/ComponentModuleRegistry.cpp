@@ -9,6 +9,62 @@
 
 namespace PiiXeL {
 
+namespace {
+constexpr entt::id_type UuidKey{entt::hashed_string::value("uuid", 4)};
+constexpr entt::id_type ScriptsKey{entt::hashed_string::value("Scripts", 7)};
+constexpr entt::id_type ScriptKey{entt::hashed_string::value("Script", 6)};
+constexpr entt::id_type BaseKey{entt::hashed_string::value("base", 4)};
+
+bool IsEntityKey(entt::id_type nameHash) {
+    return nameHash == UuidKey || nameHash == ScriptsKey || nameHash == ScriptKey || nameHash == BaseKey;
+}
+
+// Members of a component object that differ from the base. Anything that is not an object is written whole.
+nlohmann::json DiffComponent(const nlohmann::json& component, const nlohmann::json& base) {
+    if (!component.is_object() || !base.is_object()) {
+        return component;
+    }
+
+    nlohmann::json delta = nlohmann::json::object();
+    for (auto it = component.begin(); it != component.end(); ++it) {
+        auto baseIt = base.find(it.key());
+        if (baseIt == base.end() || *baseIt != it.value()) {
+            delta[it.key()] = it.value();
+        }
+    }
+    return delta;
+}
+
+nlohmann::json ApplyComponentDelta(const nlohmann::json& delta, const nlohmann::json& base) {
+    if (!delta.is_object() || !base.is_object()) {
+        return delta;
+    }
+
+    nlohmann::json component = base;
+    for (auto it = delta.begin(); it != delta.end(); ++it) {
+        component[it.key()] = it.value();
+    }
+    return component;
+}
+} // namespace
+
+void ComponentModuleRegistry::RebuildHashTable() {
+    size_t capacity = 16;
+    while (capacity < m_AllModules.size() * 2) {
+        capacity *= 2;
+    }
+
+    m_HashTable.assign(capacity, nullptr);
+    const size_t mask = capacity - 1;
+    for (const std::shared_ptr<IComponentModule>& module : m_AllModules) {
+        size_t slot = module->GetNameHash() & mask;
+        while (m_HashTable[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        m_HashTable[slot] = module.get();
+    }
+}
+
 nlohmann::json ComponentModuleRegistry::SerializeEntity(entt::registry& registry, entt::entity entity) {
     nlohmann::json entityJson;
 
@@ -26,14 +82,76 @@ nlohmann::json ComponentModuleRegistry::SerializeEntity(entt::registry& registry
     return entityJson;
 }
 
-void ComponentModuleRegistry::DeserializeComponent(const std::string& componentName, entt::registry& registry,
-                                                   entt::entity entity, const nlohmann::json& data) {
-    IComponentModule* module = GetModuleByName(componentName);
-    if (module) {
-        module->Deserialize(registry, entity, data);
+void ComponentModuleRegistry::DeserializeEntity(entt::registry& registry, entt::entity entity,
+                                                const nlohmann::json& entityJson) {
+    for (auto it = entityJson.begin(); it != entityJson.end(); ++it) {
+        const std::string& componentName = it.key();
+        entt::id_type nameHash = HashName(componentName);
+        if (IComponentModule* module = GetModuleByName(componentName, nameHash)) {
+            module->Deserialize(registry, entity, it.value());
+        }
+        else if (!IsEntityKey(nameHash)) {
+            PX_LOG_WARNING(ENGINE, "ComponentModuleRegistry: Unknown component type '%s'", componentName.c_str());
+        }
     }
-    else {
-        PX_LOG_WARNING(ENGINE, "ComponentModuleRegistry: Unknown component type '%s'", componentName.c_str());
+}
+
+nlohmann::json ComponentModuleRegistry::SerializeEntityDelta(const entt::registry& registry, entt::entity entity,
+                                                             const nlohmann::json& base) const {
+    nlohmann::json entityJson = nlohmann::json::object();
+
+    for (const auto& module : m_AllModules) {
+        auto baseIt = base.find(module->GetName());
+        const bool inBase = baseIt != base.end();
+
+        if (!module->HasComponent(registry, entity)) {
+            if (inBase) {
+                entityJson[module->GetName()] = nullptr;
+            }
+            continue;
+        }
+
+        nlohmann::json componentJson = module->Serialize(registry, entity);
+        if (componentJson.empty() || (inBase && componentJson == *baseIt)) {
+            continue;
+        }
+
+        entityJson[module->GetName()] = DiffComponent(componentJson, inBase ? *baseIt : module->GetDefaultJson());
+    }
+
+    return entityJson;
+}
+
+void ComponentModuleRegistry::DeserializeEntityDelta(entt::registry& registry, entt::entity entity,
+                                                     const nlohmann::json& entityJson, const nlohmann::json& base) {
+    for (auto it = entityJson.begin(); it != entityJson.end(); ++it) {
+        const std::string& componentName = it.key();
+        entt::id_type nameHash = HashName(componentName);
+        IComponentModule* module = GetModuleByName(componentName, nameHash);
+        if (!module) {
+            if (!IsEntityKey(nameHash)) {
+                PX_LOG_WARNING(ENGINE, "ComponentModuleRegistry: Unknown component type '%s'", componentName.c_str());
+            }
+            continue;
+        }
+
+        // Removed from the base.
+        if (it.value().is_null()) {
+            continue;
+        }
+
+        auto baseIt = base.find(componentName);
+        const nlohmann::json& componentBase = baseIt != base.end() ? *baseIt : module->GetDefaultJson();
+        module->Deserialize(registry, entity, ApplyComponentDelta(it.value(), componentBase));
+    }
+
+    for (auto it = base.begin(); it != base.end(); ++it) {
+        if (entityJson.contains(it.key())) {
+            continue;
+        }
+        if (IComponentModule* module = GetModuleByName(it.key())) {
+            module->Deserialize(registry, entity, it.value());
+        }
     }
 }
 
@@ -83,7 +201,7 @@ void ComponentModuleRegistry::RenderInspectorForEntity(entt::registry& registry,
 void ComponentModuleRegistry::RenderAddComponentMenu(entt::registry& registry, entt::entity entity,
                                                      EditorCommandSystem& commandSystem) {
     for (const auto& module : m_AllModules) {
-        if (module->HasComponent(registry, entity)) {
+        if (!module->IsAddableFromMenu() || module->HasComponent(registry, entity)) {
             continue;
         }
 
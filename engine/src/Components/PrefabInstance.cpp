@@ -0,0 +1,31 @@
+#include "Components/PrefabInstance.hpp"
+
+#include "Components/ComponentModuleMacros.hpp"
+
+namespace PiiXeL {
+
+BEGIN_COMPONENT_MODULE(PrefabInstance)
+REFLECT_FIELDS()
+reflectionBuilder.Field("prefab", &ReflectedType::prefab,
+                        ::PiiXeL::Reflection::FieldFlags::Public | ::PiiXeL::Reflection::FieldFlags::Serializable |
+                            ::PiiXeL::Reflection::FieldFlags::AssetPicker,
+                        ::PiiXeL::Reflection::FieldMetadata{.assetType = "prefab"});
+END_REFLECT_MODULE()
+
+module->SetSerializer([](const ReflectedType& instance) -> nlohmann::json {
+    return nlohmann::json{{"prefab", instance.prefab.Get()}};
+});
+
+module->SetDeserializer([](ReflectedType& instance, const nlohmann::json& data) {
+    instance.prefab = UUID{data.value("prefab", uint64_t{0})};
+});
+
+RECORD_SERIALIZATION()
+
+#ifdef BUILD_WITH_EDITOR
+SKIP_REGISTRY_RENDER()
+HIDE_FROM_ADD_MENU()
+#endif
+END_COMPONENT_MODULE(PrefabInstance)
+
+} // namespace PiiXeL
@@ -45,6 +45,14 @@ module->SetDeserializer([](ReflectedType& rb, const nlohmann::json& data) {
     rb.box2dBodyId = b2_nullBodyId;
 });
 
+module->SetRecordCodec([](const ReflectedType& rb, ReflectedType& persistent) {
+    persistent.type = rb.type;
+    persistent.mass = rb.mass;
+    persistent.friction = rb.friction;
+    persistent.restitution = rb.restitution;
+    persistent.fixedRotation = rb.fixedRotation;
+});
+
 #ifdef BUILD_WITH_EDITOR
 EDITOR_DISPLAY_ORDER(20)
 
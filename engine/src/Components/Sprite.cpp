@@ -1,6 +1,6 @@
 #include "Components/Sprite.hpp"
 
-#include "Reflection/Reflection.hpp"
+#include "Components/ComponentModuleMacros.hpp"
 #include "Resources/AssetRegistry.hpp"
 #include "Resources/TextureAsset.hpp"
 
@@ -9,12 +9,77 @@
 
 namespace PiiXeL {
 
-BEGIN_REFLECT(Sprite)
-FIELD_ASSET(textureAssetUUID, "texture")
-FIELD(tint)
-FIELD(origin)
-FIELD(layer)
-END_REFLECT(Sprite)
+namespace {
+void PersistSprite(const Sprite& sprite, Sprite& persistent) {
+    persistent.textureAssetUUID = sprite.textureAssetUUID;
+    persistent.tint = sprite.tint;
+    persistent.sourceRect = sprite.sourceRect;
+    persistent.origin = sprite.origin;
+    persistent.layer = sprite.layer;
+}
+} // namespace
+
+BEGIN_COMPONENT_MODULE(Sprite)
+REFLECT_FIELDS()
+reflectionBuilder.Field("textureAssetUUID", &ReflectedType::textureAssetUUID,
+                        ::PiiXeL::Reflection::FieldFlags::Public | ::PiiXeL::Reflection::FieldFlags::Serializable |
+                            ::PiiXeL::Reflection::FieldFlags::AssetPicker,
+                        ::PiiXeL::Reflection::FieldMetadata{.assetType = "texture"});
+reflectionBuilder.Field("tint", &ReflectedType::tint);
+reflectionBuilder.Field("origin", &ReflectedType::origin);
+reflectionBuilder.Field("layer", &ReflectedType::layer);
+END_REFLECT_MODULE()
+
+module->SetSerializer([](const ReflectedType& sprite) -> nlohmann::json {
+    return nlohmann::json{
+        {"textureAssetUUID", sprite.textureAssetUUID.Get()},
+        {"sourceRect", {sprite.sourceRect.x, sprite.sourceRect.y, sprite.sourceRect.width, sprite.sourceRect.height}},
+        {"tint", {sprite.tint.r, sprite.tint.g, sprite.tint.b, sprite.tint.a}},
+        {"layer", sprite.layer},
+        {"origin", {sprite.origin.x, sprite.origin.y}}};
+});
+
+module->SetDeserializer([](ReflectedType& sprite, const nlohmann::json& data) {
+    if (data.contains("textureAssetUUID")) {
+        sprite.textureAssetUUID = UUID{data["textureAssetUUID"].get<uint64_t>()};
+    }
+
+    if (data.contains("sourceRect") && data["sourceRect"].is_array() && data["sourceRect"].size() == 4) {
+        sprite.sourceRect.x = data["sourceRect"][0].get<float>();
+        sprite.sourceRect.y = data["sourceRect"][1].get<float>();
+        sprite.sourceRect.width = data["sourceRect"][2].get<float>();
+        sprite.sourceRect.height = data["sourceRect"][3].get<float>();
+    }
+
+    if (data.contains("tint") && data["tint"].is_array() && data["tint"].size() == 4) {
+        sprite.tint.r = data["tint"][0].get<unsigned char>();
+        sprite.tint.g = data["tint"][1].get<unsigned char>();
+        sprite.tint.b = data["tint"][2].get<unsigned char>();
+        sprite.tint.a = data["tint"][3].get<unsigned char>();
+    }
+
+    sprite.layer = data.value("layer", 0);
+
+    if (data.contains("origin") && data["origin"].is_array() && data["origin"].size() == 2) {
+        sprite.origin.x = data["origin"][0].get<float>();
+        sprite.origin.y = data["origin"][1].get<float>();
+    }
+});
+
+module->SetRecordCodec(&PersistSprite);
+
+#ifdef BUILD_WITH_EDITOR
+EDITOR_DISPLAY_ORDER(10)
+SKIP_REGISTRY_RENDER()
+
+EDITOR_DUPLICATE() {
+    Sprite duplicate{};
+    PersistSprite(original, duplicate);
+    return duplicate;
+}
+EDITOR_DUPLICATE_END()
+#endif
+END_COMPONENT_MODULE(Sprite)
 
 Texture2D Sprite::GetTexture() const {
     if (textureAssetUUID.Get() == 0) {
@@ -85,8 +150,4 @@ void Sprite::SetTexture(UUID assetUUID) {
     }
 }
 
-namespace Reflection {
-void __force_link_Sprite() {}
-} // namespace Reflection
-
 } // namespace PiiXeL
@@ -3,12 +3,14 @@
 #include "Build/GamePackage.hpp"
 #include "Build/GamePackageLoader.hpp"
 #include "Core/Engine.hpp"
+#include "Core/JobSystem.hpp"
 #include "Core/Logger.hpp"
 #include "Debug/Profiler.hpp"
 #include "Project/ProjectSettings.hpp"
 #include "Resources/AssetManager.hpp"
 #include "Resources/PathManager.hpp"
 
+#include <algorithm>
 #include <raylib.h>
 
 #ifdef BUILD_WITH_EDITOR
@@ -48,6 +50,14 @@ void Application::Initialize() {
     SetExitKey(0);
 
 #ifndef BUILD_WITH_EDITOR
+    // A packaged game carries the project config it was built from; a loose build reads it from disk.
+    if (m_Config.packageLoader && m_Config.packageLoader->GetPackage().GetConfig().contains("project")) {
+        ProjectSettings::Instance().LoadFromJson(m_Config.packageLoader->GetPackage().GetConfig()["project"]);
+    }
+    else {
+        ProjectSettings::Instance().Load("game.config.json");
+    }
+
     if (m_Config.resizable) {
         SetConfigFlags(FLAG_WINDOW_RESIZABLE);
     }
@@ -126,10 +136,12 @@ void Application::Initialize() {
 
         if (!m_Initialized) {
             m_Engine = std::make_unique<Engine>();
+            m_Engine->SetAudioBackendType(m_Config.audioBackend);
             m_Engine->Initialize();
 
             ProjectSettings& settings = ProjectSettings::Instance();
             settings.ApplyToPhysics(m_Engine->GetPhysicsSystem());
+            settings.ApplyToAudio(m_Engine->GetAudioSystem());
 
             m_Engine->CreatePhysicsBodies();
             m_Engine->SetPhysicsEnabled(true);
@@ -205,6 +217,7 @@ void Application::Initialize() {
     io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
 
     m_Engine = std::make_unique<Engine>();
+    m_Engine->SetAudioBackendType(m_Config.audioBackend);
     m_Engine->Initialize();
 
     m_EditorLayer = std::make_unique<EditorLayer>(m_Engine.get());
@@ -212,6 +225,9 @@ void Application::Initialize() {
     m_Initialized = true;
 #endif
 
+    // The project settings have been loaded by now: by the editor layer in the editor, from the package at runtime.
+    JobSystem::Instance().Initialize(static_cast<uint32_t>(std::max(ProjectSettings::Instance().jobs.workerCount, 0)));
+
     m_Running = true;
 }
 
@@ -270,6 +286,8 @@ void Application::Run() {
 }
 
 void Application::Update(float deltaTime) {
+    JobSystem::Instance().RunMainThreadJobs();
+
     if (IsKeyPressed(KEY_F11)) {
         ToggleFullscreen();
         if (IsWindowFullscreen()) {
@@ -336,6 +354,7 @@ void Application::Cleanup() {
         m_Engine.reset();
     }
 
+    JobSystem::Instance().Shutdown();
     AssetManager::Instance().Shutdown();
 
 #ifdef BUILD_WITH_EDITOR
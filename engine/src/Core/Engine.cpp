@@ -1,17 +1,22 @@
 #include "Core/Engine.hpp"
 
 #include "Build/GamePackageLoader.hpp"
+#include "Components/Animator.hpp"
+#include "Components/AudioListener.hpp"
+#include "Components/AudioSource.hpp"
 #include "Components/BoxCollider2D.hpp"
 #include "Components/Camera.hpp"
 #include "Components/RigidBody2D.hpp"
 #include "Components/Script.hpp"
+#include "Components/Sprite.hpp"
 #include "Components/Transform.hpp"
 #include "Core/Logger.hpp"
 #include "Debug/Profiler.hpp"
 #include "Resources/AssetRegistry.hpp"
-#include "Scene/ComponentRegistry.hpp"
+#include "Scene/BinarySceneSerializer.hpp"
 #include "Scene/Scene.hpp"
 #include "Scene/SceneSerializer.hpp"
+#include "Scripting/Event.hpp"
 #include "Systems/AnimationSystem.hpp"
 #include "Systems/AudioSystem.hpp"
 #include "Systems/PhysicsSystem.hpp"
@@ -31,7 +36,7 @@ Engine::~Engine() {
 }
 
 void Engine::Initialize() {
-    RegisterAllComponents();
+    RegisterSystems();
 
     m_RenderSystem = std::make_unique<RenderSystem>();
     m_PhysicsSystem = std::make_unique<PhysicsSystem>();
@@ -40,6 +45,7 @@ void Engine::Initialize() {
     m_ScriptSystem = std::make_unique<ScriptSystem>();
 
     m_AudioSystem = std::make_unique<AudioSystem>();
+    m_AudioSystem->SetBackendType(m_AudioBackendType);
     m_AudioSystem->Initialize();
 
 #ifdef BUILD_WITH_EDITOR
@@ -76,60 +82,162 @@ void Engine::Initialize() {
 void Engine::Update(float deltaTime) {
     PROFILE_FUNCTION();
 
+    UpdateWorldPartition();
+    UpdateSceneLoads();
+
+    if (m_ActiveScene) {
+        m_Scheduler.Run(m_ActiveScene->GetRegistry(), deltaTime);
+    }
+
+    FlushEvents();
+
     {
-        PROFILE_SCOPE("Scene::OnUpdate");
+        PROFILE_SCOPE("Scene::FlushDestroyedEntities");
         if (m_ActiveScene) {
-            m_ActiveScene->OnUpdate(deltaTime);
+            m_ActiveScene->FlushDestroyedEntities();
         }
     }
+}
 
-    {
+// Audio runs ahead of animation: they only share the asset registry, and this order lets the physics step, which
+// has to wait for audio to read this frame's transforms, overlap with animation.
+void Engine::RegisterSystems() {
+    m_Scheduler.AddSystem("Scene::OnUpdate", SystemAccess{}.Exclusive(), [this](float deltaTime) {
+        PROFILE_SCOPE("Scene::OnUpdate");
+        m_ActiveScene->OnUpdate(deltaTime);
+    });
+
+    m_Scheduler.AddSystem("ScriptSystem::OnUpdate", SystemAccess{}.Exclusive(), [this](float deltaTime) {
         PROFILE_SCOPE("ScriptSystem::OnUpdate");
-        if (m_ScriptsEnabled && m_ScriptSystem && m_ActiveScene) {
+        if (m_ScriptsEnabled && m_ScriptSystem) {
             m_ScriptSystem->OnUpdate(m_ActiveScene.get(), deltaTime);
         }
-    }
-
-    {
+    });
+
+    SystemAccess audioAccess{};
+    audioAccess.Read<Transform, AudioListener>()
+        .Write<AudioSource>()
+        .WriteResource<AudioSystem, AssetRegistry>()
+        .MainThread();
+    m_Scheduler.AddSystem("AudioSystem::Update", audioAccess, [this](float deltaTime) {
+        PROFILE_SCOPE("AudioSystem::Update");
+        if (m_AudioEnabled && m_AudioSystem) {
+            m_AudioSystem->SetScene(m_ActiveScene.get());
+            m_AudioSystem->Update(deltaTime, m_ActiveScene->GetRegistry());
+        }
+    });
+
+    // Asset lookups may load textures, which needs the GL context of the main thread. Audio is main-thread too, so
+    // the two never overlap; only physics runs beside them. Moving pose evaluation to a worker would first need the
+    // controller, clip and sheet lookups split out, since AssetRegistry loads lazily and is not synchronized.
+    SystemAccess animationAccess{};
+    animationAccess.Write<Animator, Sprite>().WriteResource<AssetRegistry>().MainThread();
+    m_Scheduler.AddSystem("AnimationSystem::Update", animationAccess, [this](float deltaTime) {
         PROFILE_SCOPE("AnimationSystem::Update");
-        if (m_AnimationEnabled && m_ActiveScene) {
+        if (m_AnimationEnabled) {
             AnimationSystem::Update(m_ActiveScene->GetRegistry(), deltaTime);
         }
-    }
+    });
 
-    {
-        PROFILE_SCOPE("AudioSystem::Update");
-        if (m_AudioEnabled && m_AudioSystem && m_ActiveScene) {
-            m_AudioSystem->SetScene(m_ActiveScene.get());
-            m_AudioSystem->Update(deltaTime, m_ActiveScene->GetRegistry());
+    SystemAccess physicsAccess{};
+    physicsAccess.Write<Transform, RigidBody2D>().WriteResource<PhysicsSystem>();
+    m_Scheduler.AddSystem("PhysicsSystem::Update", physicsAccess, [this](float deltaTime) {
+        PROFILE_SCOPE("PhysicsSystem::Update");
+        if (m_PhysicsEnabled && m_PhysicsSystem) {
+            m_PhysicsSystem->SetScene(m_ActiveScene.get());
+            m_PhysicsSystem->Update(deltaTime, m_ActiveScene->GetRegistry());
+        }
+    });
+
+    // Collision callbacks and fixed updates run scripts, which can touch anything.
+    m_Scheduler.AddSystem("PhysicsSystem::Events", SystemAccess{}.Exclusive(), [this](float deltaTime) {
+        if (!m_PhysicsEnabled || !m_PhysicsSystem) {
+            return;
         }
+
+        {
+            PROFILE_SCOPE("PhysicsSystem::ProcessCollisionEvents");
+            m_PhysicsSystem->ProcessCollisionEvents(m_ActiveScene->GetRegistry());
+        }
+
+        FlushEvents();
+
+        {
+            PROFILE_SCOPE("ScriptSystem::OnFixedUpdate");
+            if (m_ScriptsEnabled && m_ScriptSystem) {
+                m_ScriptSystem->OnFixedUpdate(m_ActiveScene.get(), deltaTime);
+            }
+        }
+    });
+}
+
+void Engine::UpdateWorldPartition() {
+    if (!m_WorldPartition.IsOpen() || !m_ActiveScene) {
+        return;
     }
 
-    {
-        PROFILE_SCOPE("Physics");
-        if (m_PhysicsEnabled && m_PhysicsSystem && m_ActiveScene) {
-            m_PhysicsSystem->SetScene(m_ActiveScene.get());
+    entt::entity camera = FindPrimaryCamera();
+    if (camera == entt::null) {
+        return;
+    }
+
+    PROFILE_SCOPE("WorldPartition::Update");
+    const Vector2& focus = m_ActiveScene->GetRegistry().get<Transform>(camera).position;
+    for (const std::shared_ptr<SceneLoadOperation>& operation : m_WorldPartition.Update(focus, m_SceneLoader)) {
+        UnloadSubScene(*operation);
+    }
+}
+
+void Engine::UpdateSceneLoads() {
+    if (!m_SceneLoader.IsBusy()) {
+        return;
+    }
+
+    PROFILE_SCOPE("SceneLoader::Update");
+    for (const std::shared_ptr<SceneLoadOperation>& operation : m_SceneLoader.Update(m_ActiveScene.get())) {
+        if (operation->GetState() != SceneLoadState::Completed) {
+            continue;
+        }
 
-            {
-                PROFILE_SCOPE("PhysicsSystem::Update");
-                m_PhysicsSystem->Update(deltaTime, m_ActiveScene->GetRegistry());
+        if (operation->GetMode() == SceneLoadMode::Single) {
+            if (m_PhysicsEnabled) {
+                DestroyAllPhysicsBodies();
             }
 
-            {
-                PROFILE_SCOPE("PhysicsSystem::ProcessCollisionEvents");
-                m_PhysicsSystem->ProcessCollisionEvents(m_ActiveScene->GetRegistry());
+            SetActiveScene(operation->TakeScene());
+            m_PrimaryCameraCached = false;
+
+            AnimationSystem::ResetAnimators(m_ActiveScene->GetRegistry());
+            AudioSystem::ResetAudioSources(m_ActiveScene->GetRegistry());
+            if (m_PhysicsEnabled) {
+                CreatePhysicsBodies();
             }
+            continue;
+        }
 
-            {
-                PROFILE_SCOPE("ScriptSystem::OnFixedUpdate");
-                if (m_ScriptsEnabled && m_ScriptSystem) {
-                    m_ScriptSystem->OnFixedUpdate(m_ActiveScene.get(), deltaTime);
+        m_PrimaryCameraCached = false;
+        if (m_PhysicsEnabled && m_PhysicsSystem && m_ActiveScene) {
+            entt::registry& registry = m_ActiveScene->GetRegistry();
+            for (entt::entity entity : operation->GetEntities()) {
+                if (registry.valid(entity)) {
+                    m_PhysicsSystem->CreateBody(registry, entity);
                 }
             }
         }
     }
 }
 
+void Engine::FlushEvents() {
+    PROFILE_SCOPE("EventBus::Flush");
+    if (!m_ActiveScene) {
+        return;
+    }
+
+    if (EventBus* eventBus = m_ActiveScene->GetRegistry().ctx().find<EventBus>()) {
+        eventBus->Flush();
+    }
+}
+
 entt::entity Engine::FindPrimaryCamera() {
     if (!m_ActiveScene) {
         return entt::null;
@@ -203,6 +311,7 @@ void Engine::Render() {
 }
 
 void Engine::Shutdown() {
+    m_SceneLoader.Clear();
     m_ActiveScene.reset();
 
     if (m_PhysicsSystem) {
@@ -221,7 +330,15 @@ void Engine::Shutdown() {
 }
 
 void Engine::SetActiveScene(std::unique_ptr<Scene> scene) {
+    m_WorldPartition.Close();
     m_ActiveScene = std::move(scene);
+    PreloadSceneAudio();
+}
+
+void Engine::PreloadSceneAudio() {
+    if (m_AudioSystem && m_ActiveScene) {
+        m_AudioSystem->PreloadClips(m_ActiveScene->GetPreloadAssets());
+    }
 }
 
 void Engine::CreatePhysicsBodies() {
@@ -251,11 +368,74 @@ bool Engine::LoadSceneFromFile(const std::string& filepath) {
         return false;
     }
 
-    SceneSerializer serializer{m_ActiveScene.get()};
-    return serializer.Deserialize(filepath);
+    // Cell loads of a previous world would otherwise land in the new scene.
+    if (m_WorldPartition.IsOpen()) {
+        m_WorldPartition.Close();
+        m_SceneLoader.Clear();
+    }
+
+    if (filepath.ends_with(WorldPartition::FileExtension)) {
+        if (!m_WorldPartition.Open(filepath)) {
+            return false;
+        }
+
+        if (!m_WorldPartition.LoadPersistentChunk(*m_ActiveScene)) {
+            m_WorldPartition.Close();
+            return false;
+        }
+        m_PrimaryCameraCached = false;
+    }
+    else if (filepath.ends_with(BinarySceneSerializer::FileExtension)) {
+        BinarySceneSerializer serializer{m_ActiveScene.get()};
+        if (!serializer.Deserialize(filepath)) {
+            return false;
+        }
+    }
+    else {
+        SceneSerializer serializer{m_ActiveScene.get()};
+        if (!serializer.Deserialize(filepath)) {
+            return false;
+        }
+    }
+
+    PreloadSceneAudio();
+    return true;
+}
+
+std::shared_ptr<SceneLoadOperation> Engine::LoadSceneAsync(const std::string& scene, SceneLoadMode mode) {
+    if (m_PackageLoader && m_PackageLoader->IsLoaded()) {
+        for (const auto& [name, sceneData] : m_PackageLoader->GetPackage().GetScenes()) {
+            if (name == scene) {
+                return m_SceneLoader.LoadAsync(sceneData, scene, mode);
+            }
+        }
+    }
+
+    return m_SceneLoader.LoadAsync(scene, mode);
+}
+
+void Engine::UnloadSubScene(const SceneLoadOperation& operation) {
+    if (!m_ActiveScene || operation.GetMode() != SceneLoadMode::Additive) {
+        return;
+    }
+
+    entt::registry& registry = m_ActiveScene->GetRegistry();
+    for (entt::entity entity : operation.GetEntities()) {
+        if (!registry.valid(entity)) {
+            continue;
+        }
+
+        if (m_PhysicsSystem) {
+            m_PhysicsSystem->DestroyBody(registry, entity);
+        }
+        m_ActiveScene->DestroyEntity(entity);
+    }
+    m_PrimaryCameraCached = false;
 }
 
 bool Engine::LoadFromPackage(const std::string& packagePath, const std::string& sceneName) {
+    m_WorldPartition.Close();
+    m_SceneLoader.Clear();
     m_PackageLoader = std::make_unique<GamePackageLoader>();
 
     if (!m_PackageLoader->LoadPackage(packagePath)) {
@@ -266,7 +446,20 @@ bool Engine::LoadFromPackage(const std::string& packagePath, const std::string&
     AssetRegistry::Instance().Initialize();
     AssetRegistry::Instance().RegisterExtractedAssets();
 
-    m_ActiveScene = m_PackageLoader->LoadScene(sceneName, m_ScriptSystem.get());
+    // A partitioned scene starts from its persistent chunk and streams its cells from the package.
+    std::string manifestPath = "scenes/" + sceneName + WorldPartition::FileExtension;
+    if (m_PackageLoader->GetPackage().GetAsset(manifestPath)) {
+        m_ActiveScene = std::make_unique<Scene>(sceneName);
+        if (!m_WorldPartition.Open(m_PackageLoader->GetPackage(), manifestPath) ||
+            !m_WorldPartition.LoadPersistentChunk(*m_ActiveScene))
+        {
+            m_WorldPartition.Close();
+            m_ActiveScene.reset();
+        }
+    }
+    else {
+        m_ActiveScene = m_PackageLoader->LoadScene(sceneName, m_ScriptSystem.get());
+    }
     m_PrimaryCameraCached = false;
 
     if (m_ActiveScene) {
@@ -278,6 +471,7 @@ bool Engine::LoadFromPackage(const std::string& packagePath, const std::string&
         PX_LOG_INFO(ENGINE, "Scene loaded: %zu entities, %zu scripts, %zu cameras", entityCount, scriptCount,
                     cameraCount);
 
+        PreloadSceneAudio();
         return true;
     }
 
@@ -0,0 +1,297 @@
+#include "Core/JobSystem.hpp"
+
+#include "Core/Logger.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace PiiXeL {
+
+namespace {
+// Batches per thread for ParallelFor, so threads that finish early can steal the remainder.
+constexpr size_t BatchesPerThread{4};
+
+thread_local uint32_t t_ThreadIndex{0};
+} // namespace
+
+JobSystem& JobSystem::Instance() {
+    static JobSystem instance;
+    return instance;
+}
+
+JobSystem::~JobSystem() {
+    Shutdown();
+}
+
+void JobSystem::Initialize(uint32_t workerCount) {
+    if (!m_Workers.empty()) {
+        return;
+    }
+
+    if (workerCount == 0) {
+        uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+
+    m_MainThread = std::this_thread::get_id();
+    m_Stopping = false;
+
+    m_Queues.clear();
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        m_Queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    m_Workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+
+    PX_LOG_INFO(ENGINE, "Job system started with %u worker threads", workerCount);
+}
+
+void JobSystem::Shutdown() {
+    {
+        std::lock_guard<std::mutex> lock{m_SleepMutex};
+        m_Stopping = true;
+    }
+    m_WakeCondition.notify_all();
+
+    for (std::thread& worker : m_Workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    m_Workers.clear();
+    m_Queues.clear();
+}
+
+JobHandle JobSystem::Schedule(JobFunction job, std::span<const JobHandle> dependencies) {
+    JobHandle counter{new JobCounter{1}};
+    Enqueue(Job{std::move(job), counter, false}, dependencies);
+    return counter;
+}
+
+JobHandle JobSystem::ScheduleOnMainThread(JobFunction job, std::span<const JobHandle> dependencies) {
+    JobHandle counter{new JobCounter{1}};
+    Enqueue(Job{std::move(job), counter, true}, dependencies);
+    return counter;
+}
+
+JobHandle JobSystem::ParallelForAsync(size_t count, size_t batchSize, RangeFunction task,
+                                      std::span<const JobHandle> dependencies) {
+    batchSize = std::max<size_t>(batchSize, 1);
+    size_t batchCount = (count + batchSize - 1) / batchSize;
+    JobHandle counter{new JobCounter{static_cast<uint32_t>(batchCount)}};
+
+    std::shared_ptr<RangeFunction> shared = std::make_shared<RangeFunction>(std::move(task));
+    for (size_t begin = 0; begin < count; begin += batchSize) {
+        size_t end = std::min(begin + batchSize, count);
+        Enqueue(Job{[shared, begin, end]() { (*shared)(begin, end); }, counter, false}, dependencies);
+    }
+    return counter;
+}
+
+void JobSystem::ParallelFor(size_t count, const std::function<void(size_t)>& task) {
+    if (m_Queues.empty() || count <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    size_t batchCount = (m_Queues.size() + 1) * BatchesPerThread;
+    size_t batchSize = std::max<size_t>(count / batchCount, 1);
+    JobHandle handle = ParallelForAsync(count, batchSize, [&task](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            task(i);
+        }
+    });
+    Wait(handle);
+}
+
+void JobSystem::Wait(const JobHandle& handle) {
+    if (!handle) {
+        return;
+    }
+
+    bool mainThread = IsMainThread();
+    while (!handle->IsDone()) {
+        if (!TryRunJob(mainThread)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::RunMainThreadJobs() {
+    // Jobs queued by the ones run here wait for the next call, so a job that reschedules itself can't spin forever.
+    size_t count = 0;
+    {
+        std::lock_guard<std::mutex> lock{m_MainMutex};
+        count = m_MainJobs.size();
+    }
+
+    Job job{};
+    for (size_t i = 0; i < count && TryPopMainThreadJob(job); ++i) {
+        Execute(job);
+    }
+}
+
+uint32_t JobSystem::GetThreadIndex() {
+    return t_ThreadIndex;
+}
+
+void JobSystem::Enqueue(Job job, std::span<const JobHandle> dependencies) {
+    if (dependencies.empty()) {
+        Submit(std::move(job));
+        return;
+    }
+
+    // One extra count holds the job back until every dependency has been looked at.
+    std::shared_ptr<DeferredJob> deferred{
+        new DeferredJob{std::move(job), static_cast<uint32_t>(dependencies.size()) + 1}};
+    auto release = [this, deferred]() {
+        if (deferred->dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Submit(std::move(deferred->job));
+        }
+    };
+
+    for (const JobHandle& dependency : dependencies) {
+        if (dependency) {
+            std::lock_guard<std::mutex> lock{dependency->m_Mutex};
+            if (!dependency->m_Finished) {
+                dependency->m_Continuations.push_back(release);
+                continue;
+            }
+        }
+        release();
+    }
+    release();
+}
+
+void JobSystem::Submit(Job job) {
+    if (job.mainThread) {
+        std::lock_guard<std::mutex> lock{m_MainMutex};
+        m_MainJobs.push_back(std::move(job));
+        return;
+    }
+
+    if (m_Queues.empty()) {
+        Execute(job);
+        return;
+    }
+
+    // A worker keeps the jobs it spawns on its own deque; other threads spread theirs round-robin.
+    size_t queueIndex = t_ThreadIndex > 0 ? t_ThreadIndex - 1
+                                          : m_NextQueue.fetch_add(1, std::memory_order_relaxed) % m_Queues.size();
+    {
+        std::lock_guard<std::mutex> lock{m_Queues[queueIndex]->mutex};
+        m_Queues[queueIndex]->jobs.push_back(std::move(job));
+    }
+    m_QueuedJobs.fetch_add(1, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock{m_SleepMutex};
+    }
+    m_WakeCondition.notify_one();
+}
+
+bool JobSystem::TryRunJob(bool mainThread) {
+    Job job{};
+    if ((mainThread && TryPopMainThreadJob(job)) || TryPopWorkerJob(job)) {
+        Execute(job);
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::TryPopMainThreadJob(Job& job) {
+    std::lock_guard<std::mutex> lock{m_MainMutex};
+    if (m_MainJobs.empty()) {
+        return false;
+    }
+
+    job = std::move(m_MainJobs.front());
+    m_MainJobs.pop_front();
+    return true;
+}
+
+bool JobSystem::TryPopWorkerJob(Job& job) {
+    size_t queueCount = m_Queues.size();
+    if (queueCount == 0 || m_QueuedJobs.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+
+    if (t_ThreadIndex > 0) {
+        WorkerQueue& own = *m_Queues[t_ThreadIndex - 1];
+        std::lock_guard<std::mutex> lock{own.mutex};
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Steal the oldest job of another deque, starting after our own so thieves spread out.
+    for (size_t i = 1; i <= queueCount; ++i) {
+        WorkerQueue& victim = *m_Queues[(t_ThreadIndex + i - 1) % queueCount];
+        std::lock_guard<std::mutex> lock{victim.mutex};
+        if (!victim.jobs.empty()) {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::Execute(Job& job) {
+    // A throwing job still counts as finished, or everything waiting on its counter would hang.
+    try {
+        job.function();
+    }
+    catch (const std::exception& e) {
+        PX_LOG_ERROR(ENGINE, "Job threw an exception: %s", e.what());
+    }
+    catch (...) {
+        PX_LOG_ERROR(ENGINE, "Job threw an unknown exception");
+    }
+    Finish(job.counter);
+}
+
+void JobSystem::Finish(const JobHandle& counter) {
+    if (counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    std::vector<std::function<void()>> continuations{};
+    {
+        std::lock_guard<std::mutex> lock{counter->m_Mutex};
+        counter->m_Finished = true;
+        continuations.swap(counter->m_Continuations);
+    }
+
+    for (const std::function<void()>& release : continuations) {
+        release();
+    }
+}
+
+void JobSystem::WorkerLoop(uint32_t index) {
+    t_ThreadIndex = index + 1;
+
+    while (true) {
+        if (TryRunJob(false)) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{m_SleepMutex};
+        m_WakeCondition.wait(
+            lock, [this]() { return m_Stopping || m_QueuedJobs.load(std::memory_order_acquire) > 0; });
+        if (m_Stopping && m_QueuedJobs.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+} // namespace PiiXeL
@@ -0,0 +1,141 @@
+#include "Core/MappedFile.hpp"
+
+#include "Core/Logger.hpp"
+
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace PiiXeL {
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    m_Data{std::exchange(other.m_Data, nullptr)}, m_Size{std::exchange(other.m_Size, 0)}
+#ifdef _WIN32
+    ,
+    m_File{std::exchange(other.m_File, nullptr)}, m_Mapping{std::exchange(other.m_Mapping, nullptr)}
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        m_Data = std::exchange(other.m_Data, nullptr);
+        m_Size = std::exchange(other.m_Size, 0);
+#ifdef _WIN32
+        m_File = std::exchange(other.m_File, nullptr);
+        m_Mapping = std::exchange(other.m_Mapping, nullptr);
+#endif
+    }
+    return *this;
+}
+
+#ifdef _WIN32
+bool MappedFile::Open(const std::string& filepath) {
+    Close();
+
+    HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        PX_LOG_ERROR(ENGINE, "Failed to open file for mapping: %s", filepath.c_str());
+        return false;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        PX_LOG_ERROR(ENGINE, "Failed to map file: %s", filepath.c_str());
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        PX_LOG_ERROR(ENGINE, "Failed to map file: %s", filepath.c_str());
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_File = file;
+    m_Mapping = mapping;
+    m_Data = static_cast<const uint8_t*>(view);
+    m_Size = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (m_Data) {
+        UnmapViewOfFile(m_Data);
+    }
+    if (m_Mapping) {
+        CloseHandle(static_cast<HANDLE>(m_Mapping));
+    }
+    if (m_File) {
+        CloseHandle(static_cast<HANDLE>(m_File));
+    }
+
+    m_Data = nullptr;
+    m_Size = 0;
+    m_File = nullptr;
+    m_Mapping = nullptr;
+}
+#else
+bool MappedFile::Open(const std::string& filepath) {
+    Close();
+
+    int descriptor = open(filepath.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        PX_LOG_ERROR(ENGINE, "Failed to open file for mapping: %s", filepath.c_str());
+        return false;
+    }
+
+    struct stat fileStat{};
+    if (fstat(descriptor, &fileStat) != 0 || fileStat.st_size == 0) {
+        close(descriptor);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    // The mapping keeps its own reference to the file.
+    close(descriptor);
+
+    if (view == MAP_FAILED) {
+        PX_LOG_ERROR(ENGINE, "Failed to map file: %s", filepath.c_str());
+        return false;
+    }
+
+    madvise(view, size, MADV_SEQUENTIAL);
+    m_Data = static_cast<const uint8_t*>(view);
+    m_Size = size;
+    return true;
+}
+
+void MappedFile::Close() {
+    if (m_Data) {
+        munmap(const_cast<uint8_t*>(m_Data), m_Size);
+    }
+
+    m_Data = nullptr;
+    m_Size = 0;
+}
+#endif
+
+} // namespace PiiXeL
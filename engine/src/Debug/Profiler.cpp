@@ -3,12 +3,18 @@
 #include "Debug/Profiler.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <iomanip>
 #include <raylib.h>
 #include <sstream>
 
 namespace PiiXeL {
 
+namespace {
+// Start times of the scopes open on a thread other than the frame thread, innermost last.
+thread_local std::vector<std::chrono::high_resolution_clock::time_point> t_WorkerScopeStarts;
+} // namespace
+
 Profiler& Profiler::Instance() {
     static Profiler instance;
     return instance;
@@ -19,14 +25,30 @@ void Profiler::BeginFrame() {
         return;
 
     m_FrameStart = std::chrono::high_resolution_clock::now();
+    m_FrameThread = std::this_thread::get_id();
     m_CurrentDepth = 0;
 
+    {
+        std::lock_guard<std::mutex> lock{m_TimelineMutex};
+        m_PendingTimeline.clear();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{m_WorkerScopeMutex};
+        m_WorkerScopes.clear();
+    }
+
     for (auto& [name, data] : m_Scopes) {
         data.totalDuration = 0.0;
         data.callCount = 0;
         data.firstStartTime = 0.0;
         data.depth = 0;
     }
+
+    for (ScriptCostResult& cost : m_ScriptTypeCosts) {
+        cost.duration = 0.0;
+        cost.callCount = 0;
+    }
 }
 
 void Profiler::EndFrame() {
@@ -45,12 +67,41 @@ void Profiler::EndFrame() {
         }
     }
 
+    {
+        std::lock_guard<std::mutex> lock{m_WorkerScopeMutex};
+        for (const auto& [name, data] : m_WorkerScopes) {
+            m_Results.push_back({name, data.totalDuration, data.callCount, data.firstStartTime, data.depth});
+        }
+    }
+
     std::sort(m_Results.begin(), m_Results.end(),
               [](const ProfileResult& a, const ProfileResult& b) { return a.startTime < b.startTime; });
 
+    {
+        std::lock_guard<std::mutex> lock{m_TimelineMutex};
+        m_Timeline.swap(m_PendingTimeline);
+        m_PendingTimeline.clear();
+    }
+
+    std::sort(m_Timeline.begin(), m_Timeline.end(), [](const TimelineEvent& a, const TimelineEvent& b) {
+        return a.thread != b.thread ? a.thread < b.thread : a.startTime < b.startTime;
+    });
+
+    m_ScriptCosts.clear();
+    for (const ScriptCostResult& cost : m_ScriptTypeCosts) {
+        if (cost.callCount > 0) {
+            m_ScriptCosts.push_back(cost);
+        }
+    }
+
+    std::sort(m_ScriptCosts.begin(), m_ScriptCosts.end(),
+              [](const ScriptCostResult& a, const ScriptCostResult& b) { return a.duration > b.duration; });
+
     if (m_Recording) {
         FrameSnapshot snapshot;
         snapshot.results = m_Results;
+        snapshot.scriptCosts = m_ScriptCosts;
+        snapshot.timeline = m_Timeline;
         snapshot.frameTime = m_FrameTime;
         snapshot.fps = m_FPS;
 
@@ -66,6 +117,11 @@ void Profiler::BeginScope(const std::string& name) {
     if (!m_Enabled)
         return;
 
+    if (std::this_thread::get_id() != m_FrameThread) {
+        t_WorkerScopeStarts.push_back(std::chrono::high_resolution_clock::now());
+        return;
+    }
+
     auto now = std::chrono::high_resolution_clock::now();
     auto& scope = m_Scopes[name];
     scope.startTime = now;
@@ -83,6 +139,29 @@ void Profiler::EndScope(const std::string& name) {
     if (!m_Enabled)
         return;
 
+    if (std::this_thread::get_id() != m_FrameThread) {
+        // The scope may have opened before profiling was enabled.
+        if (t_WorkerScopeStarts.empty())
+            return;
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto startTime = t_WorkerScopeStarts.back();
+        t_WorkerScopeStarts.pop_back();
+
+        std::lock_guard<std::mutex> lock{m_WorkerScopeMutex};
+        auto& scope = m_WorkerScopes[name];
+        if (scope.callCount == 0) {
+            std::chrono::duration<double, std::milli> elapsed = startTime - m_FrameStart;
+            scope.firstStartTime = elapsed.count();
+            scope.depth = static_cast<int>(t_WorkerScopeStarts.size());
+        }
+
+        std::chrono::duration<double, std::milli> duration = endTime - startTime;
+        scope.totalDuration += duration.count();
+        scope.callCount++;
+        return;
+    }
+
     m_CurrentDepth--;
 
     auto endTime = std::chrono::high_resolution_clock::now();
@@ -93,25 +172,81 @@ void Profiler::EndScope(const std::string& name) {
     scope.callCount++;
 }
 
+void Profiler::AddTimelineEvent(const std::string& name, uint32_t thread,
+                                std::chrono::high_resolution_clock::time_point start,
+                                std::chrono::high_resolution_clock::time_point end) {
+    std::lock_guard<std::mutex> lock{m_TimelineMutex};
+    std::chrono::duration<double, std::milli> startTime = start - m_FrameStart;
+    std::chrono::duration<double, std::milli> duration = end - start;
+    m_PendingTimeline.push_back({name, thread, startTime.count(), duration.count()});
+}
+
+uint32_t Profiler::GetScriptTypeSlot(std::type_index type, const std::string& name) {
+    assert(m_FrameThread == std::thread::id{} || std::this_thread::get_id() == m_FrameThread);
+    auto [it, inserted] = m_ScriptTypeSlots.try_emplace(type, static_cast<uint32_t>(m_ScriptTypeCosts.size()));
+    if (inserted) {
+        m_ScriptTypeCosts.push_back({name.empty() ? std::string{type.name()} : name, 0.0, 0});
+    }
+    return it->second;
+}
+
+void Profiler::AddScriptCost(uint32_t slot, double duration, size_t callCount) {
+    if (!m_Enabled || slot >= m_ScriptTypeCosts.size())
+        return;
+
+    assert(std::this_thread::get_id() == m_FrameThread);
+    m_ScriptTypeCosts[slot].duration += duration;
+    m_ScriptTypeCosts[slot].callCount += callCount;
+}
+
 std::string Profiler::GetCurrentFrameAsText() const {
+    FrameSnapshot snapshot;
+    snapshot.results = m_Results;
+    snapshot.scriptCosts = m_ScriptCosts;
+    snapshot.timeline = m_Timeline;
+    snapshot.frameTime = m_FrameTime;
+    snapshot.fps = m_FPS;
+    return FormatFrame(snapshot);
+}
+
+std::string Profiler::FormatFrame(const FrameSnapshot& snapshot) {
     std::stringstream ss;
     ss << std::fixed << std::setprecision(3);
 
-    ss << "Frame Time: " << m_FrameTime << " ms\n";
-    ss << "FPS: " << std::setprecision(1) << m_FPS << "\n\n";
+    ss << "Frame Time: " << snapshot.frameTime << " ms\n";
+    ss << "FPS: " << std::setprecision(1) << snapshot.fps << "\n\n";
     ss << std::setprecision(3);
 
     ss << "Scope Timings:\n";
     ss << "----------------------------------------\n";
 
-    for (const ProfileResult& result : m_Results) {
-        float percentage = static_cast<float>(result.duration / m_FrameTime) * 100.0f;
+    for (const ProfileResult& result : snapshot.results) {
+        float percentage = static_cast<float>(result.duration / snapshot.frameTime) * 100.0f;
         ss << std::string(result.depth * 2, ' ');
         ss << result.name << ": " << result.duration << " ms (" << std::setprecision(1) << percentage << "%) ["
            << result.callCount << " calls]\n";
         ss << std::setprecision(3);
     }
 
+    if (!snapshot.scriptCosts.empty()) {
+        ss << "\nScript Costs:\n";
+        ss << "----------------------------------------\n";
+
+        for (const ScriptCostResult& cost : snapshot.scriptCosts) {
+            ss << cost.name << ": " << cost.duration << " ms [" << cost.callCount << " calls]\n";
+        }
+    }
+
+    if (!snapshot.timeline.empty()) {
+        ss << "\nSystem Timeline:\n";
+        ss << "----------------------------------------\n";
+
+        for (const TimelineEvent& event : snapshot.timeline) {
+            ss << (event.thread == 0 ? std::string{"Main"} : "Worker " + std::to_string(event.thread)) << " | "
+               << event.name << ": " << event.startTime << " ms +" << event.duration << " ms\n";
+        }
+    }
+
     return ss.str();
 }
 
@@ -47,7 +47,8 @@ void AssetBrowserPanel::RefreshAssetList() {
                            [](unsigned char c) { return static_cast<char>(::tolower(c)); });
 
             if (ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp" || ext == ".wav" || ext == ".mp3" ||
-                ext == ".ogg" || ext == ".spritesheet" || ext == ".animclip" || ext == ".animcontroller")
+                ext == ".ogg" || ext == ".spritesheet" || ext == ".animclip" || ext == ".animcontroller" ||
+                ext == ".prefab")
             {
                 std::string pxaPath = entry.path().string();
                 pxaPath = pxaPath.substr(0, pxaPath.find_last_of('.')) + ".pxa";
@@ -108,6 +108,7 @@ void AssetInspectorPanel::RenderAudioAsset(std::shared_ptr<Asset> asset) {
         return;
 
     ImGui::Text("Frames: %u", audioAsset->GetFrameCount());
+    ImGui::Text("Streaming: %s", audioAsset->IsStreaming() ? "Yes" : "No");
 
     ImGui::Separator();
 
@@ -121,6 +122,15 @@ void AssetInspectorPanel::RenderAudioAsset(std::shared_ptr<Asset> asset) {
             StopSound(sound);
         }
     }
+    else if (audioAsset->IsStreaming()) {
+        if (ImGui::Button("Play")) {
+            audioAsset->PlayStream(false);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Stop")) {
+            audioAsset->StopStream();
+        }
+    }
 }
 
 void AssetInspectorPanel::RenderGenericAsset(std::shared_ptr<Asset>) {
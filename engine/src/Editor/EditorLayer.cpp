@@ -151,6 +151,7 @@ EditorLayer::EditorLayer(Engine* engine) :
 
     SetTraceLogCallback(ConsoleLogger::RaylibLogCallback);
     ProjectSettings::Instance().Load("game.config.json");
+    ProjectSettings::Instance().ApplyToAudio(m_Engine->GetAudioSystem());
 
     LoadDefaultScene();
 }
@@ -5,20 +5,47 @@
 #include "Components/Script.hpp"
 #include "Core/Engine.hpp"
 #include "Core/Logger.hpp"
+#include "Project/ProjectSettings.hpp"
 #include "Reflection/Reflection.hpp"
+#include "Scene/BinarySceneSerializer.hpp"
 #include "Scene/Scene.hpp"
 #include "Scene/SceneSerializer.hpp"
+#include "Scene/WorldPartition.hpp"
 #include "Scripting/ScriptComponent.hpp"
 #include "Systems/ScriptSystem.hpp"
 
 #include <entt/entt.hpp>
 #include <nlohmann/json.hpp>
 
+#include <filesystem>
 #include <fstream>
 #include <raylib.h>
 
 namespace PiiXeL {
 
+namespace {
+// The binary copy next to the JSON scene is what runtime loads map; the JSON stays the editable source.
+void SaveBinaryScene(Scene* scene, const std::string& scenePath) {
+    std::filesystem::path binaryPath{scenePath};
+    binaryPath.replace_extension(BinarySceneSerializer::FileExtension);
+
+    BinarySceneSerializer serializer{scene};
+    serializer.Serialize(binaryPath.string());
+
+    const SceneSettings& settings = ProjectSettings::Instance().scenes;
+    if (settings.worldPartition) {
+        std::filesystem::path manifestPath{scenePath};
+        manifestPath.replace_extension(WorldPartition::FileExtension);
+
+        WorldPartitionSettings partition{};
+        partition.cellSize = settings.cellSize;
+        partition.loadRadius = settings.loadRadius;
+        partition.unloadRadius = settings.unloadRadius;
+        WorldPartition::Build(*scene, manifestPath.string(), partition);
+    }
+}
+} // namespace
+
 EditorSceneManager::EditorSceneManager(Engine* engine) : m_Engine{engine}, m_CurrentScenePath{} {}
 
 void EditorSceneManager::NewScene() {
@@ -43,7 +70,10 @@ void EditorSceneManager::SaveScene() {
     if (m_Engine && m_Engine->GetActiveScene()) {
         Scene* scene = m_Engine->GetActiveScene();
         SceneSerializer serializer{scene};
-        serializer.Serialize(m_CurrentScenePath);
+        serializer.SetDeltaEncoding(ProjectSettings::Instance().scenes.deltaEncoding);
+        if (serializer.Serialize(m_CurrentScenePath)) {
+            SaveBinaryScene(scene, m_CurrentScenePath);
+        }
     }
 }
 
@@ -64,7 +94,10 @@ void EditorSceneManager::SaveSceneAs() {
     m_CurrentScenePath = "content/scenes/" + filename + ".scene";
 
     SceneSerializer serializer{scene};
-    serializer.Serialize(m_CurrentScenePath);
+    serializer.SetDeltaEncoding(ProjectSettings::Instance().scenes.deltaEncoding);
+    if (serializer.Serialize(m_CurrentScenePath)) {
+        SaveBinaryScene(scene, m_CurrentScenePath);
+    }
 }
 
 void EditorSceneManager::LoadScene() {
@@ -108,7 +141,7 @@ void EditorSceneManager::RestoreScriptPropertiesFromFile(const std::string& file
         }
 
         size_t entityIndex = 0;
-        const std::vector<entt::entity>& entityOrder = scene->GetEntityOrder();
+        const EntityOrder& entityOrder = scene->GetEntityOrder();
 
         for (entt::entity entity : entityOrder) {
             if (entityIndex >= sceneJson["entities"].size())
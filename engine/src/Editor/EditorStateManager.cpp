@@ -2,26 +2,21 @@
 
 #include "Editor/EditorStateManager.hpp"
 
-#include "Components/Script.hpp"
 #include "Core/Engine.hpp"
 #include "Core/Logger.hpp"
 #include "Editor/EditorCommandSystem.hpp"
 #include "Editor/EditorSceneManager.hpp"
 #include "Editor/EditorSelectionManager.hpp"
-#include "Reflection/Reflection.hpp"
 #include "Scene/Scene.hpp"
-#include "Scene/SceneSerializer.hpp"
-#include "Scripting/ScriptComponent.hpp"
 #include "Systems/AnimationSystem.hpp"
 #include "Systems/AudioSystem.hpp"
 #include "Systems/ScriptSystem.hpp"
 
 #include <entt/entt.hpp>
-#include <nlohmann/json.hpp>
 
 namespace PiiXeL {
 
-EditorStateManager::EditorStateManager() : m_EditorState{EditorState::Edit}, m_PlayModeSnapshot{} {}
+EditorStateManager::EditorStateManager() : m_EditorState{EditorState::Edit} {}
 
 void EditorStateManager::OnPlayButtonPressed(Engine* engine, EditorSceneManager* sceneManager,
                                              EditorSelectionManager* selectionManager,
@@ -38,8 +33,7 @@ void EditorStateManager::OnPlayButtonPressed(Engine* engine, EditorSceneManager*
     }
 
     Scene* scene = engine->GetActiveScene();
-    SceneSerializer serializer{scene};
-    m_PlayModeSnapshot = serializer.SerializeToString();
+    m_PlayModeSnapshot.Capture(*scene);
 
     m_EditorState = EditorState::Play;
     commandSystem->Clear();
@@ -75,117 +69,12 @@ void EditorStateManager::OnStopButtonPressed(Engine* engine, EditorSelectionMana
     }
     engine->SetAudioEnabled(false);
 
-    if (!m_PlayModeSnapshot.empty()) {
-        SceneSerializer serializer{scene};
-        if (serializer.DeserializeFromString(m_PlayModeSnapshot)) {
-            m_EditorState = EditorState::Edit;
-            commandSystem->Clear();
-            selectionManager->SetSelectedEntity(entt::null);
-
-            if (engine->GetScriptSystem()) {
-                entt::registry& registry = scene->GetRegistry();
-                ScriptSystem* scriptSystem = engine->GetScriptSystem();
-
-                try {
-                    nlohmann::json snapshotJson = nlohmann::json::parse(m_PlayModeSnapshot);
-
-                    if (snapshotJson.contains("entities") && snapshotJson["entities"].is_array()) {
-                        size_t entityIndex = 0;
-                        const std::vector<entt::entity>& entityOrder = scene->GetEntityOrder();
-
-                        for (entt::entity entity : entityOrder) {
-                            if (entityIndex >= snapshotJson["entities"].size())
-                                break;
-
-                            const nlohmann::json& entityJson = snapshotJson["entities"][entityIndex];
-
-                            if (registry.all_of<Script>(entity)) {
-                                Script& scriptComponent = registry.get<Script>(entity);
-
-                                if (entityJson.contains("Scripts") && entityJson["Scripts"].is_array()) {
-                                    const nlohmann::json& scriptsArray = entityJson["Scripts"];
-                                    for (size_t i = 0; i < scriptComponent.scripts.size() && i < scriptsArray.size();
-                                         ++i)
-                                    {
-                                        const nlohmann::json& scriptJson = scriptsArray[i];
-                                        ScriptInstance& script = scriptComponent.scripts[i];
-
-                                        if (!script.scriptName.empty() && !script.instance) {
-                                            script.instance = scriptSystem->CreateScript(script.scriptName);
-                                            if (script.instance) {
-                                                script.instance->Initialize(entity, scene);
-
-                                                if (scriptJson.contains("properties")) {
-                                                    const nlohmann::json& propertiesJson = scriptJson["properties"];
-                                                    const Reflection::TypeInfo* typeInfo =
-                                                        Reflection::TypeRegistry::Instance().GetTypeInfo(
-                                                            typeid(*script.instance));
-
-                                                    if (typeInfo) {
-                                                        for (const Reflection::FieldInfo& field : typeInfo->GetFields())
-                                                        {
-                                                            if ((field.flags & Reflection::FieldFlags::Serializable) &&
-                                                                propertiesJson.contains(field.name))
-                                                            {
-                                                                void* fieldPtr = field.getPtr(
-                                                                    static_cast<void*>(script.instance.get()));
-                                                                Reflection::JsonSerializer::DeserializeField(
-                                                                    field, propertiesJson[field.name], fieldPtr);
-                                                            }
-                                                        }
-                                                    }
-                                                }
-                                            }
-                                        }
-                                    }
-                                }
-                                else if (entityJson.contains("Script")) {
-                                    const nlohmann::json& scriptJson = entityJson["Script"];
-                                    if (scriptComponent.scripts.size() > 0) {
-                                        ScriptInstance& script = scriptComponent.scripts[0];
-
-                                        if (!script.scriptName.empty() && !script.instance) {
-                                            script.instance = scriptSystem->CreateScript(script.scriptName);
-                                            if (script.instance) {
-                                                script.instance->Initialize(entity, scene);
-
-                                                if (scriptJson.contains("properties")) {
-                                                    const nlohmann::json& propertiesJson = scriptJson["properties"];
-                                                    const Reflection::TypeInfo* typeInfo =
-                                                        Reflection::TypeRegistry::Instance().GetTypeInfo(
-                                                            typeid(*script.instance));
-
-                                                    if (typeInfo) {
-                                                        for (const Reflection::FieldInfo& field : typeInfo->GetFields())
-                                                        {
-                                                            if ((field.flags & Reflection::FieldFlags::Serializable) &&
-                                                                propertiesJson.contains(field.name))
-                                                            {
-                                                                void* fieldPtr = field.getPtr(
-                                                                    static_cast<void*>(script.instance.get()));
-                                                                Reflection::JsonSerializer::DeserializeField(
-                                                                    field, propertiesJson[field.name], fieldPtr);
-                                                            }
-                                                        }
-                                                    }
-                                                }
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-
-                            entityIndex++;
-                        }
-                    }
-                }
-                catch (const nlohmann::json::exception& e) {
-                    PX_LOG_ERROR(EDITOR, "Failed to restore script properties: %s", e.what());
-                }
-            }
-
-            PX_LOG_INFO(EDITOR, "Scene restored from memory snapshot - edit mode");
-        }
+    if (m_PlayModeSnapshot.Restore(*scene)) {
+        m_EditorState = EditorState::Edit;
+        commandSystem->Clear();
+        selectionManager->SetSelectedEntity(entt::null);
+
+        PX_LOG_INFO(EDITOR, "Scene restored from memory snapshot - edit mode");
     }
     else {
         m_EditorState = EditorState::Edit;
@@ -119,6 +119,9 @@ void ContentBrowserPanel::OnImGuiRender() {
                     else if (info.extension == ".animcontroller") {
                         info.type = "animcontroller";
                     }
+                    else if (info.extension == ".prefab") {
+                        info.type = "prefab";
+                    }
                     else {
                         info.type = "unknown";
                     }
@@ -46,7 +46,7 @@ void HierarchyPanel::OnImGuiRender() {
 
         ImGui::Separator();
 
-        std::vector<entt::entity>& entityOrder = scene->GetEntityOrder();
+        EntityOrder& entityOrder = scene->GetEntityOrder();
 
         for (size_t i = 0; i < entityOrder.size(); ++i) {
             entt::entity entity = entityOrder[i];
@@ -82,12 +82,10 @@ void HierarchyPanel::OnImGuiRender() {
                         size_t targetIndex = i;
 
                         if (draggedIndex != targetIndex && draggedIndex < entityOrder.size()) {
-                            entt::entity draggedEntity = entityOrder[draggedIndex];
-                            entityOrder.erase(entityOrder.begin() + draggedIndex);
                             if (draggedIndex < targetIndex) {
                                 targetIndex--;
                             }
-                            entityOrder.insert(entityOrder.begin() + targetIndex, draggedEntity);
+                            entityOrder.Move(draggedIndex, targetIndex);
                         }
                     }
                 }
@@ -125,7 +123,7 @@ void HierarchyPanel::OnImGuiRender() {
                     if (*m_SelectedEntity == entity) {
                         *m_SelectedEntity = entt::null;
                     }
-                    scene->DestroyEntity(entity);
+                    scene->DestroyEntityImmediate(entity);
                 }
 
                 ImGui::EndPopup();
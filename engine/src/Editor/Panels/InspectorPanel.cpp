@@ -32,6 +32,7 @@
 #include <cinttypes>
 #include <cstring>
 #include <imgui.h>
+#include <iterator>
 #include <rlImGui.h>
 
 namespace PiiXeL {
@@ -124,6 +125,9 @@ void InspectorPanel::RenderAssetInspector() {
             case AssetType::AnimatorController:
                 typeStr = "Animator Controller";
                 break;
+            case AssetType::Prefab:
+                typeStr = "Prefab";
+                break;
             case AssetType::Scene:
                 typeStr = "Scene";
                 break;
@@ -170,6 +174,7 @@ void InspectorPanel::RenderAssetInspector() {
             AudioAsset* audioAsset = dynamic_cast<AudioAsset*>(asset.get());
             if (audioAsset) {
                 ImGui::Text("Frames: %u", audioAsset->GetFrameCount());
+                ImGui::Text("Streaming: %s", audioAsset->IsStreaming() ? "Yes" : "No");
 
                 ImGui::Separator();
 
@@ -183,6 +188,31 @@ void InspectorPanel::RenderAssetInspector() {
                         StopSound(sound);
                     }
                 }
+                else if (audioAsset->IsStreaming()) {
+                    if (ImGui::Button("Play")) {
+                        audioAsset->PlayStream(false);
+                    }
+                    ImGui::SameLine();
+                    if (ImGui::Button("Stop")) {
+                        audioAsset->StopStream();
+                    }
+                }
+
+                ImGui::Separator();
+
+                const char* loadTypes[] = {"Auto", "Decompress On Load", "Compressed In Memory", "Streaming"};
+                int loadType = static_cast<int>(metadata.importSettings);
+                if (loadType < 0 || loadType >= static_cast<int>(std::size(loadTypes))) {
+                    loadType = 0;
+                }
+                if (ImGui::Combo("Load Type", &loadType, loadTypes, static_cast<int>(std::size(loadTypes)))) {
+                    AssetRegistry::Instance().SetImportSettings(metadata.uuid, static_cast<uint32_t>(loadType));
+                }
+                ImGui::SameLine();
+                ImGui::TextDisabled("(?)");
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Auto streams clips of 1 MB or more and decodes the rest on load.");
+                }
             }
         }
         else if (metadata.type == AssetType::SpriteSheet) {
@@ -437,7 +467,7 @@ void InspectorPanel::RenderScriptComponent(entt::registry& registry, entt::entit
                                 continue;
                             void* fieldPtr = field.getPtr(static_cast<void*>(script.instance.get()));
                             Reflection::ImGuiRenderer::RenderField(field, fieldPtr, m_RenderEntityPickerCallback,
-                                                                   m_RenderAssetPickerCallback);
+                                                                   m_RenderAssetPickerCallback, &registry);
                         }
                     }
                 }
@@ -452,8 +482,11 @@ void InspectorPanel::RenderScriptComponent(entt::registry& registry, entt::entit
             ImGui::PopID();
         }
 
+        // Patched so the Script update signal tells the ScriptSystem's batch cache about the change.
         if (scriptToRemove >= 0) {
-            scriptComponent.RemoveScript(static_cast<size_t>(scriptToRemove));
+            registry.patch<Script>(entity, [scriptToRemove](Script& patched) {
+                patched.RemoveScript(static_cast<size_t>(scriptToRemove));
+            });
         }
 
         ImGui::Spacing();
@@ -473,7 +506,9 @@ void InspectorPanel::RenderScriptComponent(entt::registry& registry, entt::entit
                         std::shared_ptr<ScriptComponent> instance = scriptSystem->CreateScript(name);
                         if (instance) {
                             instance->Initialize(entity, m_Engine->GetActiveScene());
-                            scriptComponent.AddScript(instance, name);
+                            registry.patch<Script>(entity, [&instance, &name](Script& patched) {
+                                patched.AddScript(instance, name);
+                            });
                         }
                         ImGui::CloseCurrentPopup();
                     }
@@ -496,12 +531,6 @@ void InspectorPanel::RenderAddComponentMenu(entt::registry& registry, entt::enti
     }
 
     if (ImGui::BeginPopup("AddComponentPopup")) {
-        if (ImGui::MenuItem("Sprite")) {
-            if (!registry.all_of<Sprite>(entity)) {
-                m_CommandSystem->ExecuteCommand(
-                    std::make_unique<AddComponentCommand<Sprite>>(&registry, entity, Sprite{}));
-            }
-        }
         ComponentModuleRegistry::Instance().RenderAddComponentMenu(registry, entity, *m_CommandSystem);
 
         if (ImGui::MenuItem("Script")) {
@@ -6,9 +6,9 @@
 
 #include <algorithm>
 #include <imgui.h>
-#include <iomanip>
 #include <raylib.h>
-#include <sstream>
+#include <string>
+#include <vector>
 
 namespace PiiXeL {
 
@@ -45,6 +45,8 @@ void ProfilerPanel::OnImGuiRender() {
         *m_Paused = !*m_Paused;
         if (*m_Paused) {
             m_PausedSnapshot->results = profiler.GetResults();
+            m_PausedSnapshot->scriptCosts = profiler.GetScriptCosts();
+            m_PausedSnapshot->timeline = profiler.GetTimeline();
             m_PausedSnapshot->frameTime = profiler.GetFrameTime();
             m_PausedSnapshot->fps = profiler.GetFPS();
         }
@@ -61,23 +63,7 @@ void ProfilerPanel::OnImGuiRender() {
     ImGui::SameLine();
     if (ImGui::Button("Copy Frame")) {
         if (displaySnapshot) {
-            std::stringstream ss;
-            ss << std::fixed << std::setprecision(3);
-            ss << "Frame Time: " << displaySnapshot->frameTime << " ms\n";
-            ss << "FPS: " << std::setprecision(1) << displaySnapshot->fps << "\n\n";
-            ss << std::setprecision(3);
-            ss << "Scope Timings:\n";
-            ss << "----------------------------------------\n";
-
-            for (const ProfileResult& result : displaySnapshot->results) {
-                float percentage = static_cast<float>(result.duration / displaySnapshot->frameTime) * 100.0f;
-                ss << std::string(result.depth * 2, ' ');
-                ss << result.name << ": " << result.duration << " ms (" << std::setprecision(1) << percentage << "%) ["
-                   << result.callCount << " calls]\n";
-                ss << std::setprecision(3);
-            }
-
-            SetClipboardText(ss.str().c_str());
+            SetClipboardText(Profiler::FormatFrame(*displaySnapshot).c_str());
         }
         else {
             profiler.CopyFrameToClipboard();
@@ -117,14 +103,20 @@ void ProfilerPanel::OnImGuiRender() {
     ImGui::Separator();
 
     const std::vector<ProfileResult>* currentResults = nullptr;
+    const std::vector<ScriptCostResult>* currentScriptCosts = nullptr;
+    const std::vector<TimelineEvent>* currentTimeline = nullptr;
     double currentFrameTime = 0.0;
 
     if (displaySnapshot) {
         currentResults = &displaySnapshot->results;
+        currentScriptCosts = &displaySnapshot->scriptCosts;
+        currentTimeline = &displaySnapshot->timeline;
         currentFrameTime = displaySnapshot->frameTime;
     }
     else {
         currentResults = &profiler.GetResults();
+        currentScriptCosts = &profiler.GetScriptCosts();
+        currentTimeline = &profiler.GetTimeline();
         currentFrameTime = profiler.GetFrameTime();
     }
 
@@ -160,6 +152,73 @@ void ProfilerPanel::OnImGuiRender() {
             ImGui::EndTabItem();
         }
 
+        if (ImGui::BeginTabItem("Scripts")) {
+            if (currentScriptCosts->empty()) {
+                ImGui::Text("No script callbacks ran this frame.");
+            }
+            else if (ImGui::BeginTable("ScriptCostTable", 4,
+                                       ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable |
+                                           ImGuiTableFlags_Sortable))
+            {
+                ImGui::TableSetupColumn("Script", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableSetupColumn("Time (ms)",
+                                        ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultSort |
+                                            ImGuiTableColumnFlags_PreferSortDescending,
+                                        100.0f);
+                ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed, 60.0f);
+                ImGui::TableSetupColumn("Avg (us)", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+                ImGui::TableHeadersRow();
+
+                std::vector<ScriptCostResult> sortedCosts = *currentScriptCosts;
+                ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs();
+                if (sortSpecs && sortSpecs->SpecsCount > 0) {
+                    const ImGuiTableColumnSortSpecs& spec = sortSpecs->Specs[0];
+                    bool ascending = spec.SortDirection == ImGuiSortDirection_Ascending;
+                    auto average = [](const ScriptCostResult& cost) {
+                        return cost.callCount > 0 ? cost.duration / static_cast<double>(cost.callCount) : 0.0;
+                    };
+
+                    std::stable_sort(sortedCosts.begin(), sortedCosts.end(),
+                                     [&spec, ascending, &average](const ScriptCostResult& a, const ScriptCostResult& b) {
+                                         switch (spec.ColumnIndex) {
+                                             case 0:
+                                                 return ascending ? a.name < b.name : a.name > b.name;
+                                             case 2:
+                                                 return ascending ? a.callCount < b.callCount
+                                                                  : a.callCount > b.callCount;
+                                             case 3:
+                                                 return ascending ? average(a) < average(b) : average(a) > average(b);
+                                             default:
+                                                 return ascending ? a.duration < b.duration : a.duration > b.duration;
+                                         }
+                                     });
+                }
+
+                for (const ScriptCostResult& cost : sortedCosts) {
+                    ImGui::TableNextRow();
+
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::Text("%s", cost.name.c_str());
+
+                    ImGui::TableSetColumnIndex(1);
+                    float percentage = static_cast<float>(cost.duration / currentFrameTime) * 100.0f;
+                    ImGui::Text("%.3f (%.1f%%)", cost.duration, percentage);
+
+                    ImGui::TableSetColumnIndex(2);
+                    ImGui::Text("%zu", cost.callCount);
+
+                    ImGui::TableSetColumnIndex(3);
+                    double average = cost.callCount > 0 ? cost.duration * 1000.0 / static_cast<double>(cost.callCount)
+                                                        : 0.0;
+                    ImGui::Text("%.2f", average);
+                }
+
+                ImGui::EndTable();
+            }
+
+            ImGui::EndTabItem();
+        }
+
         if (ImGui::BeginTabItem("Flame Graph")) {
             if (*m_SelectedFrame >= 0) {
                 ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Viewing Frame: %d", *m_SelectedFrame);
@@ -272,6 +331,79 @@ void ProfilerPanel::OnImGuiRender() {
             ImGui::EndTabItem();
         }
 
+        if (ImGui::BeginTabItem("Timeline")) {
+            if (currentTimeline->empty()) {
+                ImGui::Text("No systems ran through the scheduler this frame.");
+            }
+            else {
+                uint32_t threadCount = 0;
+                for (const TimelineEvent& event : *currentTimeline) {
+                    threadCount = std::max(threadCount, event.thread + 1);
+                }
+
+                const float labelWidth = 80.0f;
+                const float laneHeight = 25.0f;
+
+                ImVec2 canvasPos = ImGui::GetCursorScreenPos();
+                ImVec2 canvasSize = ImGui::GetContentRegionAvail();
+                canvasSize.y = laneHeight * static_cast<float>(threadCount);
+
+                ImDrawList* drawList = ImGui::GetWindowDrawList();
+                drawList->AddRectFilled(canvasPos, ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
+                                        IM_COL32(20, 20, 20, 255));
+
+                for (uint32_t thread = 0; thread < threadCount; ++thread) {
+                    std::string label = thread == 0 ? std::string{"Main"} : "Worker " + std::to_string(thread);
+                    drawList->AddText(ImVec2(canvasPos.x + 4, canvasPos.y + thread * laneHeight + 4),
+                                      IM_COL32(200, 200, 200, 255), label.c_str());
+                }
+
+                float trackX = canvasPos.x + labelWidth;
+                float trackWidth = canvasSize.x - labelWidth;
+                float frameTime = static_cast<float>(currentFrameTime);
+
+                ImVec2 mousePos = ImGui::GetMousePos();
+                const TimelineEvent* hoveredEvent = nullptr;
+
+                for (const TimelineEvent& event : *currentTimeline) {
+                    float xStart = trackX + static_cast<float>(event.startTime / frameTime) * trackWidth;
+                    float width = std::max(static_cast<float>(event.duration / frameTime) * trackWidth, 1.0f);
+                    float yStart = canvasPos.y + event.thread * laneHeight;
+
+                    bool isHovered = mousePos.x >= xStart && mousePos.x <= xStart + width && mousePos.y >= yStart &&
+                                     mousePos.y <= yStart + laneHeight - 2;
+                    if (isHovered) {
+                        hoveredEvent = &event;
+                    }
+
+                    ImU32 color = event.thread == 0 ? IM_COL32(100, 150, 200, isHovered ? 255 : 200)
+                                                    : IM_COL32(120, 200, 120, isHovered ? 255 : 200);
+                    drawList->AddRectFilled(ImVec2(xStart, yStart), ImVec2(xStart + width, yStart + laneHeight - 2),
+                                            color);
+
+                    if (width > 30.0f) {
+                        drawList->PushClipRect(ImVec2(xStart, yStart), ImVec2(xStart + width, yStart + laneHeight),
+                                               true);
+                        drawList->AddText(ImVec2(xStart + 2, yStart + 4), IM_COL32(255, 255, 255, 255),
+                                          event.name.c_str());
+                        drawList->PopClipRect();
+                    }
+                }
+
+                ImGui::Dummy(canvasSize);
+
+                if (hoveredEvent) {
+                    ImGui::BeginTooltip();
+                    ImGui::Text("System: %s", hoveredEvent->name.c_str());
+                    ImGui::Text("Start: %.3f ms", hoveredEvent->startTime);
+                    ImGui::Text("Duration: %.3f ms", hoveredEvent->duration);
+                    ImGui::EndTooltip();
+                }
+            }
+
+            ImGui::EndTabItem();
+        }
+
         if (ImGui::BeginTabItem("History")) {
             const std::deque<FrameSnapshot>& history = profiler.GetFrameHistory();
 
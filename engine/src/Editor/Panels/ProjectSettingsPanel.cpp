@@ -63,6 +63,17 @@ void ProjectSettingsPanel::OnImGuiRender() {
                     settings.startScene = std::string(startScene);
                 }
 
+                ImGui::SeparatorText("Job System");
+
+                ImGui::DragInt("Worker Threads", &settings.jobs.workerCount, 0.1f, 0, 64);
+                ImGui::SameLine();
+                ImGui::TextDisabled("(?)");
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Threads that run engine jobs (system updates, asset imports).\n"
+                                      "0 starts one per CPU core besides the main thread.\n\n"
+                                      "Takes effect on the next launch.");
+                }
+
                 ImGui::EndTabItem();
             }
 
@@ -126,6 +137,53 @@ void ProjectSettingsPanel::OnImGuiRender() {
                 ImGui::EndTabItem();
             }
 
+            if (ImGui::BeginTabItem("Audio")) {
+                ImGui::SeparatorText("Audio Settings");
+
+                ImGui::DragInt("Max Voices", &settings.audio.maxVoices, 1.0f, 1, 256);
+
+                ImGui::Spacing();
+                if (ImGui::Button("Apply to Current Audio")) {
+                    if (m_Engine && m_Engine->GetAudioSystem()) {
+                        settings.ApplyToAudio(m_Engine->GetAudioSystem());
+                    }
+                }
+
+                ImGui::EndTabItem();
+            }
+
+            if (ImGui::BeginTabItem("Scenes")) {
+                ImGui::SeparatorText("Scene Files");
+
+                ImGui::Checkbox("Delta Encoding", &settings.scenes.deltaEncoding);
+                ImGui::SameLine();
+                ImGui::TextDisabled("(?)");
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Save only the component fields that differ from their defaults,\n"
+                                      "or from the prefab of a prefab instance.\n\n"
+                                      "Scenes in either encoding load regardless of this setting.");
+                }
+
+                ImGui::SeparatorText("World Partition");
+
+                ImGui::Checkbox("Build World Partition", &settings.scenes.worldPartition);
+                ImGui::SameLine();
+                ImGui::TextDisabled("(?)");
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Also save the scene as a grid of cells next to it (<scene>.partition).\n"
+                                      "Cells around the primary camera are streamed in and out at runtime.");
+                }
+
+                ImGui::BeginDisabled(!settings.scenes.worldPartition);
+                ImGui::DragFloat("Cell Size", &settings.scenes.cellSize, 16.0f, 64.0f, 65536.0f, "%.0f");
+                ImGui::DragInt("Load Radius", &settings.scenes.loadRadius, 0.1f, 0, 8);
+                ImGui::DragInt("Unload Radius", &settings.scenes.unloadRadius, 0.1f, settings.scenes.loadRadius + 1,
+                               9);
+                ImGui::EndDisabled();
+
+                ImGui::EndTabItem();
+            }
+
             if (ImGui::BeginTabItem("Build")) {
                 ImGui::SeparatorText("Build Settings");
 
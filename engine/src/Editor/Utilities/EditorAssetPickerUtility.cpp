@@ -61,7 +61,7 @@ bool EditorAssetPickerUtility::RenderEntityPicker(const char* label, entt::entit
         if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("ENTITY_REORDER")) {
             if (payload->DataSize == sizeof(size_t)) {
                 size_t draggedIndex = *static_cast<size_t*>(payload->Data);
-                const std::vector<entt::entity>& entityOrder = scene->GetEntityOrder();
+                const EntityOrder& entityOrder = scene->GetEntityOrder();
                 if (draggedIndex < entityOrder.size()) {
                     entt::entity draggedEntity = entityOrder[draggedIndex];
                     if (registry.valid(draggedEntity)) {
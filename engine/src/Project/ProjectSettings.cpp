@@ -1,9 +1,11 @@
 #include "Project/ProjectSettings.hpp"
 
+#include "Systems/AudioSystem.hpp"
 #include "Systems/PhysicsSystem.hpp"
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <raylib.h>
 
@@ -36,6 +38,12 @@ bool ProjectSettings::Load(const std::string& filepath) {
     }
     file.close();
 
+    LoadFromJson(json);
+    TraceLog(LOG_INFO, "Project settings loaded: %s", projectName.c_str());
+    return true;
+}
+
+void ProjectSettings::LoadFromJson(const nlohmann::json& json) {
     if (json.contains("projectName")) {
         projectName = json["projectName"].get<std::string>();
     }
@@ -87,12 +95,42 @@ bool ProjectSettings::Load(const std::string& filepath) {
         }
     }
 
+    if (json.contains("audio")) {
+        const nlohmann::json& audioJson = json["audio"];
+        if (audioJson.contains("maxVoices")) {
+            audio.maxVoices = audioJson["maxVoices"].get<int>();
+        }
+    }
+
+    if (json.contains("scenes")) {
+        const nlohmann::json& scenesJson = json["scenes"];
+        if (scenesJson.contains("deltaEncoding")) {
+            scenes.deltaEncoding = scenesJson["deltaEncoding"].get<bool>();
+        }
+        if (scenesJson.contains("worldPartition")) {
+            scenes.worldPartition = scenesJson["worldPartition"].get<bool>();
+        }
+        if (scenesJson.contains("cellSize")) {
+            scenes.cellSize = scenesJson["cellSize"].get<float>();
+        }
+        if (scenesJson.contains("loadRadius")) {
+            scenes.loadRadius = scenesJson["loadRadius"].get<int>();
+        }
+        if (scenesJson.contains("unloadRadius")) {
+            scenes.unloadRadius = scenesJson["unloadRadius"].get<int>();
+        }
+    }
+
+    if (json.contains("jobs")) {
+        const nlohmann::json& jobsJson = json["jobs"];
+        if (jobsJson.contains("workerCount")) {
+            jobs.workerCount = jobsJson["workerCount"].get<int>();
+        }
+    }
+
     if (json.contains("build")) {
         buildConfig = json["build"];
     }
-
-    TraceLog(LOG_INFO, "Project settings loaded: %s", projectName.c_str());
-    return true;
 }
 
 bool ProjectSettings::Save(const std::string& filepath) {
@@ -118,6 +156,16 @@ bool ProjectSettings::Save(const std::string& filepath) {
     json["physics"]["velocityIterations"] = physics.velocityIterations;
     json["physics"]["positionIterations"] = physics.positionIterations;
 
+    json["audio"]["maxVoices"] = audio.maxVoices;
+
+    json["scenes"]["deltaEncoding"] = scenes.deltaEncoding;
+    json["scenes"]["worldPartition"] = scenes.worldPartition;
+    json["scenes"]["cellSize"] = scenes.cellSize;
+    json["scenes"]["loadRadius"] = scenes.loadRadius;
+    json["scenes"]["unloadRadius"] = scenes.unloadRadius;
+
+    json["jobs"]["workerCount"] = jobs.workerCount;
+
     if (!buildConfig.is_null()) {
         json["build"] = buildConfig;
     }
@@ -141,4 +189,10 @@ void ProjectSettings::ApplyToPhysics(PhysicsSystem* physicsSystem) {
     }
 }
 
+void ProjectSettings::ApplyToAudio(AudioSystem* audioSystem) {
+    if (audioSystem) {
+        audioSystem->SetMaxVoices(static_cast<uint32_t>(std::max(audio.maxVoices, 1)));
+    }
+}
+
 } // namespace PiiXeL
@@ -11,7 +11,7 @@
 namespace PiiXeL::Reflection {
 
 bool ImGuiRenderer::RenderField(const FieldInfo& field, void* fieldPtr, EntityPickerCallback entityPicker,
-                                AssetPickerCallback assetPicker) {
+                                AssetPickerCallback assetPicker, const entt::registry* registry) {
     bool modified = false;
 
     switch (field.type) {
@@ -97,17 +97,20 @@ bool ImGuiRenderer::RenderField(const FieldInfo& field, void* fieldPtr, EntityPi
         }
 
         case FieldType::EntityRef: {
-            if (entityPicker && (field.flags & FieldFlags::EntityPicker)) {
-                EntityRef* value = static_cast<EntityRef*>(fieldPtr);
-                entt::entity entity = value->Get();
+            EntityRef* value = static_cast<EntityRef*>(fieldPtr);
+            if (!registry) {
+                ImGui::Text("%s: UUID(%llu)", field.name.c_str(),
+                            static_cast<unsigned long long>(value->GetUUID().Get()));
+            }
+            else if (entityPicker && (field.flags & FieldFlags::EntityPicker)) {
+                entt::entity entity = value->Get(*registry);
                 if (entityPicker(field.name.c_str(), &entity)) {
-                    value->Set(entity);
+                    value->Set(*registry, entity);
                     modified = true;
                 }
             }
             else {
-                EntityRef* value = static_cast<EntityRef*>(fieldPtr);
-                entt::entity entity = value->Get();
+                entt::entity entity = value->Get(*registry);
                 uint32_t entityId = static_cast<uint32_t>(entity);
                 ImGui::Text("%s: Entity(%u)", field.name.c_str(), entityId);
             }
@@ -12,6 +12,7 @@ void __force_link_CircleCollider2D();
 void __force_link_Animator();
 void __force_link_AudioSource();
 void __force_link_AudioListener();
+void __force_link_PrefabInstance();
 
 void InitializeReflection() {
     __force_link_Tag();
@@ -24,6 +25,7 @@ void InitializeReflection() {
     __force_link_Animator();
     __force_link_AudioSource();
     __force_link_AudioListener();
+    __force_link_PrefabInstance();
 }
 
 } // namespace PiiXeL::Reflection
@@ -1,5 +1,6 @@
 #include "Resources/AssetImporter.hpp"
 
+#include "Core/JobSystem.hpp"
 #include "Core/Logger.hpp"
 #include "Resources/AudioAsset.hpp"
 #include "Resources/TextureAsset.hpp"
@@ -38,26 +39,7 @@ AssetImporter::ImportResult AssetImporter::ImportAsset(const std::string& source
 
     UUID uuid = GetOrCreateUUID(sourcePath);
 
-    switch (type) {
-        case AssetType::Texture:
-            result = ImportTexture(sourcePath, uuid);
-            break;
-        case AssetType::Audio:
-            result = ImportAudio(sourcePath, uuid);
-            break;
-        case AssetType::SpriteSheet:
-            result = ImportSpriteSheet(sourcePath, uuid);
-            break;
-        case AssetType::AnimationClip:
-            result = ImportAnimationClip(sourcePath, uuid);
-            break;
-        case AssetType::AnimatorController:
-            result = ImportAnimatorController(sourcePath, uuid);
-            break;
-        default:
-            result.errorMessage = "Unsupported asset type";
-            break;
-    }
+    result = ImportSource(sourcePath, type, uuid);
 
     if (result.success) {
         SaveUUIDCache();
@@ -76,6 +58,7 @@ std::vector<AssetImporter::ImportResult> AssetImporter::ImportDirectory(const st
 
     LoadUUIDCache();
 
+    std::vector<std::string> sources{};
     if (recursive) {
         for (const auto& entry : std::filesystem::recursive_directory_iterator{directory}) {
             if (!entry.is_regular_file())
@@ -87,9 +70,8 @@ std::vector<AssetImporter::ImportResult> AssetImporter::ImportDirectory(const st
             if (ext == ".pxa")
                 continue;
 
-            AssetType type = DetectAssetType(path);
-            if (type != AssetType::Unknown) {
-                results.push_back(ImportAsset(path));
+            if (DetectAssetType(path) != AssetType::Unknown) {
+                sources.push_back(std::move(path));
             }
         }
     }
@@ -104,13 +86,34 @@ std::vector<AssetImporter::ImportResult> AssetImporter::ImportDirectory(const st
             if (ext == ".pxa")
                 continue;
 
-            AssetType type = DetectAssetType(path);
-            if (type != AssetType::Unknown) {
-                results.push_back(ImportAsset(path));
+            if (DetectAssetType(path) != AssetType::Unknown) {
+                sources.push_back(std::move(path));
             }
         }
     }
 
+    // Up-to-date checks and UUIDs go through the cache on this thread; encoding and writing a package only touches
+    // the asset's own files, so the stale assets import in parallel.
+    results.resize(sources.size());
+    std::vector<size_t> staleSources{};
+    for (size_t i = 0; i < sources.size(); ++i) {
+        const std::string& path = sources[i];
+        if (AssetPackage::PackageExists(path) && !AssetPackage::NeedsReimport(path)) {
+            PX_LOG_INFO(ASSET, "Asset is up to date: %s", path.c_str());
+            results[i].success = true;
+            results[i].packagePath = AssetPackage::GetPackagePath(path);
+            continue;
+        }
+
+        results[i].uuid = GetOrCreateUUID(path);
+        staleSources.push_back(i);
+    }
+
+    JobSystem::Instance().ParallelFor(staleSources.size(), [&](size_t i) {
+        size_t index = staleSources[i];
+        results[index] = ImportSource(sources[index], DetectAssetType(sources[index]), results[index].uuid);
+    });
+
     SaveUUIDCache();
 
     int successCount = static_cast<int>(
@@ -122,6 +125,36 @@ std::vector<AssetImporter::ImportResult> AssetImporter::ImportDirectory(const st
     return results;
 }
 
+AssetImporter::ImportResult AssetImporter::ImportSource(const std::string& sourcePath, AssetType type, UUID uuid) {
+    ImportResult result{};
+
+    switch (type) {
+        case AssetType::Texture:
+            result = ImportTexture(sourcePath, uuid);
+            break;
+        case AssetType::Audio:
+            result = ImportAudio(sourcePath, uuid);
+            break;
+        case AssetType::SpriteSheet:
+            result = ImportSpriteSheet(sourcePath, uuid);
+            break;
+        case AssetType::AnimationClip:
+            result = ImportAnimationClip(sourcePath, uuid);
+            break;
+        case AssetType::AnimatorController:
+            result = ImportAnimatorController(sourcePath, uuid);
+            break;
+        case AssetType::Prefab:
+            result = ImportPrefab(sourcePath, uuid);
+            break;
+        default:
+            result.errorMessage = "Unsupported asset type";
+            break;
+    }
+
+    return result;
+}
+
 AssetType AssetImporter::DetectAssetType(const std::string& path) const {
     std::filesystem::path fsPath{path};
     std::string ext = fsPath.extension().string();
@@ -152,6 +185,10 @@ AssetType AssetImporter::DetectAssetType(const std::string& path) const {
         return AssetType::AnimatorController;
     }
 
+    if (ext == ".prefab") {
+        return AssetType::Prefab;
+    }
+
     return AssetType::Unknown;
 }
 
@@ -305,6 +342,15 @@ AssetImporter::ImportResult AssetImporter::ImportAudio(const std::string& source
     metadata.name = std::filesystem::path{sourcePath}.stem().string();
     metadata.sourceFile = sourcePath;
     metadata.sourceExtension = std::filesystem::path{sourcePath}.extension().string();
+
+    // The load type chosen in the editor survives a reimport.
+    AssetMetadata previous{};
+    AssetPackage previousPackage{};
+    if (AssetPackage::PackageExists(sourcePath) &&
+        previousPackage.LoadMetadataOnly(AssetPackage::GetPackagePath(sourcePath), previous))
+    {
+        metadata.importSettings = previous.importSettings;
+    }
     metadata.importTimestamp =
         std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
@@ -487,4 +533,49 @@ AssetImporter::ImportResult AssetImporter::ImportAnimatorController(const std::s
     return result;
 }
 
+AssetImporter::ImportResult AssetImporter::ImportPrefab(const std::string& sourcePath, UUID uuid) {
+    ImportResult result{};
+    result.uuid = uuid;
+
+    std::ifstream file{sourcePath, std::ios::binary};
+    if (!file.is_open()) {
+        result.errorMessage = "Failed to open prefab file";
+        return result;
+    }
+
+    std::vector<uint8_t> data{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    file.close();
+
+    if (data.empty()) {
+        result.errorMessage = "Prefab file is empty";
+        return result;
+    }
+
+    AssetMetadata metadata{};
+    metadata.uuid = uuid;
+    metadata.type = AssetType::Prefab;
+    metadata.name = std::filesystem::path{sourcePath}.stem().string();
+    metadata.sourceFile = sourcePath;
+    metadata.sourceExtension = std::filesystem::path{sourcePath}.extension().string();
+    metadata.importTimestamp =
+        std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+    auto fileTime = GetFileLastWriteTime(sourcePath);
+    metadata.sourceTimestamp = std::chrono::duration_cast<std::chrono::seconds>(fileTime.time_since_epoch()).count();
+
+    std::string packagePath = AssetPackage::GetPackagePath(sourcePath);
+    AssetPackage package{};
+
+    if (!package.SaveToFile(packagePath, metadata, data.data(), data.size())) {
+        result.errorMessage = "Failed to save prefab package";
+        return result;
+    }
+
+    result.success = true;
+    result.packagePath = packagePath;
+    PX_LOG_INFO(ASSET, "Imported prefab: %s -> %s", sourcePath.c_str(), packagePath.c_str());
+
+    return result;
+}
+
 } // namespace PiiXeL
@@ -10,6 +10,15 @@
 
 namespace PiiXeL {
 
+// Packages written before import settings existed end after the version field.
+static uint32_t ParseImportSettings(const std::string& metadataStr, size_t versionPos) {
+    size_t settingsPos = metadataStr.find('|', versionPos);
+    if (settingsPos == std::string::npos) {
+        return 0;
+    }
+    return static_cast<uint32_t>(std::stoul(metadataStr.substr(settingsPos + 1)));
+}
+
 static std::string NormalizePath(const std::string& path) {
     std::string normalized = path;
     std::replace(normalized.begin(), normalized.end(), '\\', '/');
@@ -37,6 +46,9 @@ bool AssetPackage::SaveToFile(const std::string& path, const AssetMetadata& meta
     }
 
     std::string metadataStr = metadata.name + "|" + extension + "|" + std::to_string(metadata.version);
+    if (metadata.importSettings != 0) {
+        metadataStr += "|" + std::to_string(metadata.importSettings);
+    }
     header.metadataSize = metadataStr.size();
 
     if (!WriteHeader(file, header))
@@ -132,6 +144,7 @@ bool AssetPackage::LoadFromMemory(const uint8_t* data, size_t dataSize, AssetMet
     outMetadata.name = metadataStr.substr(0, pos1);
     outMetadata.sourceExtension = metadataStr.substr(pos1 + 1, pos2 - pos1 - 1);
     outMetadata.version = std::stoul(metadataStr.substr(pos2 + 1));
+    outMetadata.importSettings = ParseImportSettings(metadataStr, pos2 + 1);
 
     if (!pxaPath.empty()) {
         std::filesystem::path pxa{pxaPath};
@@ -269,6 +282,7 @@ bool AssetPackage::ReadMetadata(std::ifstream& stream, AssetMetadata& metadata,
     metadata.name = metadataStr.substr(0, pos1);
     metadata.sourceExtension = metadataStr.substr(pos1 + 1, pos2 - pos1 - 1);
     metadata.version = std::stoul(metadataStr.substr(pos2 + 1));
+    metadata.importSettings = ParseImportSettings(metadataStr, pos2 + 1);
 
     return true;
 }
@@ -5,6 +5,7 @@
 #include "Animation/SpriteSheet.hpp"
 #include "Core/Logger.hpp"
 #include "Resources/AudioAsset.hpp"
+#include "Resources/PrefabAsset.hpp"
 #include "Resources/TextureAsset.hpp"
 
 #include <cinttypes>
@@ -71,6 +72,7 @@ std::shared_ptr<Asset> AssetRegistry::LoadAsset(UUID uuid) {
                 asset->SetMetadata(metadata);
                 if (asset->Load(data.data(), data.size())) {
                     m_Assets[metadata.uuid] = asset;
+                    BumpSlot(metadata.uuid);
                     return asset;
                 }
             }
@@ -116,17 +118,72 @@ std::shared_ptr<Asset> AssetRegistry::GetAsset(UUID uuid) {
     return nullptr;
 }
 
+bool AssetRegistry::GetAssetSource(UUID uuid, AssetSource& outSource) const {
+    auto pathIt = m_UUIDToPath.find(uuid);
+    if (pathIt == m_UUIDToPath.end()) {
+        return false;
+    }
+
+    outSource.sourcePath = pathIt->second;
+    outSource.packageData.clear();
+    outSource.packagePath.clear();
+
+    auto cacheIt = m_PackageDataCache.find(uuid);
+    if (cacheIt != m_PackageDataCache.end()) {
+        outSource.packageData = cacheIt->second;
+    }
+    else {
+        outSource.packagePath = AssetPackage::GetPackagePath(pathIt->second);
+    }
+    return true;
+}
+
+std::shared_ptr<Asset> AssetRegistry::LoadAssetFromData(AssetMetadata metadata, const std::vector<uint8_t>& data) {
+    auto it = m_Assets.find(metadata.uuid);
+    if (it != m_Assets.end() && it->second->IsLoaded()) {
+        return it->second;
+    }
+
+    std::shared_ptr<Asset> asset = CreateAsset(metadata.type, metadata.uuid, metadata.name);
+    if (!asset) {
+        return nullptr;
+    }
+
+    asset->SetMetadata(metadata);
+    if (!asset->Load(data.data(), data.size())) {
+        return nullptr;
+    }
+
+    m_Assets[metadata.uuid] = asset;
+    BumpSlot(metadata.uuid);
+    return asset;
+}
+
+bool AssetRegistry::AddLoadedAsset(const std::shared_ptr<Asset>& asset) {
+    if (!asset || !asset->IsLoaded() || IsAssetLoaded(asset->GetUUID())) {
+        return false;
+    }
+
+    m_Assets[asset->GetUUID()] = asset;
+    BumpSlot(asset->GetUUID());
+    return true;
+}
+
 void AssetRegistry::UnloadAsset(UUID uuid) {
     auto it = m_Assets.find(uuid);
     if (it != m_Assets.end()) {
+        NotifyUnload(uuid);
         it->second->Unload();
         m_Assets.erase(it);
+        BumpSlot(uuid);
     }
 }
 
 void AssetRegistry::UnloadAll() {
     for (auto& [uuid, asset] : m_Assets) {
+        NotifyUnload(uuid);
         asset->Unload();
+        BumpSlot(uuid);
     }
     m_Assets.clear();
 }
@@ -158,9 +215,11 @@ void AssetRegistry::ReimportAsset(const std::string& sourcePath) {
     if (result.success) {
         auto it = m_Assets.find(result.uuid);
         if (it != m_Assets.end()) {
+            NotifyUnload(result.uuid);
             it->second->Unload();
             m_Assets.erase(it);
         }
+        BumpSlot(result.uuid);
 
         std::string normalizedPath = sourcePath;
         std::replace(normalizedPath.begin(), normalizedPath.end(), '\\', '/');
@@ -171,6 +230,35 @@ void AssetRegistry::ReimportAsset(const std::string& sourcePath) {
     }
 }
 
+bool AssetRegistry::SetImportSettings(UUID uuid, uint32_t importSettings) {
+    auto pathIt = m_UUIDToPath.find(uuid);
+    if (pathIt == m_UUIDToPath.end()) {
+        return false;
+    }
+
+    std::string packagePath = AssetPackage::GetPackagePath(pathIt->second);
+    AssetMetadata metadata{};
+    std::vector<uint8_t> data{};
+    AssetPackage package{};
+    if (!package.LoadFromFile(packagePath, metadata, data)) {
+        PX_LOG_ERROR(ASSET, "Failed to load package: %s", packagePath.c_str());
+        return false;
+    }
+
+    metadata.sourceFile = pathIt->second;
+    metadata.importSettings = importSettings;
+    if (!package.SaveToFile(packagePath, metadata, data.data(), data.size())) {
+        return false;
+    }
+    m_PackageDataCache.erase(uuid);
+
+    if (m_Assets.find(uuid) != m_Assets.end()) {
+        UnloadAsset(uuid);
+        LoadAsset(uuid);
+    }
+    return true;
+}
+
 void AssetRegistry::RegisterExtractedAssets() {
     PX_LOG_INFO(ASSET, "Scanning for .pxa assets in content/...");
 
@@ -300,6 +388,37 @@ size_t AssetRegistry::GetTotalMemoryUsage() const {
     return total;
 }
 
+uint32_t AssetRegistry::AddUnloadListener(UnloadListener listener) {
+    uint32_t listenerId = m_NextListenerId++;
+    m_UnloadListeners[listenerId] = std::move(listener);
+    return listenerId;
+}
+
+void AssetRegistry::RemoveUnloadListener(uint32_t listenerId) {
+    m_UnloadListeners.erase(listenerId);
+}
+
+uint32_t AssetRegistry::AcquireSlot(UUID uuid) {
+    auto [it, inserted] = m_Slots.try_emplace(uuid, static_cast<uint32_t>(m_SlotGenerations.size()));
+    if (inserted) {
+        m_SlotGenerations.push_back(1);
+    }
+    return it->second;
+}
+
+void AssetRegistry::BumpSlot(UUID uuid) {
+    auto it = m_Slots.find(uuid);
+    if (it != m_Slots.end()) {
+        ++m_SlotGenerations[it->second];
+    }
+}
+
+void AssetRegistry::NotifyUnload(UUID uuid) {
+    for (const auto& [listenerId, listener] : m_UnloadListeners) {
+        listener(uuid);
+    }
+}
+
 AssetRegistry& AssetRegistry::Instance() {
     static AssetRegistry instance{};
     return instance;
@@ -317,6 +436,8 @@ std::shared_ptr<Asset> AssetRegistry::CreateAsset(AssetType type, UUID uuid, con
             return std::make_shared<AnimationClip>(uuid, name);
         case AssetType::AnimatorController:
             return std::make_shared<AnimatorController>(uuid, name);
+        case AssetType::Prefab:
+            return std::make_shared<PrefabAsset>(uuid, name);
         default:
             PX_LOG_ERROR(ASSET, "Unsupported asset type: %d", static_cast<int>(type));
             return nullptr;
@@ -353,6 +474,7 @@ std::shared_ptr<Asset> AssetRegistry::LoadAssetFromPackage(const std::string& pa
     m_Assets[metadata.uuid] = asset;
     m_UUIDToPath[metadata.uuid] = normalizedPath;
     m_PathToUUID[normalizedPath] = metadata.uuid;
+    BumpSlot(metadata.uuid);
 
     PX_LOG_INFO(ASSET, "Loaded asset: %s (UUID: %" PRIu64 ")", metadata.name.c_str(), metadata.uuid.Get());
     return asset;
@@ -1,5 +1,6 @@
 #include "Resources/AudioAsset.hpp"
 
+#include "Audio/AudioStreamPump.hpp"
 #include "Core/Logger.hpp"
 
 #include <algorithm>
@@ -8,6 +9,8 @@
 
 namespace PiiXeL {
 
+uint32_t AudioAsset::s_PcmSampleRate{0};
+
 AudioAsset::AudioAsset(UUID uuid, const std::string& name) : Asset{uuid, AssetType::Audio, name} {
     m_Format = DetectAudioFormat(m_Metadata.sourceExtension);
 }
@@ -17,64 +20,179 @@ AudioAsset::~AudioAsset() {
 }
 
 bool AudioAsset::Load(const void* data, size_t size) {
+    return Decode(data, size, s_PcmSampleRate) && FinishLoad();
+}
+
+bool AudioAsset::Decode(const void* data, size_t size, uint32_t pcmSampleRate) {
     if (m_IsLoaded) {
         Unload();
     }
+    DiscardDecoded();
 
     if (m_Format == AudioFormat::Unknown) {
         m_Format = DetectAudioFormat(m_Metadata.sourceExtension);
     }
 
-    const char* fileExt = ".wav";
-    switch (m_Format) {
-        case AudioFormat::WAV:
-            fileExt = ".wav";
-            break;
-        case AudioFormat::OGG:
-            fileExt = ".ogg";
-            break;
-        case AudioFormat::MP3:
-            fileExt = ".mp3";
-            break;
-        case AudioFormat::FLAC:
-            fileExt = ".flac";
-            break;
-        default:
-            PX_LOG_ERROR(ASSET, "Unsupported audio format for asset: %s", m_Metadata.name.c_str());
-            return false;
+    const char* fileExt = GetDecoderExtension(m_Format);
+    if (!fileExt) {
+        PX_LOG_ERROR(ASSET, "Unsupported audio format for asset: %s", m_Metadata.name.c_str());
+        return false;
+    }
+
+    if (pcmSampleRate > 0) {
+        return DecodePcm(fileExt, data, size, pcmSampleRate);
+    }
+
+    AudioLoadType loadType = GetLoadType();
+    if (loadType == AudioLoadType::Streaming || (loadType == AudioLoadType::Auto && size >= StreamingThreshold)) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        m_EncodedData.assign(bytes, bytes + size);
+        return true;
     }
 
-    m_Wave = LoadWaveFromMemory(fileExt, static_cast<const unsigned char*>(data), static_cast<int>(size));
+    m_DecodedWave = LoadWaveFromMemory(fileExt, static_cast<const unsigned char*>(data), static_cast<int>(size));
 
-    if (m_Wave.data == nullptr) {
+    if (m_DecodedWave.data == nullptr) {
         PX_LOG_ERROR(ASSET, "Failed to load audio from memory: %s", m_Metadata.name.c_str());
+        m_DecodedWave = Wave{};
+        return false;
+    }
+
+    m_FrameCount = m_DecodedWave.frameCount;
+    m_SampleRate = m_DecodedWave.sampleRate;
+    m_Channels = m_DecodedWave.channels;
+    return true;
+}
+
+AudioLoadType AudioAsset::GetLoadType() const {
+    const uint32_t stored = m_Metadata.importSettings;
+    if (m_LoadType != AudioLoadType::Auto || stored > static_cast<uint32_t>(AudioLoadType::Streaming)) {
+        return m_LoadType;
+    }
+    return static_cast<AudioLoadType>(stored);
+}
+
+bool AudioAsset::FinishLoad() {
+    if (!m_EncodedData.empty()) {
+        return LoadStream(GetDecoderExtension(m_Format));
+    }
+
+    if (!m_Pcm.empty()) {
+        m_IsLoaded = true;
+        PX_LOG_INFO(ASSET, "Audio asset decoded to PCM: %s (%.2fs, %zu frames)", m_Metadata.name.c_str(),
+                    GetLength(), m_Pcm.size() / 2);
+        return true;
+    }
+
+    if (m_DecodedWave.data == nullptr) {
         return false;
     }
 
-    m_Sound = LoadSoundFromWave(m_Wave);
+    m_Sound = LoadSoundFromWave(m_DecodedWave);
+    UnloadWave(m_DecodedWave);
+    m_DecodedWave = Wave{};
 
     if (m_Sound.frameCount == 0) {
         PX_LOG_ERROR(ASSET, "Failed to create sound from wave: %s", m_Metadata.name.c_str());
-        UnloadWave(m_Wave);
+        m_Sound = Sound{};
         return false;
     }
 
     m_IsLoaded = true;
     PX_LOG_INFO(ASSET, "Audio asset loaded: %s (%u frames, %.2fs, %uHz, %u channels)", m_Metadata.name.c_str(),
-                m_Sound.frameCount, GetLength(), GetSampleRate(), GetChannels());
+                m_FrameCount, GetLength(), GetSampleRate(), GetChannels());
+    return true;
+}
+
+void AudioAsset::DiscardDecoded() {
+    if (m_DecodedWave.data != nullptr) {
+        UnloadWave(m_DecodedWave);
+        m_DecodedWave = Wave{};
+    }
+    if (!m_IsLoaded) {
+        m_Pcm.clear();
+        m_Pcm.shrink_to_fit();
+        m_EncodedData.clear();
+        m_EncodedData.shrink_to_fit();
+    }
+}
+
+bool AudioAsset::DecodePcm(const char* fileExt, const void* data, size_t size, uint32_t pcmSampleRate) {
+    Wave wave = LoadWaveFromMemory(fileExt, static_cast<const unsigned char*>(data), static_cast<int>(size));
+
+    if (wave.data == nullptr) {
+        PX_LOG_ERROR(ASSET, "Failed to load audio from memory: %s", m_Metadata.name.c_str());
+        return false;
+    }
+
+    m_FrameCount = wave.frameCount;
+    m_SampleRate = wave.sampleRate;
+    m_Channels = wave.channels;
+
+    WaveFormat(&wave, static_cast<int>(pcmSampleRate), 32, 2);
+    float* samples = LoadWaveSamples(wave);
+    if (samples) {
+        m_Pcm.assign(samples, samples + static_cast<size_t>(wave.frameCount) * 2);
+        UnloadWaveSamples(samples);
+    }
+    UnloadWave(wave);
+
+    if (m_Pcm.empty()) {
+        PX_LOG_ERROR(ASSET, "Failed to decode PCM samples: %s", m_Metadata.name.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool AudioAsset::LoadStream(const char* fileExt) {
+    m_Music = LoadMusicStreamFromMemory(fileExt, m_EncodedData.data(), static_cast<int>(m_EncodedData.size()));
+    if (m_Music.frameCount == 0 || m_Music.stream.buffer == nullptr) {
+        PX_LOG_ERROR(ASSET, "Failed to open audio stream: %s", m_Metadata.name.c_str());
+        m_Music = Music{};
+        m_EncodedData.clear();
+        m_EncodedData.shrink_to_fit();
+        return false;
+    }
+
+    m_FrameCount = m_Music.frameCount;
+    m_SampleRate = m_Music.stream.sampleRate;
+    m_Channels = m_Music.stream.channels;
+    m_IsStreaming = true;
+    m_IsLoaded = true;
+
+    AudioStreamPump::Instance().Register(this);
+
+    PX_LOG_INFO(ASSET, "Audio asset streaming: %s (%.2fs, %uHz, %u channels, %zu bytes resident)",
+                m_Metadata.name.c_str(), GetLength(), GetSampleRate(), GetChannels(), GetMemoryUsage());
     return true;
 }
 
 void AudioAsset::Unload() {
+    DiscardDecoded();
+
     if (m_IsLoaded) {
+        if (m_IsStreaming) {
+            AudioStreamPump::Instance().Unregister(this);
+
+            std::lock_guard<std::mutex> lock{m_StreamMutex};
+            StopMusicStream(m_Music);
+            UnloadMusicStream(m_Music);
+            m_Music = Music{};
+            m_EncodedData.clear();
+            m_EncodedData.shrink_to_fit();
+            m_IsStreaming = false;
+            m_IsStreamPaused = false;
+        }
         if (m_Sound.frameCount > 0) {
             UnloadSound(m_Sound);
             m_Sound = Sound{};
         }
-        if (m_Wave.data != nullptr) {
-            UnloadWave(m_Wave);
-            m_Wave = Wave{};
-        }
+        m_Pcm.clear();
+        m_Pcm.shrink_to_fit();
+        m_FrameCount = 0;
+        m_SampleRate = 0;
+        m_Channels = 0;
         m_IsLoaded = false;
     }
 }
@@ -82,25 +200,126 @@ void AudioAsset::Unload() {
 size_t AudioAsset::GetMemoryUsage() const {
     if (!m_IsLoaded)
         return 0;
-    return m_Wave.frameCount * m_Wave.channels * (m_Wave.sampleSize / 8);
+
+    if (m_IsStreaming) {
+        const AudioStream& stream = m_Music.stream;
+        size_t ringFrames = static_cast<size_t>(stream.sampleRate / 30) * 2;
+        return m_EncodedData.size() + ringFrames * stream.channels * (stream.sampleSize / 8);
+    }
+
+    return m_Pcm.size() * sizeof(float) +
+           static_cast<size_t>(m_Sound.frameCount) * m_Sound.stream.channels * (m_Sound.stream.sampleSize / 8);
+}
+
+void AudioAsset::PlayStream(bool loop) {
+    if (!m_IsStreaming)
+        return;
+
+    std::lock_guard<std::mutex> lock{m_StreamMutex};
+    StopMusicStream(m_Music);
+    m_Music.looping = loop;
+    m_IsStreamPaused = false;
+    PlayMusicStream(m_Music);
+    UpdateMusicStream(m_Music);
+}
+
+void AudioAsset::PauseStream() {
+    if (!m_IsStreaming)
+        return;
+
+    std::lock_guard<std::mutex> lock{m_StreamMutex};
+    PauseMusicStream(m_Music);
+    m_IsStreamPaused = true;
+}
+
+void AudioAsset::ResumeStream() {
+    if (!m_IsStreaming)
+        return;
+
+    std::lock_guard<std::mutex> lock{m_StreamMutex};
+    ResumeMusicStream(m_Music);
+    m_IsStreamPaused = false;
+}
+
+void AudioAsset::StopStream() {
+    if (!m_IsStreaming)
+        return;
+
+    std::lock_guard<std::mutex> lock{m_StreamMutex};
+    StopMusicStream(m_Music);
+    m_IsStreamPaused = false;
+}
+
+void AudioAsset::SetStreamVolume(float volume) {
+    if (!m_IsStreaming)
+        return;
+
+    std::lock_guard<std::mutex> lock{m_StreamMutex};
+    SetMusicVolume(m_Music, volume);
+}
+
+void AudioAsset::SetStreamPitch(float pitch) {
+    if (!m_IsStreaming)
+        return;
+
+    std::lock_guard<std::mutex> lock{m_StreamMutex};
+    SetMusicPitch(m_Music, pitch);
+}
+
+void AudioAsset::SetStreamPan(float pan) {
+    if (!m_IsStreaming)
+        return;
+
+    std::lock_guard<std::mutex> lock{m_StreamMutex};
+    SetMusicPan(m_Music, pan);
+}
+
+bool AudioAsset::IsStreamPlaying() const {
+    if (!m_IsStreaming)
+        return false;
+
+    std::lock_guard<std::mutex> lock{m_StreamMutex};
+    return IsMusicStreamPlaying(m_Music);
+}
+
+void AudioAsset::RefillStream() {
+    std::lock_guard<std::mutex> lock{m_StreamMutex};
+    if (m_IsStreaming && IsMusicStreamPlaying(m_Music)) {
+        UpdateMusicStream(m_Music);
+    }
 }
 
 float AudioAsset::GetLength() const {
-    if (!m_IsLoaded || m_Wave.sampleRate == 0)
+    if (!m_IsLoaded || m_SampleRate == 0)
         return 0.0f;
-    return static_cast<float>(m_Wave.frameCount) / static_cast<float>(m_Wave.sampleRate);
+    return static_cast<float>(m_FrameCount) / static_cast<float>(m_SampleRate);
 }
 
 uint32_t AudioAsset::GetSampleRate() const {
     if (!m_IsLoaded)
         return 0;
-    return m_Wave.sampleRate;
+    return m_SampleRate;
 }
 
 uint32_t AudioAsset::GetChannels() const {
     if (!m_IsLoaded)
         return 0;
-    return m_Wave.channels;
+    return m_Channels;
+}
+
+const char* AudioAsset::GetDecoderExtension(AudioFormat format) {
+    switch (format) {
+        case AudioFormat::WAV:
+            return ".wav";
+        case AudioFormat::OGG:
+            return ".ogg";
+        case AudioFormat::MP3:
+            return ".mp3";
+        case AudioFormat::FLAC:
+            return ".flac";
+        default:
+            return nullptr;
+    }
 }
 
 AudioFormat AudioAsset::DetectAudioFormat(const std::string& extension) {
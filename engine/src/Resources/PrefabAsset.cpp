@@ -0,0 +1,211 @@
+#include "Resources/PrefabAsset.hpp"
+
+#include "Components/ComponentModuleRegistry.hpp"
+#include "Components/PrefabInstance.hpp"
+#include "Components/Script.hpp"
+#include "Components/Transform.hpp"
+#include "Core/Logger.hpp"
+#include "Reflection/JsonSerializer.hpp"
+#include "Reflection/TypeRegistry.hpp"
+#include "Scene/Scene.hpp"
+#include "Scripting/ScriptComponent.hpp"
+#include "Scripting/ScriptRegistry.hpp"
+
+#include <nlohmann/json.hpp>
+
+namespace PiiXeL {
+
+PrefabAsset::PrefabAsset(UUID uuid, const std::string& name) : Asset{uuid, AssetType::Prefab, name} {}
+
+bool PrefabAsset::Load(const void* data, size_t size) {
+    if (!data || size == 0) {
+        PX_LOG_ERROR(ASSET, "Invalid data for prefab: %s", m_Metadata.name.c_str());
+        return false;
+    }
+
+    Unload();
+
+    try {
+        const char* text = static_cast<const char*>(data);
+        nlohmann::json entityJson = nlohmann::json::parse(text, text + size);
+        if (!entityJson.is_object()) {
+            PX_LOG_ERROR(ASSET, "Prefab is not a JSON object: %s", m_Metadata.name.c_str());
+            return false;
+        }
+
+        m_Root = m_Template.create();
+
+        ComponentModuleRegistry& moduleRegistry = ComponentModuleRegistry::Instance();
+        const IComponentModule* instanceModule = moduleRegistry.GetModule<PrefabInstance>();
+        for (auto it = entityJson.begin(); it != entityJson.end(); ++it) {
+            const std::string& componentName = it.key();
+            if (IComponentModule* module = moduleRegistry.GetModuleByName(componentName)) {
+                // Instantiate() links every instance to this asset; a link saved into the file is not nested.
+                if (module == instanceModule) {
+                    continue;
+                }
+
+                module->Deserialize(m_Template, m_Root, it.value());
+                m_Modules.push_back(module);
+
+                nlohmann::json componentJson = module->Serialize(m_Template, m_Root);
+                if (!componentJson.empty()) {
+                    m_ComponentsJson[componentName] = std::move(componentJson);
+                }
+            }
+            else if (componentName != "uuid" && componentName != "Scripts" && componentName != "Script") {
+                PX_LOG_WARNING(ASSET, "Prefab %s: unknown component '%s'", m_Metadata.name.c_str(),
+                               componentName.c_str());
+            }
+        }
+
+        nlohmann::json scriptsJson = nlohmann::json::array();
+        if (entityJson.contains("Scripts") && entityJson["Scripts"].is_array()) {
+            scriptsJson = entityJson["Scripts"];
+        }
+        else if (entityJson.contains("Script")) {
+            scriptsJson.push_back(entityJson["Script"]);
+        }
+
+        for (const nlohmann::json& scriptJson : scriptsJson) {
+            std::string scriptName = scriptJson.value("scriptName", "");
+            if (scriptName.empty()) {
+                continue;
+            }
+
+            ScriptTemplate& script = m_Scripts.emplace_back();
+            script.scriptName = scriptName;
+            script.enabled = scriptJson.value("enabled", true);
+
+            if (!scriptJson.contains("properties")) {
+                continue;
+            }
+
+            // Properties are applied to a throwaway instance once and read back as typed values, so each
+            // instantiation only assigns them.
+            std::shared_ptr<ScriptComponent> prototype = ScriptRegistry::Instance().CreateScript(scriptName);
+            const Reflection::TypeInfo* typeInfo =
+                prototype ? Reflection::TypeRegistry::Instance().GetTypeInfo(typeid(*prototype)) : nullptr;
+            if (!typeInfo) {
+                PX_LOG_WARNING(ASSET, "Prefab %s: properties of script '%s' are ignored", m_Metadata.name.c_str(),
+                               scriptName.c_str());
+                continue;
+            }
+
+            const nlohmann::json& propertiesJson = scriptJson["properties"];
+            for (const Reflection::FieldInfo& field : typeInfo->GetFields()) {
+                if ((field.flags & Reflection::FieldFlags::Serializable) && propertiesJson.contains(field.name)) {
+                    void* fieldPtr = field.getPtr(static_cast<void*>(prototype.get()));
+                    Reflection::JsonSerializer::DeserializeField(field, propertiesJson[field.name], fieldPtr);
+                    script.properties.push_back({&field, field.getValue(prototype.get())});
+                }
+            }
+        }
+    }
+    catch (const nlohmann::json::exception& e) {
+        PX_LOG_ERROR(ASSET, "Failed to parse prefab %s: %s", m_Metadata.name.c_str(), e.what());
+        Unload();
+        return false;
+    }
+
+    m_IsLoaded = true;
+    return true;
+}
+
+void PrefabAsset::Unload() {
+    m_Template.clear();
+    m_Root = entt::null;
+    m_Modules.clear();
+    m_ComponentsJson = nlohmann::json::object();
+    m_Scripts.clear();
+    m_IsLoaded = false;
+}
+
+size_t PrefabAsset::GetMemoryUsage() const {
+    size_t total = sizeof(PrefabAsset);
+    total += m_Modules.capacity() * sizeof(const IComponentModule*);
+    for (const ScriptTemplate& script : m_Scripts) {
+        total += sizeof(ScriptTemplate) + script.scriptName.capacity();
+        total += script.properties.capacity() * sizeof(PropertyValue);
+    }
+    return total;
+}
+
+std::vector<entt::entity> PrefabAsset::Instantiate(Scene& scene, size_t count) const {
+    std::vector<entt::entity> entities{};
+    if (!m_IsLoaded || count == 0) {
+        return entities;
+    }
+
+    entt::registry& registry = scene.GetRegistry();
+    entities.resize(count);
+    registry.create(entities.begin(), entities.end());
+
+    std::vector<UUID> uuids(count);
+    registry.insert<UUID>(entities.begin(), entities.end(), uuids.begin());
+    registry.insert<PrefabInstance>(entities.begin(), entities.end(), PrefabInstance{m_Metadata.uuid});
+
+    for (const IComponentModule* module : m_Modules) {
+        module->CopyToEntities(m_Template, m_Root, registry, entities);
+    }
+
+    std::vector<std::pair<UUID, entt::entity>> indexEntries{};
+    indexEntries.reserve(count);
+    EntityOrder& entityOrder = scene.GetEntityOrder();
+    for (size_t i = 0; i < count; ++i) {
+        indexEntries.emplace_back(uuids[i], entities[i]);
+        entityOrder.Add(entities[i]);
+    }
+    scene.GetEntityIndex().RegisterEntities(indexEntries);
+
+    if (!m_Scripts.empty()) {
+        InstantiateScripts(scene, entities);
+    }
+
+    return entities;
+}
+
+std::vector<entt::entity> PrefabAsset::Instantiate(Scene& scene, std::span<const Vector2> positions) const {
+    std::vector<entt::entity> entities = Instantiate(scene, positions.size());
+    if (entities.empty() || !m_Template.all_of<Transform>(m_Root)) {
+        return entities;
+    }
+
+    entt::registry& registry = scene.GetRegistry();
+    for (size_t i = 0; i < entities.size(); ++i) {
+        registry.get<Transform>(entities[i]).position = positions[i];
+    }
+    return entities;
+}
+
+void PrefabAsset::InstantiateScripts(Scene& scene, std::span<const entt::entity> entities) const {
+    entt::registry& registry = scene.GetRegistry();
+
+    Script scriptTemplate{};
+    for (const ScriptTemplate& script : m_Scripts) {
+        scriptTemplate.AddScript(script.scriptName);
+    }
+    registry.insert<Script>(entities.begin(), entities.end(), scriptTemplate);
+
+    ScriptRegistry& scriptRegistry = ScriptRegistry::Instance();
+    for (entt::entity entity : entities) {
+        Script& scriptComponent = registry.get<Script>(entity);
+        for (size_t i = 0; i < m_Scripts.size(); ++i) {
+            const ScriptTemplate& script = m_Scripts[i];
+            ScriptInstance& instance = scriptComponent.scripts[i];
+
+            instance.instance = scriptRegistry.CreateScript(script.scriptName);
+            if (!instance.instance) {
+                continue;
+            }
+
+            for (const PropertyValue& property : script.properties) {
+                property.field->setValue(instance.instance.get(), property.value);
+            }
+            instance.instance->m_Enabled = script.enabled;
+            instance.instance->Initialize(entity, &scene);
+        }
+    }
+}
+
+} // namespace PiiXeL
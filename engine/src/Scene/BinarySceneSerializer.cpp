@@ -0,0 +1,666 @@
+#include "Scene/BinarySceneSerializer.hpp"
+
+#include "Components/AudioSource.hpp"
+#include "Components/ComponentModuleRegistry.hpp"
+#include "Components/Script.hpp"
+#include "Components/Tag.hpp"
+#include "Components/UUID.hpp"
+#include "Core/Logger.hpp"
+#include "Core/MappedFile.hpp"
+#include "Reflection/Reflection.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneSerializer.hpp"
+#include "Scripting/ScriptComponent.hpp"
+#include "Scripting/ScriptRegistry.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <type_traits>
+#include <unordered_set>
+
+namespace PiiXeL {
+
+namespace {
+constexpr size_t BlockAlignment{8};
+constexpr size_t ColumnNameSize{32};
+constexpr const char* ScriptsColumn{"Scripts"};
+constexpr const char* TagColumn{"Tag"};
+constexpr entt::id_type ScriptsColumnHash{entt::hashed_string::value("Scripts", 7)};
+constexpr entt::id_type TagColumnHash{entt::hashed_string::value("Tag", 3)};
+
+enum class ColumnEncoding : uint32_t {
+    // rowCount records laid out exactly like the component in memory.
+    Raw = 0,
+    // rowCount + 1 uint32 offsets followed by the row payloads.
+    String = 1,
+    MsgPack = 2
+};
+
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entityCount;
+    uint32_t columnCount;
+    uint32_t preloadCount;
+    uint32_t nameSize;
+};
+
+struct ColumnHeader {
+    char name[ColumnNameSize];
+    uint32_t encoding;
+    uint32_t rowCount;
+    uint32_t recordSize;
+    uint32_t recordAlign;
+    uint64_t schema;
+    uint64_t dataSize;
+};
+
+static_assert(sizeof(FileHeader) % BlockAlignment == 0);
+static_assert(sizeof(ColumnHeader) % BlockAlignment == 0);
+static_assert(sizeof(UUID) == sizeof(uint64_t) && std::is_trivially_copyable_v<UUID>);
+
+struct Column {
+    ColumnHeader header{};
+    std::vector<uint32_t> rows;
+    std::vector<uint8_t> data;
+};
+
+struct ColumnView {
+    ColumnHeader header{};
+    const uint8_t* rows{nullptr};
+    const uint8_t* data{nullptr};
+};
+
+void Append(std::vector<uint8_t>& buffer, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+void AlignBuffer(std::vector<uint8_t>& buffer) {
+    buffer.resize((buffer.size() + BlockAlignment - 1) & ~(BlockAlignment - 1), 0);
+}
+
+// Bounds-checked cursor over the file; once a read runs past the end every later read fails as well.
+class ByteReader {
+public:
+    ByteReader(const uint8_t* data, size_t size) : m_Data{data}, m_Size{size} {}
+
+    const uint8_t* Read(size_t size) {
+        if (m_Failed || size > m_Size - m_Offset) {
+            m_Failed = true;
+            return nullptr;
+        }
+
+        const uint8_t* result = m_Data + m_Offset;
+        m_Offset += size;
+        return result;
+    }
+
+    template <typename T>
+    bool ReadValue(T& value) {
+        const uint8_t* bytes = Read(sizeof(T));
+        if (bytes) {
+            std::memcpy(&value, bytes, sizeof(T));
+        }
+        return bytes != nullptr;
+    }
+
+    void Align() {
+        size_t aligned = (m_Offset + BlockAlignment - 1) & ~(BlockAlignment - 1);
+        m_Offset = aligned < m_Size ? aligned : m_Size;
+    }
+
+    [[nodiscard]] bool Failed() const { return m_Failed; }
+
+    [[nodiscard]] size_t Remaining() const { return m_Size - m_Offset; }
+
+private:
+    const uint8_t* m_Data;
+    size_t m_Size;
+    size_t m_Offset{0};
+    bool m_Failed{false};
+};
+
+uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Covers the record size and alignment and every reflected field, so reordering, resizing or retyping a
+// component invalidates files written before the change.
+uint64_t ComputeSchema(const IComponentModule& module) {
+    uint64_t hash = HashBytes(0xcbf29ce484222325ULL, module.GetName(), std::strlen(module.GetName()));
+    uint64_t layout[2]{module.GetRecordSize(), module.GetRecordAlign()};
+    hash = HashBytes(hash, layout, sizeof(layout));
+
+    const Reflection::TypeInfo* typeInfo = Reflection::TypeRegistry::Instance().GetTypeInfo(module.GetTypeIndex());
+    if (typeInfo) {
+        for (const Reflection::FieldInfo& field : typeInfo->GetFields()) {
+            hash = HashBytes(hash, field.name.data(), field.name.size());
+            uint64_t fieldLayout[3]{static_cast<uint64_t>(field.type), field.offset, field.size};
+            hash = HashBytes(hash, fieldLayout, sizeof(fieldLayout));
+        }
+    }
+    return hash;
+}
+
+const IComponentModule* FindRecordCodec(const char* name) {
+    const IComponentModule* module = ComponentModuleRegistry::Instance().GetModuleByName(name);
+    return module && module->HasRecordCodec() ? module : nullptr;
+}
+
+class BlobBuilder {
+public:
+    void Add(uint32_t row, const void* data, size_t size) {
+        m_Rows.push_back(row);
+        Append(m_Payload, data, size);
+        m_Offsets.push_back(static_cast<uint32_t>(m_Payload.size()));
+    }
+
+    void Finish(Column& column) {
+        column.rows = std::move(m_Rows);
+        column.data.clear();
+        Append(column.data, m_Offsets.data(), m_Offsets.size() * sizeof(uint32_t));
+        Append(column.data, m_Payload.data(), m_Payload.size());
+    }
+
+private:
+    std::vector<uint32_t> m_Rows;
+    std::vector<uint32_t> m_Offsets{0};
+    std::vector<uint8_t> m_Payload;
+};
+
+bool ReadBlobRows(const ColumnView& column, std::vector<std::span<const uint8_t>>& rows) {
+    size_t offsetBytes = (static_cast<size_t>(column.header.rowCount) + 1) * sizeof(uint32_t);
+    if (column.header.dataSize < offsetBytes) {
+        return false;
+    }
+
+    size_t payloadSize = column.header.dataSize - offsetBytes;
+    const uint8_t* payload = column.data + offsetBytes;
+    rows.resize(column.header.rowCount);
+
+    uint32_t begin = 0;
+    std::memcpy(&begin, column.data, sizeof(uint32_t));
+    for (uint32_t i = 0; i < column.header.rowCount; ++i) {
+        uint32_t end = 0;
+        std::memcpy(&end, column.data + (i + 1) * sizeof(uint32_t), sizeof(uint32_t));
+        if (begin > end || end > payloadSize) {
+            return false;
+        }
+        rows[i] = std::span<const uint8_t>{payload + begin, end - begin};
+        begin = end;
+    }
+    return true;
+}
+
+void SetColumnName(ColumnHeader& header, const char* name) {
+    std::strncpy(header.name, name, ColumnNameSize - 1);
+    header.name[ColumnNameSize - 1] = '\0';
+}
+
+void CreateScripts(entt::registry& registry, entt::entity entity, const nlohmann::json& scriptsJson) {
+    Script scriptComponent{};
+    for (const nlohmann::json& scriptJson : scriptsJson) {
+        std::string scriptName = scriptJson.value("scriptName", "");
+        if (!scriptName.empty()) {
+            scriptComponent.AddScript(scriptName);
+        }
+    }
+    if (scriptComponent.GetScriptCount() == 0) {
+        return;
+    }
+
+    // Instances are created here so their saved properties survive; ScriptSystem initializes them once the
+    // scene runs.
+    Script& script = registry.emplace<Script>(entity, std::move(scriptComponent));
+    size_t jsonIndex = 0;
+    for (ScriptInstance& instance : script.scripts) {
+        while (jsonIndex < scriptsJson.size() && scriptsJson[jsonIndex].value("scriptName", "").empty()) {
+            ++jsonIndex;
+        }
+
+        instance.instance = ScriptRegistry::Instance().CreateScript(instance.scriptName);
+        if (instance.instance && jsonIndex < scriptsJson.size()) {
+            SceneSerializer::ApplyScriptProperties(*instance.instance, scriptsJson[jsonIndex]);
+        }
+        ++jsonIndex;
+    }
+}
+} // namespace
+
+BinarySceneSerializer::BinarySceneSerializer(Scene* scene) : m_Scene{scene} {}
+
+bool BinarySceneSerializer::Serialize(const std::string& filepath) {
+    if (!m_Scene) {
+        return false;
+    }
+
+    std::vector<uint8_t> data = SerializeToMemory();
+
+    std::filesystem::path directory = std::filesystem::path(filepath).parent_path();
+    if (!directory.empty() && !std::filesystem::exists(directory)) {
+        std::filesystem::create_directories(directory);
+    }
+
+    std::ofstream file{filepath, std::ios::binary};
+    if (!file.is_open()) {
+        PX_LOG_ERROR(SCENE, "Failed to open file for writing: %s", filepath.c_str());
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    file.close();
+
+    PX_LOG_INFO(SCENE, "Binary scene saved to: %s", filepath.c_str());
+    return true;
+}
+
+bool BinarySceneSerializer::Deserialize(const std::string& filepath) {
+    if (!m_Scene) {
+        return false;
+    }
+
+    MappedFile file{};
+    if (!file.Open(filepath)) {
+        return false;
+    }
+
+    if (!DeserializeFromMemory(file.GetData(), file.GetSize())) {
+        PX_LOG_ERROR(SCENE, "Failed to load binary scene: %s", filepath.c_str());
+        return false;
+    }
+
+    PX_LOG_INFO(SCENE, "Scene loaded from: %s", filepath.c_str());
+    return true;
+}
+
+std::vector<uint8_t> BinarySceneSerializer::SerializeToMemory() {
+    if (!m_Scene) {
+        return {};
+    }
+
+    const EntityOrder& entityOrder = m_Scene->GetEntityOrder();
+    std::vector<entt::entity> entities{entityOrder.begin(), entityOrder.end()};
+    return SerializeToMemory(entities);
+}
+
+std::vector<uint8_t> BinarySceneSerializer::SerializeToMemory(std::span<const entt::entity> entities) {
+    std::vector<uint8_t> output{};
+    if (!m_Scene) {
+        return output;
+    }
+
+    entt::registry& registry = m_Scene->GetRegistry();
+
+    std::vector<Column> columns{};
+    for (const std::shared_ptr<IComponentModule>& module : ComponentModuleRegistry::Instance().GetAllModules()) {
+        if (!module->HasRecordCodec()) {
+            continue;
+        }
+
+        Column& column = columns.emplace_back();
+        module->WriteRecords(registry, entities, column.rows, column.data);
+        SetColumnName(column.header, module->GetName());
+        column.header.encoding = static_cast<uint32_t>(ColumnEncoding::Raw);
+        column.header.recordSize = module->GetRecordSize();
+        column.header.recordAlign = module->GetRecordAlign();
+        column.header.schema = ComputeSchema(*module);
+    }
+
+    BlobBuilder tags{};
+    for (size_t row = 0; row < entities.size(); ++row) {
+        if (const Tag* tag = registry.try_get<Tag>(entities[row])) {
+            tags.Add(static_cast<uint32_t>(row), tag->name.data(), tag->name.size());
+        }
+    }
+    Column& tagColumn = columns.emplace_back();
+    SetColumnName(tagColumn.header, TagColumn);
+    tagColumn.header.encoding = static_cast<uint32_t>(ColumnEncoding::String);
+    tags.Finish(tagColumn);
+
+    // Components without a fixed layout go through their module's JSON form, packed as MessagePack.
+    for (const std::shared_ptr<IComponentModule>& module : ComponentModuleRegistry::Instance().GetAllModules()) {
+        const char* name = module->GetName();
+        if (module->HasRecordCodec() || module->GetNameHash() == TagColumnHash) {
+            continue;
+        }
+        if (std::strlen(name) >= ColumnNameSize) {
+            PX_LOG_WARNING(SCENE, "Component name too long for the binary scene format: %s", name);
+            continue;
+        }
+
+        BlobBuilder blobs{};
+        for (size_t row = 0; row < entities.size(); ++row) {
+            if (module->HasComponent(registry, entities[row])) {
+                std::vector<uint8_t> packed = nlohmann::json::to_msgpack(module->Serialize(registry, entities[row]));
+                blobs.Add(static_cast<uint32_t>(row), packed.data(), packed.size());
+            }
+        }
+
+        Column& column = columns.emplace_back();
+        SetColumnName(column.header, name);
+        column.header.encoding = static_cast<uint32_t>(ColumnEncoding::MsgPack);
+        blobs.Finish(column);
+    }
+
+    BlobBuilder scripts{};
+    for (size_t row = 0; row < entities.size(); ++row) {
+        entt::entity entity = entities[row];
+        auto overrideIt = m_ScriptOverrides.find(entity);
+        if (overrideIt != m_ScriptOverrides.end()) {
+            std::vector<uint8_t> packed = nlohmann::json::to_msgpack(overrideIt->second);
+            scripts.Add(static_cast<uint32_t>(row), packed.data(), packed.size());
+        }
+        else if (const Script* script = registry.try_get<Script>(entity)) {
+            std::vector<uint8_t> packed = nlohmann::json::to_msgpack(SceneSerializer::SerializeScripts(*script));
+            scripts.Add(static_cast<uint32_t>(row), packed.data(), packed.size());
+        }
+    }
+    Column& scriptColumn = columns.emplace_back();
+    SetColumnName(scriptColumn.header, ScriptsColumn);
+    scriptColumn.header.encoding = static_cast<uint32_t>(ColumnEncoding::MsgPack);
+    scripts.Finish(scriptColumn);
+
+    std::erase_if(columns, [](const Column& column) { return column.rows.empty(); });
+
+    std::vector<UUID> preload{};
+    std::unordered_set<UUID> seen{};
+    for (entt::entity entity : entities) {
+        const AudioSource* source = registry.try_get<AudioSource>(entity);
+        if (source && source->audioClip.Get() != 0 && seen.insert(source->audioClip).second) {
+            preload.push_back(source->audioClip);
+        }
+    }
+
+    const std::string& name = m_Scene->GetName();
+    FileHeader header{Magic,
+                      Version,
+                      static_cast<uint32_t>(entities.size()),
+                      static_cast<uint32_t>(columns.size()),
+                      static_cast<uint32_t>(preload.size()),
+                      static_cast<uint32_t>(name.size())};
+
+    Append(output, &header, sizeof(header));
+    Append(output, name.data(), name.size());
+    AlignBuffer(output);
+
+    for (entt::entity entity : entities) {
+        const UUID* uuid = registry.try_get<UUID>(entity);
+        uint64_t value = uuid ? uuid->Get() : 0;
+        Append(output, &value, sizeof(value));
+    }
+    Append(output, preload.data(), preload.size() * sizeof(UUID));
+
+    for (Column& column : columns) {
+        column.header.rowCount = static_cast<uint32_t>(column.rows.size());
+        column.header.dataSize = column.data.size();
+
+        Append(output, &column.header, sizeof(ColumnHeader));
+        Append(output, column.rows.data(), column.rows.size() * sizeof(uint32_t));
+        AlignBuffer(output);
+        Append(output, column.data.data(), column.data.size());
+        AlignBuffer(output);
+    }
+
+    return output;
+}
+
+bool BinarySceneSerializer::DeserializeFromMemory(const uint8_t* data, size_t size) {
+    return Read(data, size, nullptr);
+}
+
+bool BinarySceneSerializer::AppendFromMemory(const uint8_t* data, size_t size, std::vector<entt::entity>& entities) {
+    return Read(data, size, &entities);
+}
+
+bool BinarySceneSerializer::Read(const uint8_t* data, size_t size, std::vector<entt::entity>* appended) {
+    if (!m_Scene || !IsBinaryScene(data, size)) {
+        return false;
+    }
+
+    ByteReader reader{data, size};
+    FileHeader header{};
+    reader.ReadValue(header);
+    if (header.version != Version) {
+        PX_LOG_ERROR(SCENE, "Unsupported binary scene version %u", header.version);
+        return false;
+    }
+
+    const uint8_t* nameBytes = reader.Read(header.nameSize);
+    reader.Align();
+    const uint8_t* uuids = reader.Read(static_cast<size_t>(header.entityCount) * sizeof(UUID));
+    const uint8_t* preloadBytes = reader.Read(static_cast<size_t>(header.preloadCount) * sizeof(UUID));
+
+    // Each column needs at least its header, which bounds the count before anything is allocated for it.
+    if (reader.Failed() || header.columnCount > reader.Remaining() / sizeof(ColumnHeader)) {
+        PX_LOG_ERROR(SCENE, "Binary scene is truncated");
+        return false;
+    }
+
+    // Every column is validated before the scene is touched, so a rejected file leaves it unchanged.
+    std::vector<ColumnView> columns(header.columnCount);
+    for (ColumnView& column : columns) {
+        if (!reader.ReadValue(column.header)) {
+            break;
+        }
+        column.header.name[ColumnNameSize - 1] = '\0';
+        column.rows = reader.Read(static_cast<size_t>(column.header.rowCount) * sizeof(uint32_t));
+        reader.Align();
+        column.data = reader.Read(column.header.dataSize);
+        reader.Align();
+
+        if (reader.Failed()) {
+            break;
+        }
+
+        for (uint32_t i = 0; i < column.header.rowCount; ++i) {
+            uint32_t row = 0;
+            std::memcpy(&row, column.rows + i * sizeof(uint32_t), sizeof(uint32_t));
+            if (row >= header.entityCount) {
+                PX_LOG_ERROR(SCENE, "Binary scene column '%s' references a missing entity", column.header.name);
+                return false;
+            }
+        }
+
+        if (const IComponentModule* codec = FindRecordCodec(column.header.name)) {
+            if (column.header.encoding != static_cast<uint32_t>(ColumnEncoding::Raw) ||
+                column.header.recordSize != codec->GetRecordSize() ||
+                column.header.recordAlign != codec->GetRecordAlign() || column.header.schema != ComputeSchema(*codec) ||
+                column.header.dataSize != static_cast<uint64_t>(column.header.rowCount) * codec->GetRecordSize())
+            {
+                PX_LOG_ERROR(SCENE, "Binary scene column '%s' does not match this build; re-export the scene",
+                             column.header.name);
+                return false;
+            }
+        }
+    }
+
+    if (reader.Failed()) {
+        PX_LOG_ERROR(SCENE, "Binary scene is truncated");
+        return false;
+    }
+
+    entt::registry& registry = m_Scene->GetRegistry();
+    EntityIndex& entityIndex = m_Scene->GetEntityIndex();
+    EntityOrder& entityOrder = m_Scene->GetEntityOrder();
+    if (!appended) {
+        registry.clear();
+        entityIndex.Clear();
+        entityOrder.Clear();
+
+        m_Scene->SetName(std::string{reinterpret_cast<const char*>(nameBytes), header.nameSize});
+    }
+
+    std::vector<entt::entity> entities(header.entityCount);
+    registry.create(entities.begin(), entities.end());
+    if (appended) {
+        appended->insert(appended->end(), entities.begin(), entities.end());
+    }
+
+    std::vector<UUID> entityUUIDs(entities.size());
+    std::memcpy(static_cast<void*>(entityUUIDs.data()), uuids, entityUUIDs.size() * sizeof(UUID));
+
+    // Same as the JSON additive path: appending a file twice would register every UUID twice, so the copies get
+    // fresh UUIDs and references inside the second copy keep pointing at the first one.
+    if (appended) {
+        for (UUID& uuid : entityUUIDs) {
+            if (entityIndex.HasEntity(uuid)) {
+                uuid = UUID{};
+            }
+        }
+    }
+    registry.insert<UUID>(entities.begin(), entities.end(), entityUUIDs.begin());
+
+    std::vector<std::pair<UUID, entt::entity>> indexEntries{};
+    indexEntries.reserve(entities.size());
+    for (size_t i = 0; i < entities.size(); ++i) {
+        indexEntries.emplace_back(entityUUIDs[i], entities[i]);
+        entityOrder.Add(entities[i]);
+    }
+    entityIndex.RegisterEntities(indexEntries);
+
+    if (!appended) {
+        std::vector<UUID> preload(header.preloadCount);
+        std::memcpy(static_cast<void*>(preload.data()), preloadBytes, preload.size() * sizeof(UUID));
+        m_Scene->SetPreloadAssets(preload);
+    }
+
+    std::vector<entt::entity> rowEntities{};
+    std::vector<std::span<const uint8_t>> blobs{};
+    for (const ColumnView& column : columns) {
+        rowEntities.resize(column.header.rowCount);
+        for (uint32_t i = 0; i < column.header.rowCount; ++i) {
+            uint32_t row = 0;
+            std::memcpy(&row, column.rows + i * sizeof(uint32_t), sizeof(uint32_t));
+            rowEntities[i] = entities[row];
+        }
+
+        entt::id_type columnHash = ComponentModuleRegistry::HashName(column.header.name);
+        IComponentModule* module = ComponentModuleRegistry::Instance().GetModuleByName(column.header.name, columnHash);
+        if (module && module->HasRecordCodec()) {
+            module->InsertRecords(registry, rowEntities, column.data);
+            continue;
+        }
+
+        if (!ReadBlobRows(column, blobs)) {
+            PX_LOG_WARNING(SCENE, "Binary scene column '%s' is corrupt and was skipped", column.header.name);
+            continue;
+        }
+
+        try {
+            if (column.header.encoding == static_cast<uint32_t>(ColumnEncoding::String) && columnHash == TagColumnHash)
+            {
+                std::vector<Tag> tags{};
+                tags.reserve(blobs.size());
+                for (std::span<const uint8_t> blob : blobs) {
+                    tags.emplace_back(std::string{reinterpret_cast<const char*>(blob.data()), blob.size()});
+                }
+                registry.insert<Tag>(rowEntities.begin(), rowEntities.end(), tags.begin());
+            }
+            else if (column.header.encoding == static_cast<uint32_t>(ColumnEncoding::MsgPack) &&
+                     columnHash == ScriptsColumnHash)
+            {
+                for (size_t i = 0; i < blobs.size(); ++i) {
+                    CreateScripts(registry, rowEntities[i], nlohmann::json::from_msgpack(blobs[i]));
+                }
+            }
+            else if (column.header.encoding == static_cast<uint32_t>(ColumnEncoding::MsgPack)) {
+                if (!module) {
+                    PX_LOG_WARNING(SCENE, "Binary scene: unknown component '%s'", column.header.name);
+                    continue;
+                }
+
+                for (size_t i = 0; i < blobs.size(); ++i) {
+                    module->Deserialize(registry, rowEntities[i], nlohmann::json::from_msgpack(blobs[i]));
+                }
+            }
+            else {
+                PX_LOG_WARNING(SCENE, "Binary scene: unknown column '%s'", column.header.name);
+            }
+        }
+        catch (const nlohmann::json::exception& e) {
+            PX_LOG_WARNING(SCENE, "Binary scene column '%s' is corrupt: %s", column.header.name, e.what());
+        }
+    }
+
+    return true;
+}
+
+bool BinarySceneSerializer::ConvertJsonToBinary(const nlohmann::json& sceneJson, std::vector<uint8_t>& output) {
+    if (!sceneJson.is_object()) {
+        return false;
+    }
+
+    Scene scene{sceneJson.value("scene", "Untitled Scene")};
+    SceneSerializer jsonSerializer{&scene};
+    jsonSerializer.SetDeltaEncoding(SceneSerializer::IsDeltaEncoded(sceneJson));
+    BinarySceneSerializer binarySerializer{&scene};
+
+    if (sceneJson.contains("entities") && sceneJson["entities"].is_array()) {
+        scene.GetEntityIndex().Reserve(sceneJson["entities"].size());
+        for (const nlohmann::json& entityJson : sceneJson["entities"]) {
+            entt::entity entity = jsonSerializer.DeserializeEntity(entityJson);
+            scene.GetEntityOrder().Add(entity);
+
+            if (entityJson.contains("Scripts") && entityJson["Scripts"].is_array()) {
+                binarySerializer.m_ScriptOverrides[entity] = entityJson["Scripts"];
+            }
+            else if (entityJson.contains("Script")) {
+                binarySerializer.m_ScriptOverrides[entity] = nlohmann::json::array({entityJson["Script"]});
+            }
+        }
+    }
+
+    output = binarySerializer.SerializeToMemory();
+    return true;
+}
+
+bool BinarySceneSerializer::ConvertJsonToBinary(const std::string& jsonPath, const std::string& binaryPath) {
+    std::ifstream input{jsonPath};
+    if (!input.is_open()) {
+        PX_LOG_ERROR(SCENE, "Failed to open file for reading: %s", jsonPath.c_str());
+        return false;
+    }
+
+    nlohmann::json sceneJson{};
+    try {
+        input >> sceneJson;
+    }
+    catch (const nlohmann::json::exception& e) {
+        PX_LOG_ERROR(SCENE, "Failed to parse JSON: %s", e.what());
+        return false;
+    }
+
+    std::vector<uint8_t> data{};
+    if (!ConvertJsonToBinary(sceneJson, data)) {
+        return false;
+    }
+
+    std::ofstream output{binaryPath, std::ios::binary};
+    if (!output.is_open()) {
+        PX_LOG_ERROR(SCENE, "Failed to open file for writing: %s", binaryPath.c_str());
+        return false;
+    }
+    output.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+    PX_LOG_INFO(SCENE, "Converted %s -> %s (%zu bytes)", jsonPath.c_str(), binaryPath.c_str(), data.size());
+    return true;
+}
+
+bool BinarySceneSerializer::IsBinaryScene(const uint8_t* data, size_t size) {
+    uint32_t magic = 0;
+    if (!data || size < sizeof(FileHeader)) {
+        return false;
+    }
+    std::memcpy(&magic, data, sizeof(magic));
+    return magic == Magic;
+}
+
+} // namespace PiiXeL
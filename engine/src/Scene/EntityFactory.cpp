@@ -8,7 +8,6 @@
 #include "Components/UUID.hpp"
 #include "Core/Engine.hpp"
 #include "Core/Logger.hpp"
-#include "Scene/EntityRegistry.hpp"
 #include "Scene/Scene.hpp"
 #include "Scripting/ScriptComponent.hpp"
 #include "Scripting/ScriptRegistry.hpp"
@@ -26,12 +25,12 @@ entt::entity EntityFactory::CreateEntity(Scene* scene, const std::string& name)
 
     UUID uuid;
     registry.emplace<UUID>(entity, uuid);
-    EntityRegistry::Instance().RegisterEntity(uuid, entity);
+    scene->GetEntityIndex().Register(uuid, entity);
 
     registry.emplace<Tag>(entity, name);
     registry.emplace<Transform>(entity);
 
-    scene->GetEntityOrder().push_back(entity);
+    scene->GetEntityOrder().Add(entity);
 
     return entity;
 }
@@ -52,12 +51,13 @@ entt::entity EntityFactory::DuplicateEntity(Scene* scene, entt::entity source, c
     entt::entity destination = registry.create();
 
     DuplicateBuiltInComponents(registry, source, destination, options);
+    scene->GetEntityIndex().Register(registry.get<UUID>(destination), destination);
 
     if (options.duplicateModuleComponents) {
         DuplicateModuleComponents(registry, source, destination);
     }
 
-    scene->GetEntityOrder().push_back(destination);
+    scene->GetEntityOrder().Add(destination);
 
     PX_LOG_INFO(SCENE, "Entity duplicated successfully");
     return destination;
@@ -84,7 +84,6 @@ void EntityFactory::DuplicateBuiltInComponents(entt::registry& registry, entt::e
                                                const DuplicationOptions& options) {
     UUID uuid;
     registry.emplace<UUID>(destination, uuid);
-    EntityRegistry::Instance().RegisterEntity(uuid, destination);
 
     if (registry.all_of<Tag>(source)) {
         const Tag& sourceTag = registry.get<Tag>(source);
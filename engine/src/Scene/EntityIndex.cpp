@@ -0,0 +1,189 @@
+#include "Scene/EntityIndex.hpp"
+
+namespace PiiXeL {
+
+namespace {
+constexpr size_t MinCapacity{16};
+
+size_t HashKey(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return static_cast<size_t>(key);
+}
+
+// Keeps the load factor at or below 3/4.
+size_t CapacityFor(size_t count) {
+    size_t capacity = MinCapacity;
+    while (capacity * 3 < count * 4) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+} // namespace
+
+std::atomic<uint64_t> EntityIndex::s_GenerationCounter{0};
+
+EntityIndex::EntityIndex(entt::registry& registry) : m_Registry{registry} {
+    BindContext();
+}
+
+EntityIndex::~EntityIndex() {
+    m_Registry.ctx().erase<EntityIndex*>();
+}
+
+void EntityIndex::BindContext() {
+    m_Registry.ctx().erase<EntityIndex*>();
+    m_Registry.ctx().emplace<EntityIndex*>(this);
+}
+
+void EntityIndex::Swap(EntityIndex& other) {
+    m_Slots.swap(other.m_Slots);
+    std::swap(m_Count, other.m_Count);
+    Touch();
+    other.Touch();
+    BindContext();
+    other.BindContext();
+}
+
+const EntityIndex* EntityIndex::Find(const entt::registry& registry) {
+    EntityIndex* const* index = registry.ctx().find<EntityIndex*>();
+    return index ? *index : nullptr;
+}
+
+void EntityIndex::Register(UUID uuid, entt::entity entity) {
+    if (uuid.Get() == 0) {
+        return;
+    }
+
+    Reserve(m_Count + 1);
+    Insert(uuid.Get(), entity);
+    Touch();
+}
+
+void EntityIndex::RegisterEntities(const std::vector<std::pair<UUID, entt::entity>>& entries) {
+    if (entries.empty()) {
+        return;
+    }
+
+    Reserve(m_Count + entries.size());
+    for (const auto& [uuid, entity] : entries) {
+        if (uuid.Get() != 0) {
+            Insert(uuid.Get(), entity);
+        }
+    }
+    Touch();
+}
+
+void EntityIndex::Unregister(UUID uuid) {
+    Erase(uuid.Get());
+    Touch();
+}
+
+void EntityIndex::UnregisterEntities(const std::vector<UUID>& uuids) {
+    if (uuids.empty()) {
+        return;
+    }
+
+    for (UUID uuid : uuids) {
+        Erase(uuid.Get());
+    }
+    Touch();
+}
+
+void EntityIndex::Reserve(size_t count) {
+    size_t capacity = CapacityFor(count);
+    if (capacity > m_Slots.size()) {
+        Rehash(capacity);
+    }
+}
+
+void EntityIndex::Clear() {
+    m_Slots.clear();
+    m_Count = 0;
+    Touch();
+}
+
+entt::entity EntityIndex::GetEntity(UUID uuid) const {
+    if (uuid.Get() == 0 || m_Slots.empty()) {
+        return entt::null;
+    }
+
+    const Slot& slot = m_Slots[FindSlot(uuid.Get())];
+    return slot.key == uuid.Get() ? slot.entity : entt::null;
+}
+
+UUID EntityIndex::GetUUID(entt::entity entity) const {
+    if (entity == entt::null || !m_Registry.valid(entity)) {
+        return UUID{0};
+    }
+
+    const UUID* uuid = m_Registry.try_get<UUID>(entity);
+    return uuid ? *uuid : UUID{0};
+}
+
+size_t EntityIndex::FindSlot(uint64_t key) const {
+    size_t mask = m_Slots.size() - 1;
+    size_t index = HashKey(key) & mask;
+    while (m_Slots[index].key != 0 && m_Slots[index].key != key) {
+        index = (index + 1) & mask;
+    }
+    return index;
+}
+
+void EntityIndex::Insert(uint64_t key, entt::entity entity) {
+    Slot& slot = m_Slots[FindSlot(key)];
+    if (slot.key == 0) {
+        ++m_Count;
+    }
+    slot.key = key;
+    slot.entity = entity;
+}
+
+void EntityIndex::Erase(uint64_t key) {
+    if (key == 0 || m_Slots.empty()) {
+        return;
+    }
+
+    size_t mask = m_Slots.size() - 1;
+    size_t hole = FindSlot(key);
+    if (m_Slots[hole].key != key) {
+        return;
+    }
+
+    // Backward-shift deletion: pull later members of the probe chain into the hole so lookups never need
+    // tombstones.
+    size_t next = hole;
+    while (true) {
+        next = (next + 1) & mask;
+        if (m_Slots[next].key == 0) {
+            break;
+        }
+
+        size_t home = HashKey(m_Slots[next].key) & mask;
+        bool reachable = hole <= next ? (hole < home && home <= next) : (hole < home || home <= next);
+        if (!reachable) {
+            m_Slots[hole] = m_Slots[next];
+            hole = next;
+        }
+    }
+
+    m_Slots[hole] = Slot{};
+    --m_Count;
+}
+
+void EntityIndex::Rehash(size_t capacity) {
+    std::vector<Slot> slots(capacity);
+    slots.swap(m_Slots);
+    m_Count = 0;
+
+    for (const Slot& slot : slots) {
+        if (slot.key != 0) {
+            Insert(slot.key, slot.entity);
+        }
+    }
+}
+
+} // namespace PiiXeL
@@ -0,0 +1,94 @@
+#include "Scene/EntityOrder.hpp"
+
+namespace PiiXeL {
+
+void EntityOrder::Add(entt::entity entity) {
+    if (entity == entt::null || Contains(entity)) {
+        return;
+    }
+
+    SetPosition(entity, static_cast<uint32_t>(m_Entities.size()));
+    m_Entities.push_back(entity);
+}
+
+bool EntityOrder::Remove(entt::entity entity) {
+    if (!Contains(entity)) {
+        return false;
+    }
+
+    size_t id = static_cast<size_t>(entt::to_entity(entity));
+    m_Entities[m_Positions[id]] = entt::null;
+    m_Positions[id] = InvalidPosition;
+    ++m_TombstoneCount;
+    return true;
+}
+
+void EntityOrder::Compact() {
+    if (m_TombstoneCount == 0) {
+        return;
+    }
+
+    size_t write = 0;
+    for (size_t read = 0; read < m_Entities.size(); ++read) {
+        entt::entity entity = m_Entities[read];
+        if (entity == entt::null) {
+            continue;
+        }
+
+        m_Entities[write] = entity;
+        SetPosition(entity, static_cast<uint32_t>(write));
+        ++write;
+    }
+
+    m_Entities.resize(write);
+    m_TombstoneCount = 0;
+}
+
+void EntityOrder::Move(size_t from, size_t to) {
+    Compact();
+    if (from >= m_Entities.size() || to >= m_Entities.size() || from == to) {
+        return;
+    }
+
+    entt::entity entity = m_Entities[from];
+    if (from < to) {
+        for (size_t i = from; i < to; ++i) {
+            m_Entities[i] = m_Entities[i + 1];
+            SetPosition(m_Entities[i], static_cast<uint32_t>(i));
+        }
+    }
+    else {
+        for (size_t i = from; i > to; --i) {
+            m_Entities[i] = m_Entities[i - 1];
+            SetPosition(m_Entities[i], static_cast<uint32_t>(i));
+        }
+    }
+
+    m_Entities[to] = entity;
+    SetPosition(entity, static_cast<uint32_t>(to));
+}
+
+void EntityOrder::Clear() {
+    m_Entities.clear();
+    m_Positions.clear();
+    m_TombstoneCount = 0;
+}
+
+bool EntityOrder::Contains(entt::entity entity) const {
+    if (entity == entt::null) {
+        return false;
+    }
+
+    size_t id = static_cast<size_t>(entt::to_entity(entity));
+    return id < m_Positions.size() && m_Positions[id] != InvalidPosition && m_Entities[m_Positions[id]] == entity;
+}
+
+void EntityOrder::SetPosition(entt::entity entity, uint32_t position) {
+    size_t id = static_cast<size_t>(entt::to_entity(entity));
+    if (id >= m_Positions.size()) {
+        m_Positions.resize(id + 1, InvalidPosition);
+    }
+    m_Positions[id] = position;
+}
+
+} // namespace PiiXeL
@@ -2,11 +2,13 @@
 
 #include "Components/UUID.hpp"
 #include "Scene/EntityFactory.hpp"
-#include "Scene/EntityRegistry.hpp"
+
+#include <algorithm>
+#include <utility>
 
 namespace PiiXeL {
 
-Scene::Scene(const std::string& name) : m_Name{name}, m_Registry{} {}
+Scene::Scene(const std::string& name) : m_Name{name}, m_Registry{}, m_EntityIndex{m_Registry} {}
 
 void Scene::CreateDemoEntities() {}
 
@@ -14,6 +16,15 @@ Scene::~Scene() {
     m_Registry.clear();
 }
 
+void Scene::Swap(Scene& other) {
+    m_Name.swap(other.m_Name);
+    m_Registry.swap(other.m_Registry);
+    m_EntityIndex.Swap(other.m_EntityIndex);
+    std::swap(m_EntityOrder, other.m_EntityOrder);
+    m_PendingDestroy.swap(other.m_PendingDestroy);
+    m_PreloadAssets.swap(other.m_PreloadAssets);
+}
+
 void Scene::OnUpdate(float deltaTime) {
     (void)deltaTime;
 }
@@ -25,17 +36,50 @@ entt::entity Scene::CreateEntity(const std::string& name) {
 }
 
 void Scene::DestroyEntity(entt::entity entity) {
+    if (m_Registry.valid(entity)) {
+        m_PendingDestroy.push_back(entity);
+    }
+}
+
+void Scene::DestroyEntityImmediate(entt::entity entity) {
+    if (!m_Registry.valid(entity)) {
+        return;
+    }
+
     if (m_Registry.all_of<UUID>(entity)) {
         UUID uuid = m_Registry.get<UUID>(entity);
-        EntityRegistry::Instance().UnregisterEntity(uuid);
+        m_EntityIndex.Unregister(uuid);
     }
 
-    auto it = std::find(m_EntityOrder.begin(), m_EntityOrder.end(), entity);
-    if (it != m_EntityOrder.end()) {
-        m_EntityOrder.erase(it);
+    m_EntityOrder.Remove(entity);
+    m_Registry.destroy(entity);
+}
+
+void Scene::FlushDestroyedEntities() {
+    // on_destroy listeners may queue further entities, so keep going until the queue stays empty.
+    while (!m_PendingDestroy.empty()) {
+        std::vector<entt::entity> pending{};
+        pending.swap(m_PendingDestroy);
+
+        std::sort(pending.begin(), pending.end());
+        pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+        std::erase_if(pending, [this](entt::entity entity) { return !m_Registry.valid(entity); });
+
+        std::vector<UUID> uuids{};
+        uuids.reserve(pending.size());
+        for (entt::entity entity : pending) {
+            if (const UUID* uuid = m_Registry.try_get<UUID>(entity)) {
+                uuids.push_back(*uuid);
+            }
+            m_EntityOrder.Remove(entity);
+        }
+
+        m_EntityIndex.UnregisterEntities(uuids);
+        m_Registry.destroy(pending.begin(), pending.end());
     }
 
-    m_Registry.destroy(entity);
+    // Also covers the holes DestroyEntityImmediate left since the last flush.
+    m_EntityOrder.Compact();
 }
 
 } // namespace PiiXeL
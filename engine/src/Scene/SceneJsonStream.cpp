@@ -0,0 +1,244 @@
+#include "Scene/SceneJsonStream.hpp"
+
+#include <istream>
+#include <ostream>
+
+namespace PiiXeL {
+
+namespace {
+constexpr const char* DeltaKey{"delta"};
+constexpr const char* EntitiesKey{"entities"};
+} // namespace
+
+SceneJsonWriter::SceneJsonWriter(std::ostream& stream, int indent, bool deltaEncoded) :
+    m_Stream{stream}, m_Indent{indent} {
+    m_Stream << '{';
+    if (deltaEncoded) {
+        NewLine(1);
+        m_Stream << '"' << DeltaKey << "\":" << (m_Indent >= 0 ? " true," : "true,");
+    }
+    NewLine(1);
+    m_Stream << '"' << EntitiesKey << "\":" << (m_Indent >= 0 ? " [" : "[");
+}
+
+void SceneJsonWriter::WriteEntity(const nlohmann::json& entityJson) {
+    if (m_EntityCount++ > 0) {
+        m_Stream << ',';
+    }
+    NewLine(2);
+    WriteIndented(entityJson.dump(m_Indent), 2);
+}
+
+void SceneJsonWriter::Finish(const nlohmann::json& preload, const std::string& sceneName) {
+    const char* separator = m_Indent >= 0 ? " " : "";
+
+    if (m_EntityCount > 0) {
+        NewLine(1);
+    }
+    m_Stream << "],";
+
+    NewLine(1);
+    m_Stream << "\"preload\":" << separator;
+    WriteIndented(preload.dump(m_Indent), 1);
+    m_Stream << ',';
+
+    NewLine(1);
+    m_Stream << "\"scene\":" << separator << nlohmann::json(sceneName).dump(m_Indent);
+
+    NewLine(0);
+    m_Stream << '}';
+}
+
+// Re-indents a value dumped at the top level so it nests at the given depth. Strings are escaped by dump(), so
+// every raw newline is a line break of the layout.
+void SceneJsonWriter::WriteIndented(const std::string& text, int level) {
+    if (m_Indent < 0) {
+        m_Stream << text;
+        return;
+    }
+
+    size_t start = 0;
+    size_t newline = text.find('\n');
+    while (newline != std::string::npos) {
+        m_Stream.write(text.data() + start, static_cast<std::streamsize>(newline - start));
+        NewLine(level);
+        start = newline + 1;
+        newline = text.find('\n', start);
+    }
+    m_Stream.write(text.data() + start, static_cast<std::streamsize>(text.size() - start));
+}
+
+void SceneJsonWriter::NewLine(int level) {
+    if (m_Indent < 0) {
+        return;
+    }
+
+    m_Stream << '\n';
+    for (int i = 0; i < level * m_Indent; ++i) {
+        m_Stream << ' ';
+    }
+}
+
+SceneJsonReader::SceneJsonReader(EntityCallback onEntity) : m_OnEntity{std::move(onEntity)} {}
+
+bool SceneJsonReader::Parse(std::istream& stream) {
+    try {
+        return nlohmann::json::sax_parse(stream, this);
+    }
+    catch (const nlohmann::json::exception& e) {
+        m_Error = e.what();
+        return false;
+    }
+}
+
+bool SceneJsonReader::Parse(const std::string& text) {
+    try {
+        return nlohmann::json::sax_parse(text, this);
+    }
+    catch (const nlohmann::json::exception& e) {
+        m_Error = e.what();
+        return false;
+    }
+}
+
+bool SceneJsonReader::null() {
+    return AddValue(nlohmann::json{});
+}
+
+bool SceneJsonReader::boolean(bool val) {
+    return AddValue(nlohmann::json(val));
+}
+
+bool SceneJsonReader::number_integer(number_integer_t val) {
+    return AddValue(nlohmann::json(val));
+}
+
+bool SceneJsonReader::number_unsigned(number_unsigned_t val) {
+    return AddValue(nlohmann::json(val));
+}
+
+bool SceneJsonReader::number_float(number_float_t val, [[maybe_unused]] const string_t& s) {
+    return AddValue(nlohmann::json(val));
+}
+
+bool SceneJsonReader::string(string_t& val) {
+    return AddValue(nlohmann::json(std::move(val)));
+}
+
+bool SceneJsonReader::binary(binary_t& val) {
+    return AddValue(nlohmann::json(std::move(val)));
+}
+
+bool SceneJsonReader::start_object([[maybe_unused]] std::size_t elements) {
+    if (!m_InRoot && m_Stack.empty()) {
+        m_InRoot = true;
+        return true;
+    }
+    return BeginContainer(nlohmann::json::object());
+}
+
+bool SceneJsonReader::key(string_t& val) {
+    if (m_Stack.empty()) {
+        m_TopLevelKey = std::move(val);
+    }
+    else {
+        m_PendingKey = std::move(val);
+    }
+    return true;
+}
+
+bool SceneJsonReader::end_object() {
+    if (m_Stack.empty()) {
+        m_InRoot = false;
+        return true;
+    }
+    return EndContainer();
+}
+
+bool SceneJsonReader::start_array([[maybe_unused]] std::size_t elements) {
+    if (m_InRoot && m_Stack.empty() && !m_InEntities && m_TopLevelKey == EntitiesKey) {
+        m_InEntities = true;
+        return true;
+    }
+    return BeginContainer(nlohmann::json::array());
+}
+
+bool SceneJsonReader::end_array() {
+    if (m_Stack.empty() && m_InEntities) {
+        m_InEntities = false;
+        return true;
+    }
+    return EndContainer();
+}
+
+bool SceneJsonReader::parse_error([[maybe_unused]] std::size_t position,
+                                  [[maybe_unused]] const std::string& lastToken,
+                                  const nlohmann::detail::exception& ex) {
+    m_Error = ex.what();
+    return false;
+}
+
+bool SceneJsonReader::AddValue(nlohmann::json&& value) {
+    if (!m_InRoot) {
+        m_Error = "scene document is not a JSON object";
+        return false;
+    }
+
+    if (m_Stack.empty()) {
+        Complete(std::move(value));
+        return true;
+    }
+
+    nlohmann::json& parent = *m_Stack.back();
+    if (parent.is_object()) {
+        parent[m_PendingKey] = std::move(value);
+    }
+    else {
+        parent.push_back(std::move(value));
+    }
+    return true;
+}
+
+bool SceneJsonReader::BeginContainer(nlohmann::json&& container) {
+    if (!m_InRoot) {
+        m_Error = "scene document is not a JSON object";
+        return false;
+    }
+
+    if (m_Stack.empty()) {
+        m_Current = std::move(container);
+        m_Stack.push_back(&m_Current);
+        return true;
+    }
+
+    // Only ancestors are on the stack, so growing the parent never moves a pointer that is still in use.
+    nlohmann::json& parent = *m_Stack.back();
+    if (parent.is_object()) {
+        m_Stack.push_back(&(parent[m_PendingKey] = std::move(container)));
+    }
+    else {
+        parent.push_back(std::move(container));
+        m_Stack.push_back(&parent.back());
+    }
+    return true;
+}
+
+bool SceneJsonReader::EndContainer() {
+    m_Stack.pop_back();
+    if (m_Stack.empty()) {
+        Complete(std::move(m_Current));
+        m_Current = nlohmann::json{};
+    }
+    return true;
+}
+
+void SceneJsonReader::Complete(nlohmann::json&& value) {
+    if (m_InEntities) {
+        m_OnEntity(value, m_Header);
+    }
+    else {
+        m_Header[m_TopLevelKey] = std::move(value);
+    }
+}
+
+} // namespace PiiXeL
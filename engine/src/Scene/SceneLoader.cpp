@@ -0,0 +1,467 @@
+#include "Scene/SceneLoader.hpp"
+
+#include "Audio/AudioDecodeQueue.hpp"
+#include "Components/Script.hpp"
+#include "Core/JobSystem.hpp"
+#include "Core/Logger.hpp"
+#include "Resources/AssetPackage.hpp"
+#include "Resources/AssetRegistry.hpp"
+#include "Scene/BinarySceneSerializer.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneSerializer.hpp"
+#include "Scripting/ScriptComponent.hpp"
+#include "Scripting/ScriptRegistry.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <fstream>
+
+namespace PiiXeL {
+
+namespace {
+// Entities instantiated between two clock reads.
+constexpr size_t DeadlineCheckInterval{8};
+
+void AddAssetReference(const nlohmann::json& componentJson, const char* key, std::vector<UUID>& assets) {
+    if (componentJson.is_object() && componentJson.contains(key) && componentJson[key].is_number_unsigned()) {
+        assets.emplace_back(componentJson[key].get<uint64_t>());
+    }
+}
+
+void SortUnique(std::vector<UUID>& assets) {
+    std::erase_if(assets, [](UUID uuid) { return uuid.Get() == 0; });
+    std::sort(assets.begin(), assets.end());
+    assets.erase(std::unique(assets.begin(), assets.end()), assets.end());
+}
+
+// Instances are created here so their saved properties survive; ScriptSystem initializes them once the
+// scene runs.
+void CreateScriptInstances(entt::registry& registry, entt::entity entity, const nlohmann::json& entityJson) {
+    Script* scriptComponent = registry.try_get<Script>(entity);
+    if (!scriptComponent) {
+        return;
+    }
+
+    const nlohmann::json* scriptsArray = nullptr;
+    if (entityJson.contains("Scripts") && entityJson["Scripts"].is_array()) {
+        scriptsArray = &entityJson["Scripts"];
+    }
+
+    for (size_t i = 0; i < scriptComponent->scripts.size(); ++i) {
+        ScriptInstance& script = scriptComponent->scripts[i];
+        if (script.instance || script.scriptName.empty()) {
+            continue;
+        }
+
+        script.instance = ScriptRegistry::Instance().CreateScript(script.scriptName);
+        if (!script.instance) {
+            continue;
+        }
+
+        if (scriptsArray && i < scriptsArray->size()) {
+            SceneSerializer::ApplyScriptProperties(*script.instance, (*scriptsArray)[i]);
+        }
+        else if (!scriptsArray && i == 0 && entityJson.contains("Script")) {
+            SceneSerializer::ApplyScriptProperties(*script.instance, entityJson["Script"]);
+        }
+    }
+}
+} // namespace
+
+SceneLoadOperation::SceneLoadOperation(std::string source, SceneLoadMode mode) :
+    m_Source{std::move(source)}, m_Mode{mode} {}
+
+SceneLoadOperation::~SceneLoadOperation() = default;
+
+bool SceneLoadOperation::IsDone() const {
+    SceneLoadState state = GetState();
+    return state == SceneLoadState::Completed || state == SceneLoadState::Failed;
+}
+
+float SceneLoadOperation::GetProgress() const {
+    SceneLoadState state = GetState();
+    if (state == SceneLoadState::Completed) {
+        return 1.0f;
+    }
+
+    if (state == SceneLoadState::Parsing || state == SceneLoadState::Failed) {
+        return 0.0f;
+    }
+
+    size_t total = m_Assets.size() + m_EntityTotal;
+    size_t done = m_NextAsset + m_NextEntity;
+    return total > 0 ? static_cast<float>(done) / static_cast<float>(total) : 1.0f;
+}
+
+std::unique_ptr<Scene> SceneLoadOperation::TakeScene() {
+    return std::move(m_Scene);
+}
+
+void SceneLoadOperation::Cancel() {
+    SceneLoadState state = GetState();
+    while (state != SceneLoadState::Completed && state != SceneLoadState::Failed &&
+           !m_State.compare_exchange_weak(state, SceneLoadState::Failed, std::memory_order_acq_rel))
+    {
+    }
+}
+
+bool SceneLoadOperation::Advance(SceneLoadState from, SceneLoadState to) {
+    return m_State.compare_exchange_strong(from, to, std::memory_order_acq_rel);
+}
+
+SceneLoader::~SceneLoader() {
+    Clear();
+}
+
+std::shared_ptr<SceneLoadOperation> SceneLoader::LoadAsync(const std::string& filepath, SceneLoadMode mode) {
+    std::shared_ptr<SceneLoadOperation> operation = std::make_shared<SceneLoadOperation>(filepath, mode);
+    Enqueue(operation);
+    return operation;
+}
+
+std::shared_ptr<SceneLoadOperation> SceneLoader::LoadAsync(std::shared_ptr<const nlohmann::json> sceneData,
+                                                           const std::string& sceneName, SceneLoadMode mode) {
+    std::shared_ptr<SceneLoadOperation> operation = std::make_shared<SceneLoadOperation>(sceneName, mode);
+    operation->m_PackageScene = std::move(sceneData);
+    Enqueue(operation);
+    return operation;
+}
+
+std::shared_ptr<SceneLoadOperation> SceneLoader::LoadAsync(std::vector<uint8_t> binaryScene,
+                                                           const std::string& sceneName, SceneLoadMode mode) {
+    std::shared_ptr<SceneLoadOperation> operation = std::make_shared<SceneLoadOperation>(sceneName, mode);
+    operation->m_BinaryScene = std::move(binaryScene);
+    Enqueue(operation);
+    return operation;
+}
+
+std::vector<std::shared_ptr<SceneLoadOperation>> SceneLoader::Update(Scene* activeScene) {
+    std::vector<std::shared_ptr<SceneLoadOperation>> finished{};
+    if (m_Operations.empty()) {
+        return finished;
+    }
+
+    auto budget = std::chrono::duration<float, std::milli>{m_FrameBudgetMs};
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::nanoseconds>(budget);
+
+    while (!m_Operations.empty()) {
+        std::shared_ptr<SceneLoadOperation> operation = m_Operations.front();
+        SceneLoadState state = operation->GetState();
+
+        if (state == SceneLoadState::Parsing) {
+            break;
+        }
+
+        if (state == SceneLoadState::Prefetching) {
+            if (!Prefetch(operation, deadline)) {
+                break;
+            }
+
+            if (operation->m_Mode == SceneLoadMode::Single) {
+                // Binary scenes carry their name in the file and set it while loading.
+                const nlohmann::json& sceneJson = operation->m_SceneJson;
+                std::string sceneName = sceneJson.is_object() ? sceneJson.value("scene", "Untitled Scene")
+                                                              : std::string{"Untitled Scene"};
+                operation->m_Scene = std::make_unique<Scene>(sceneName);
+            }
+            state = SceneLoadState::Instantiating;
+            operation->m_State.store(state, std::memory_order_release);
+        }
+
+        if (state == SceneLoadState::Instantiating) {
+            Scene* scene = operation->m_Mode == SceneLoadMode::Single ? operation->m_Scene.get() : activeScene;
+            if (!scene) {
+                PX_LOG_ERROR(SCENE, "No active scene to load into: %s", operation->m_Source.c_str());
+                state = SceneLoadState::Failed;
+            }
+            else if (!operation->m_BinaryScene.empty()) {
+                state = InstantiateBinary(*operation, *scene) ? SceneLoadState::Completed : SceneLoadState::Failed;
+            }
+            else if (!Instantiate(*operation, *scene, deadline)) {
+                break;
+            }
+            else {
+                state = SceneLoadState::Completed;
+            }
+
+            if (state == SceneLoadState::Completed) {
+                PX_LOG_INFO(SCENE, "Scene loaded asynchronously: %s (%zu entities)", operation->m_Source.c_str(),
+                            operation->m_Entities.size());
+            }
+
+            operation->m_SceneJson = nlohmann::json{};
+            operation->m_BinaryScene = std::vector<uint8_t>{};
+            operation->m_Prefetched = std::vector<SceneLoadOperation::PrefetchedAsset>{};
+            operation->m_State.store(state, std::memory_order_release);
+        }
+
+        // The caller swaps scenes when a Single load completes; activeScene is stale for anything after it.
+        bool replacesScene = operation->m_Mode == SceneLoadMode::Single && state == SceneLoadState::Completed;
+        finished.push_back(std::move(operation));
+        m_Operations.pop_front();
+
+        if (replacesScene || std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+
+    return finished;
+}
+
+void SceneLoader::Clear() {
+    // A job busy with one of them sees the cancel and stops early.
+    for (const std::shared_ptr<SceneLoadOperation>& operation : m_Operations) {
+        operation->Cancel();
+    }
+    m_Operations.clear();
+}
+
+void SceneLoader::Enqueue(const std::shared_ptr<SceneLoadOperation>& operation) {
+    m_Operations.push_back(operation);
+
+    JobSystem::Instance().Schedule([operation]() {
+        if (!operation->IsDone()) {
+            Parse(*operation);
+        }
+    });
+}
+
+void SceneLoader::Parse(SceneLoadOperation& operation) {
+    if (!operation.m_BinaryScene.empty()) {
+        if (!BinarySceneSerializer::IsBinaryScene(operation.m_BinaryScene.data(), operation.m_BinaryScene.size())) {
+            PX_LOG_ERROR(SCENE, "Not a binary scene: %s", operation.m_Source.c_str());
+            operation.m_BinaryScene.clear();
+            operation.Advance(SceneLoadState::Parsing, SceneLoadState::Failed);
+            return;
+        }
+
+        operation.Advance(SceneLoadState::Parsing, SceneLoadState::Prefetching);
+        return;
+    }
+
+    if (!operation.m_PackageScene && operation.m_Source.ends_with(BinarySceneSerializer::FileExtension)) {
+        std::ifstream file{operation.m_Source, std::ios::binary | std::ios::ate};
+        if (!file.is_open()) {
+            PX_LOG_ERROR(SCENE, "Failed to open file for reading: %s", operation.m_Source.c_str());
+            operation.Advance(SceneLoadState::Parsing, SceneLoadState::Failed);
+            return;
+        }
+
+        operation.m_BinaryScene.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(operation.m_BinaryScene.data()),
+                  static_cast<std::streamsize>(operation.m_BinaryScene.size()));
+
+        if (!file ||
+            !BinarySceneSerializer::IsBinaryScene(operation.m_BinaryScene.data(), operation.m_BinaryScene.size()))
+        {
+            PX_LOG_ERROR(SCENE, "Not a binary scene: %s", operation.m_Source.c_str());
+            operation.m_BinaryScene.clear();
+            operation.Advance(SceneLoadState::Parsing, SceneLoadState::Failed);
+            return;
+        }
+
+        operation.Advance(SceneLoadState::Parsing, SceneLoadState::Prefetching);
+        return;
+    }
+
+    nlohmann::json& sceneJson = operation.m_SceneJson;
+
+    try {
+        if (operation.m_PackageScene) {
+            sceneJson = *operation.m_PackageScene;
+        }
+        else {
+            std::ifstream file{operation.m_Source};
+            if (!file.is_open()) {
+                PX_LOG_ERROR(SCENE, "Failed to open file for reading: %s", operation.m_Source.c_str());
+                operation.Advance(SceneLoadState::Parsing, SceneLoadState::Failed);
+                return;
+            }
+            file >> sceneJson;
+        }
+    }
+    catch (const nlohmann::json::exception& e) {
+        PX_LOG_ERROR(SCENE, "Failed to parse JSON: %s", e.what());
+        operation.Advance(SceneLoadState::Parsing, SceneLoadState::Failed);
+        return;
+    }
+
+    if (!sceneJson.is_object()) {
+        PX_LOG_ERROR(SCENE, "Scene is not a JSON object: %s", operation.m_Source.c_str());
+        operation.Advance(SceneLoadState::Parsing, SceneLoadState::Failed);
+        return;
+    }
+
+    if (sceneJson.contains("entities") && sceneJson["entities"].is_array()) {
+        const nlohmann::json& entities = sceneJson["entities"];
+        operation.m_EntityTotal = entities.size();
+
+        for (const nlohmann::json& entityJson : entities) {
+            // Rejected here, on the parse job, so instantiation on the main thread can read UUIDs unchecked.
+            if (!entityJson.is_object() || (entityJson.contains("uuid") && !entityJson["uuid"].is_number_unsigned()))
+            {
+                PX_LOG_ERROR(SCENE, "Scene has an entity with a malformed uuid: %s", operation.m_Source.c_str());
+                operation.Advance(SceneLoadState::Parsing, SceneLoadState::Failed);
+                return;
+            }
+            if (entityJson.contains("Sprite")) {
+                AddAssetReference(entityJson["Sprite"], "textureAssetUUID", operation.m_Assets);
+            }
+            if (entityJson.contains("Animator")) {
+                AddAssetReference(entityJson["Animator"], "controllerUUID", operation.m_Assets);
+            }
+            if (entityJson.contains("AudioSource")) {
+                AddAssetReference(entityJson["AudioSource"], "audioClip", operation.m_AudioClips);
+            }
+            AddAssetReference(entityJson, "base", operation.m_Assets);
+        }
+    }
+
+    operation.m_PreloadAssets = SceneSerializer::ReadPreloadManifest(sceneJson);
+    operation.m_AudioClips.insert(operation.m_AudioClips.end(), operation.m_PreloadAssets.begin(),
+                                  operation.m_PreloadAssets.end());
+    SortUnique(operation.m_Assets);
+    SortUnique(operation.m_AudioClips);
+
+    operation.Advance(SceneLoadState::Parsing, SceneLoadState::Prefetching);
+}
+
+bool SceneLoader::Prefetch(const std::shared_ptr<SceneLoadOperation>& operation,
+                           std::chrono::steady_clock::time_point deadline) {
+    AssetRegistry& registry = AssetRegistry::Instance();
+
+    if (!operation->m_ReadRequested) {
+        // Audio decodes in the decode queue's own jobs, so the clips only need to be requested.
+        for (UUID clip : operation->m_AudioClips) {
+            if (!registry.IsAssetLoaded(clip)) {
+                AudioDecodeQueue::Instance().Request(clip);
+            }
+        }
+        operation->m_AudioClips.clear();
+
+        // Only the lookup of each package happens here; the read job reads and unpacks them.
+        std::erase_if(operation->m_Assets, [&registry](UUID uuid) { return registry.IsAssetLoaded(uuid); });
+        operation->m_Prefetched.resize(operation->m_Assets.size());
+        for (size_t i = 0; i < operation->m_Assets.size(); ++i) {
+            if (!registry.GetAssetSource(operation->m_Assets[i], operation->m_Prefetched[i].source)) {
+                PX_LOG_WARNING(ASSET, "Asset not found in registry: %" PRIu64, operation->m_Assets[i].Get());
+            }
+        }
+        operation->m_ReadRequested = true;
+
+        if (!operation->m_Assets.empty()) {
+            JobSystem::Instance().Schedule([operation]() { ReadAssets(*operation); });
+        }
+    }
+
+    // Creating an asset can upload to the GPU, so the budget is checked before each one; the first one always runs
+    // so a load keeps moving even when earlier work used up the frame.
+    size_t readCount = operation->m_ReadCount.load(std::memory_order_acquire);
+    bool first = true;
+    while (operation->m_NextAsset < readCount) {
+        if (!first && std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+        first = false;
+
+        SceneLoadOperation::PrefetchedAsset& asset = operation->m_Prefetched[operation->m_NextAsset];
+        UUID uuid = operation->m_Assets[operation->m_NextAsset++];
+        if (asset.read && !registry.IsAssetLoaded(uuid) && !registry.LoadAssetFromData(asset.metadata, asset.data)) {
+            PX_LOG_WARNING(ASSET, "Failed to load asset %" PRIu64 " for scene %s", uuid.Get(),
+                           operation->m_Source.c_str());
+        }
+        asset = SceneLoadOperation::PrefetchedAsset{};
+    }
+
+    return operation->m_NextAsset == operation->m_Assets.size();
+}
+
+void SceneLoader::ReadAssets(SceneLoadOperation& operation) {
+    for (size_t i = operation.m_ReadCount.load(std::memory_order_relaxed); i < operation.m_Prefetched.size(); ++i) {
+        if (operation.IsDone()) {
+            return;
+        }
+
+        SceneLoadOperation::PrefetchedAsset& asset = operation.m_Prefetched[i];
+        const AssetSource& source = asset.source;
+        if (!source.sourcePath.empty()) {
+            AssetPackage package{};
+            asset.read = source.packageData.empty()
+                             ? package.LoadFromFile(source.packagePath, asset.metadata, asset.data)
+                             : package.LoadFromMemory(source.packageData.data(), source.packageData.size(),
+                                                      asset.metadata, asset.data);
+            asset.metadata.sourceFile = source.sourcePath;
+            if (!asset.read) {
+                PX_LOG_ERROR(ASSET, "Failed to read asset package: %s", source.sourcePath.c_str());
+            }
+        }
+        operation.m_ReadCount.store(i + 1, std::memory_order_release);
+    }
+}
+
+bool SceneLoader::InstantiateBinary(SceneLoadOperation& operation, Scene& scene) const {
+    BinarySceneSerializer serializer{&scene};
+    const std::vector<uint8_t>& data = operation.m_BinaryScene;
+
+    if (operation.m_Mode == SceneLoadMode::Single) {
+        if (!serializer.DeserializeFromMemory(data.data(), data.size())) {
+            return false;
+        }
+        const EntityOrder& entityOrder = scene.GetEntityOrder();
+        operation.m_Entities.assign(entityOrder.begin(), entityOrder.end());
+        return true;
+    }
+
+    return serializer.AppendFromMemory(data.data(), data.size(), operation.m_Entities);
+}
+
+bool SceneLoader::Instantiate(SceneLoadOperation& operation, Scene& scene,
+                              std::chrono::steady_clock::time_point deadline) const {
+    if (operation.m_EntityTotal == 0) {
+        return true;
+    }
+
+    entt::registry& registry = scene.GetRegistry();
+    EntityIndex& entityIndex = scene.GetEntityIndex();
+    nlohmann::json& entities = operation.m_SceneJson["entities"];
+
+    if (operation.m_NextEntity == 0) {
+        entityIndex.Reserve(entityIndex.GetCount() + operation.m_EntityTotal);
+        operation.m_Entities.reserve(operation.m_EntityTotal);
+    }
+
+    SceneSerializer serializer{&scene};
+    serializer.SetDeltaEncoding(SceneSerializer::IsDeltaEncoded(operation.m_SceneJson));
+    while (operation.m_NextEntity < operation.m_EntityTotal) {
+        nlohmann::json& entityJson = entities[operation.m_NextEntity++];
+
+        // Loading the same sub-scene twice would register every UUID twice; the copies get fresh UUIDs, so
+        // references inside the second copy keep pointing at the first one.
+        if (operation.m_Mode == SceneLoadMode::Additive && entityJson.contains("uuid") &&
+            entityIndex.HasEntity(UUID{entityJson["uuid"].get<uint64_t>()}))
+        {
+            entityJson["uuid"] = UUID{}.Get();
+        }
+
+        entt::entity entity = serializer.DeserializeEntity(entityJson);
+        scene.GetEntityOrder().Add(entity);
+        operation.m_Entities.push_back(entity);
+        CreateScriptInstances(registry, entity, entityJson);
+
+        if (operation.m_NextEntity % DeadlineCheckInterval == 0 && std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+
+    if (operation.m_NextEntity < operation.m_EntityTotal) {
+        return false;
+    }
+
+    if (operation.m_Mode == SceneLoadMode::Single) {
+        scene.SetPreloadAssets(operation.m_PreloadAssets);
+    }
+    return true;
+}
+
+} // namespace PiiXeL
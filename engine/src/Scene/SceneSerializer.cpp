@@ -1,29 +1,49 @@
 #include "Scene/SceneSerializer.hpp"
 
 #include "Components/Animator.hpp"
+#include "Components/AudioSource.hpp"
 #include "Components/BoxCollider2D.hpp"
 #include "Components/Camera.hpp"
 #include "Components/CircleCollider2D.hpp"
 #include "Components/ComponentModuleRegistry.hpp"
-#include "Components/RigidBody2D.hpp"
+#include "Components/PrefabInstance.hpp"
 #include "Components/Script.hpp"
-#include "Components/Sprite.hpp"
 #include "Components/Tag.hpp"
 #include "Components/Transform.hpp"
 #include "Components/UUID.hpp"
 #include "Core/Logger.hpp"
 #include "Reflection/Reflection.hpp"
 #include "Resources/AssetManager.hpp"
-#include "Scene/EntityRegistry.hpp"
+#include "Resources/AssetRegistry.hpp"
+#include "Resources/PrefabAsset.hpp"
 #include "Scene/Scene.hpp"
+#include "Scene/SceneJsonStream.hpp"
 #include "Scripting/ScriptComponent.hpp"
 
 #include <filesystem>
 #include <fstream>
+#include <sstream>
+#include <unordered_set>
 #include <raylib.h>
 
 namespace PiiXeL {
 
+namespace {
+constexpr const char* BaseKey{"base"};
+
+const nlohmann::json& NoBase() {
+    static const nlohmann::json base = nlohmann::json::object();
+    return base;
+}
+
+std::shared_ptr<PrefabAsset> LoadPrefab(UUID uuid) {
+    if (uuid.Get() == 0) {
+        return nullptr;
+    }
+    return std::dynamic_pointer_cast<PrefabAsset>(AssetRegistry::Instance().LoadAsset(uuid));
+}
+} // namespace
+
 SceneSerializer::SceneSerializer(Scene* scene) : m_Scene{scene} {}
 
 bool SceneSerializer::Serialize(const std::string& filepath) {
@@ -43,23 +63,13 @@ bool SceneSerializer::Serialize(const std::string& filepath) {
         }
     }
 
-    nlohmann::json sceneJson{};
-    sceneJson["scene"] = m_Scene->GetName();
-    sceneJson["entities"] = nlohmann::json::array();
-
-    const std::vector<entt::entity>& entityOrder = m_Scene->GetEntityOrder();
-    for (entt::entity entity : entityOrder) {
-        nlohmann::json entityJson = SerializeEntity(entity);
-        sceneJson["entities"].push_back(entityJson);
-    }
-
     std::ofstream file{filepath};
     if (!file.is_open()) {
         PX_LOG_ERROR(SCENE, "Failed to open file for writing: %s", filepath.c_str());
         return false;
     }
 
-    file << sceneJson.dump(4);
+    WriteScene(file, 4);
     file.close();
 
     PX_LOG_INFO(SCENE, "Scene saved to: %s", filepath.c_str());
@@ -77,35 +87,63 @@ bool SceneSerializer::Deserialize(const std::string& filepath) {
         return false;
     }
 
-    nlohmann::json sceneJson{};
-    try {
-        file >> sceneJson;
-    }
-    catch (const nlohmann::json::exception& e) {
-        PX_LOG_ERROR(SCENE, "Failed to parse JSON: %s", e.what());
+    Scene staging{m_Scene->GetName()};
+    SceneSerializer loader{&staging};
+    SceneJsonReader reader{[&loader](const nlohmann::json& entityJson, const nlohmann::json& header) {
+        loader.AddEntity(entityJson, header);
+    }};
+    bool parsed = reader.Parse(file);
+    file.close();
+
+    if (!loader.FinishRead(reader, parsed)) {
         return false;
     }
-    file.close();
+    m_Scene->Swap(staging);
 
-    entt::registry& registry = m_Scene->GetRegistry();
-    registry.clear();
-    EntityRegistry::Instance().Clear();
-    m_Scene->GetEntityOrder().clear();
+    PX_LOG_INFO(SCENE, "Scene loaded from: %s", filepath.c_str());
+    return true;
+}
 
-    if (sceneJson.contains("scene")) {
-        m_Scene->SetName(sceneJson["scene"].get<std::string>());
+void SceneSerializer::WriteScene(std::ostream& stream, int indent) {
+    SceneJsonWriter writer{stream, indent, m_DeltaEncoding};
+    for (entt::entity entity : m_Scene->GetEntityOrder()) {
+        writer.WriteEntity(SerializeEntity(entity));
     }
+    writer.Finish(SerializePreloadManifest(), m_Scene->GetName());
+}
 
-    if (sceneJson.contains("entities") && sceneJson["entities"].is_array()) {
-        for (const nlohmann::json& entityJson : sceneJson["entities"]) {
-            entt::entity entity = DeserializeEntity(entityJson);
-            if (entity != entt::null) {
-                m_Scene->GetEntityOrder().push_back(entity);
-            }
-        }
+// The writer puts "delta" before "entities", so the header already holds it when the first entity arrives. A file
+// that declares it later was read with the wrong encoding; FinishRead() rejects it.
+void SceneSerializer::AddEntity(const nlohmann::json& entityJson, const nlohmann::json& header) {
+    if (!m_EntitiesRead) {
+        m_EntitiesRead = true;
+        m_EntitiesDelta = IsDeltaEncoded(header);
     }
 
-    PX_LOG_INFO(SCENE, "Scene loaded from: %s", filepath.c_str());
+    entt::entity entity = CreateEntity(entityJson, m_EntitiesDelta);
+    if (entity != entt::null) {
+        m_Scene->GetEntityOrder().Add(entity);
+    }
+}
+
+// Entities are created in a staging scene while the document streams in, so a parse error only discards the
+// staging scene; the caller swaps it in after this succeeds.
+bool SceneSerializer::FinishRead(const SceneJsonReader& reader, bool parsed) {
+    if (!parsed) {
+        PX_LOG_ERROR(SCENE, "Failed to parse JSON: %s", reader.GetError().c_str());
+        return false;
+    }
+
+    const nlohmann::json& header = reader.GetHeader();
+    if (m_EntitiesRead && IsDeltaEncoded(header) != m_EntitiesDelta) {
+        PX_LOG_ERROR(SCENE, "Scene declares \"delta\" after its entities; it must come before \"entities\"");
+        return false;
+    }
+
+    if (header.contains("scene") && header["scene"].is_string()) {
+        m_Scene->SetName(header["scene"].get<std::string>());
+    }
+    m_Scene->SetPreloadAssets(ReadPreloadManifest(header));
     return true;
 }
 
@@ -118,65 +156,40 @@ nlohmann::json SceneSerializer::SerializeEntity(entt::entity entity) {
         entityJson["uuid"] = uuid.Get();
     }
 
-    if (registry.all_of<Sprite>(entity)) {
-        const Sprite& sprite = registry.get<Sprite>(entity);
-        entityJson["Sprite"] = {
-            {"textureAssetUUID", sprite.textureAssetUUID.Get()},
-            {"sourceRect",
-             {sprite.sourceRect.x, sprite.sourceRect.y, sprite.sourceRect.width, sprite.sourceRect.height}},
-            {"tint", {sprite.tint.r, sprite.tint.g, sprite.tint.b, sprite.tint.a}},
-            {"layer", sprite.layer},
-            {"origin", {sprite.origin.x, sprite.origin.y}}};
-    }
+    nlohmann::json moduleJson{};
+    if (m_DeltaEncoding) {
+        std::shared_ptr<PrefabAsset> prefab{};
+        if (const PrefabInstance* instance = registry.try_get<PrefabInstance>(entity)) {
+            prefab = LoadPrefab(instance->prefab);
+        }
 
-    if (registry.all_of<RigidBody2D>(entity)) {
-        const RigidBody2D& rb = registry.get<RigidBody2D>(entity);
-        entityJson["RigidBody2D"] = {{"type", static_cast<int>(rb.type)},
-                                     {"mass", rb.mass},
-                                     {"friction", rb.friction},
-                                     {"restitution", rb.restitution},
-                                     {"fixedRotation", rb.fixedRotation}};
+        // Without its prefab the entity is written against the type defaults, and without a base on load.
+        const nlohmann::json& base = prefab ? prefab->GetComponentsJson() : NoBase();
+        moduleJson = ComponentModuleRegistry::Instance().SerializeEntityDelta(registry, entity, base);
+        if (prefab) {
+            entityJson[BaseKey] = prefab->GetUUID().Get();
+        }
+    }
+    else {
+        moduleJson = ComponentModuleRegistry::Instance().SerializeEntity(registry, entity);
     }
 
-    nlohmann::json moduleJson = ComponentModuleRegistry::Instance().SerializeEntity(registry, entity);
     for (auto it = moduleJson.begin(); it != moduleJson.end(); ++it) {
         entityJson[it.key()] = it.value();
     }
 
     if (registry.all_of<Script>(entity)) {
-        const Script& scriptComponent = registry.get<Script>(entity);
-        nlohmann::json scriptsArray = nlohmann::json::array();
-
-        for (const ScriptInstance& script : scriptComponent.scripts) {
-            nlohmann::json scriptJson{};
-            scriptJson["scriptName"] = script.scriptName;
-            scriptJson["enabled"] = script.instance ? script.instance->m_Enabled : true;
-
-            if (script.instance) {
-                const Reflection::TypeInfo* typeInfo =
-                    Reflection::TypeRegistry::Instance().GetTypeInfo(typeid(*script.instance));
-                if (typeInfo) {
-                    nlohmann::json propertiesJson{};
-                    for (const Reflection::FieldInfo& field : typeInfo->GetFields()) {
-                        if (field.flags & Reflection::FieldFlags::Serializable) {
-                            void* fieldPtr = field.getPtr(static_cast<void*>(script.instance.get()));
-                            propertiesJson[field.name] = Reflection::JsonSerializer::SerializeField(field, fieldPtr);
-                        }
-                    }
-                    scriptJson["properties"] = propertiesJson;
-                }
-            }
-
-            scriptsArray.push_back(scriptJson);
-        }
-
-        entityJson["Scripts"] = scriptsArray;
+        entityJson["Scripts"] = SerializeScripts(registry.get<Script>(entity));
     }
 
     return entityJson;
 }
 
 entt::entity SceneSerializer::DeserializeEntity(const nlohmann::json& entityJson) {
+    return CreateEntity(entityJson, m_DeltaEncoding);
+}
+
+entt::entity SceneSerializer::CreateEntity(const nlohmann::json& entityJson, bool deltaEncoded) {
     entt::registry& registry = m_Scene->GetRegistry();
     entt::entity entity = registry.create();
 
@@ -185,65 +198,9 @@ entt::entity SceneSerializer::DeserializeEntity(const nlohmann::json& entityJson
         uuid = UUID(entityJson["uuid"].get<uint64_t>());
     }
     registry.emplace<UUID>(entity, uuid);
-    EntityRegistry::Instance().RegisterEntity(uuid, entity);
-
-    if (entityJson.contains("Sprite")) {
-        const nlohmann::json& spriteJson = entityJson["Sprite"];
-        Sprite sprite{};
-
-        if (spriteJson.contains("textureAssetUUID")) {
-            sprite.textureAssetUUID = UUID{spriteJson["textureAssetUUID"].get<uint64_t>()};
-        }
-
-        if (spriteJson.contains("sourceRect") && spriteJson["sourceRect"].is_array() &&
-            spriteJson["sourceRect"].size() == 4)
-        {
-            sprite.sourceRect.x = spriteJson["sourceRect"][0].get<float>();
-            sprite.sourceRect.y = spriteJson["sourceRect"][1].get<float>();
-            sprite.sourceRect.width = spriteJson["sourceRect"][2].get<float>();
-            sprite.sourceRect.height = spriteJson["sourceRect"][3].get<float>();
-        }
-
-        if (spriteJson.contains("tint") && spriteJson["tint"].is_array() && spriteJson["tint"].size() == 4) {
-            sprite.tint.r = spriteJson["tint"][0].get<unsigned char>();
-            sprite.tint.g = spriteJson["tint"][1].get<unsigned char>();
-            sprite.tint.b = spriteJson["tint"][2].get<unsigned char>();
-            sprite.tint.a = spriteJson["tint"][3].get<unsigned char>();
-        }
-
-        sprite.layer = spriteJson.value("layer", 0);
-
-        if (spriteJson.contains("origin") && spriteJson["origin"].is_array() && spriteJson["origin"].size() == 2) {
-            sprite.origin.x = spriteJson["origin"][0].get<float>();
-            sprite.origin.y = spriteJson["origin"][1].get<float>();
-        }
-
-        registry.emplace<Sprite>(entity, sprite);
-    }
-
-    if (entityJson.contains("RigidBody2D")) {
-        const nlohmann::json& rbJson = entityJson["RigidBody2D"];
-        RigidBody2D rb{};
-
-        rb.type = static_cast<BodyType>(rbJson.value("type", 0));
-        rb.mass = rbJson.value("mass", 1.0f);
-        rb.friction = rbJson.value("friction", 0.3f);
-        rb.restitution = rbJson.value("restitution", 0.0f);
-        rb.fixedRotation = rbJson.value("fixedRotation", false);
-
-        registry.emplace<RigidBody2D>(entity, rb);
-    }
-
-    for (auto it = entityJson.begin(); it != entityJson.end(); ++it) {
-        const std::string& componentName = it.key();
-        if (componentName == "uuid" || componentName == "Sprite" || componentName == "RigidBody2D" ||
-            componentName == "Scripts" || componentName == "Script")
-        {
-            continue;
-        }
+    m_Scene->GetEntityIndex().Register(uuid, entity);
 
-        ComponentModuleRegistry::Instance().DeserializeComponent(componentName, registry, entity, it.value());
-    }
+    DeserializeComponents(registry, entity, entityJson, deltaEncoded);
 
     if (entityJson.contains("Scripts") && entityJson["Scripts"].is_array()) {
         Script scriptComponent{};
@@ -270,55 +227,132 @@ entt::entity SceneSerializer::DeserializeEntity(const nlohmann::json& entityJson
     return entity;
 }
 
-std::string SceneSerializer::SerializeToString() {
-    if (!m_Scene) {
-        return "";
-    }
+bool SceneSerializer::IsDeltaEncoded(const nlohmann::json& sceneJson) {
+    return sceneJson.contains("delta") && sceneJson["delta"].is_boolean() && sceneJson["delta"].get<bool>();
+}
 
-    nlohmann::json sceneJson{};
-    sceneJson["scene"] = m_Scene->GetName();
-    sceneJson["entities"] = nlohmann::json::array();
+void SceneSerializer::DeserializeComponents(entt::registry& registry, entt::entity entity,
+                                            const nlohmann::json& entityJson, bool deltaEncoded) {
+    ComponentModuleRegistry& moduleRegistry = ComponentModuleRegistry::Instance();
+    if (!deltaEncoded) {
+        moduleRegistry.DeserializeEntity(registry, entity, entityJson);
+        return;
+    }
 
-    const std::vector<entt::entity>& entityOrder = m_Scene->GetEntityOrder();
-    for (entt::entity entity : entityOrder) {
-        nlohmann::json entityJson = SerializeEntity(entity);
-        sceneJson["entities"].push_back(entityJson);
+    std::shared_ptr<PrefabAsset> prefab{};
+    if (entityJson.contains(BaseKey) && entityJson[BaseKey].is_number_unsigned()) {
+        UUID prefabUUID{entityJson[BaseKey].get<uint64_t>()};
+        prefab = LoadPrefab(prefabUUID);
+        if (!prefab) {
+            PX_LOG_WARNING(SCENE, "Prefab %s of a delta-encoded entity is missing, its inherited components are lost",
+                           prefabUUID.ToString().c_str());
+        }
     }
 
-    return sceneJson.dump();
+    const nlohmann::json& base = prefab ? prefab->GetComponentsJson() : NoBase();
+    moduleRegistry.DeserializeEntityDelta(registry, entity, entityJson, base);
 }
 
-bool SceneSerializer::DeserializeFromString(const std::string& data) {
-    if (!m_Scene || data.empty()) {
-        return false;
+nlohmann::json SceneSerializer::SerializeScripts(const Script& scriptComponent) {
+    nlohmann::json scriptsArray = nlohmann::json::array();
+
+    for (const ScriptInstance& script : scriptComponent.scripts) {
+        nlohmann::json scriptJson{};
+        scriptJson["scriptName"] = script.scriptName;
+        scriptJson["enabled"] = script.instance ? script.instance->m_Enabled : true;
+
+        if (script.instance) {
+            const Reflection::TypeInfo* typeInfo =
+                Reflection::TypeRegistry::Instance().GetTypeInfo(typeid(*script.instance));
+            if (typeInfo) {
+                nlohmann::json propertiesJson{};
+                for (const Reflection::FieldInfo& field : typeInfo->GetFields()) {
+                    if (field.flags & Reflection::FieldFlags::Serializable) {
+                        void* fieldPtr = field.getPtr(static_cast<void*>(script.instance.get()));
+                        propertiesJson[field.name] = Reflection::JsonSerializer::SerializeField(field, fieldPtr);
+                    }
+                }
+                scriptJson["properties"] = propertiesJson;
+            }
+        }
+
+        scriptsArray.push_back(scriptJson);
     }
 
-    nlohmann::json sceneJson{};
-    try {
-        sceneJson = nlohmann::json::parse(data);
+    return scriptsArray;
+}
+
+void SceneSerializer::ApplyScriptProperties(ScriptComponent& script, const nlohmann::json& scriptJson) {
+    if (scriptJson.contains("properties")) {
+        const nlohmann::json& propertiesJson = scriptJson["properties"];
+        const Reflection::TypeInfo* typeInfo = Reflection::TypeRegistry::Instance().GetTypeInfo(typeid(script));
+
+        if (typeInfo) {
+            for (const Reflection::FieldInfo& field : typeInfo->GetFields()) {
+                if ((field.flags & Reflection::FieldFlags::Serializable) && propertiesJson.contains(field.name)) {
+                    void* fieldPtr = field.getPtr(static_cast<void*>(&script));
+                    Reflection::JsonSerializer::DeserializeField(field, propertiesJson[field.name], fieldPtr);
+                }
+            }
+        }
     }
-    catch (const nlohmann::json::exception& e) {
-        PX_LOG_ERROR(SCENE, "Failed to parse JSON from string: %s", e.what());
-        return false;
+
+    if (scriptJson.contains("enabled")) {
+        script.m_Enabled = scriptJson["enabled"].get<bool>();
     }
+}
 
-    entt::registry& registry = m_Scene->GetRegistry();
-    registry.clear();
-    EntityRegistry::Instance().Clear();
-    m_Scene->GetEntityOrder().clear();
+nlohmann::json SceneSerializer::SerializePreloadManifest() {
+    nlohmann::json manifest = nlohmann::json::array();
+    std::unordered_set<UUID> seen{};
+
+    m_Scene->GetRegistry().view<AudioSource>().each([&manifest, &seen](const AudioSource& source) {
+        if (source.audioClip.Get() != 0 && seen.insert(source.audioClip).second) {
+            manifest.push_back(source.audioClip.Get());
+        }
+    });
+
+    return manifest;
+}
 
-    if (sceneJson.contains("scene")) {
-        m_Scene->SetName(sceneJson["scene"].get<std::string>());
+std::vector<UUID> SceneSerializer::ReadPreloadManifest(const nlohmann::json& sceneJson) {
+    std::vector<UUID> assets{};
+    if (!sceneJson.contains("preload") || !sceneJson["preload"].is_array()) {
+        return assets;
     }
 
-    if (sceneJson.contains("entities") && sceneJson["entities"].is_array()) {
-        for (const nlohmann::json& entityJson : sceneJson["entities"]) {
-            entt::entity entity = DeserializeEntity(entityJson);
-            if (entity != entt::null) {
-                m_Scene->GetEntityOrder().push_back(entity);
-            }
+    for (const nlohmann::json& uuidJson : sceneJson["preload"]) {
+        if (uuidJson.is_number_unsigned()) {
+            assets.emplace_back(uuidJson.get<uint64_t>());
         }
     }
+    return assets;
+}
+
+std::string SceneSerializer::SerializeToString() {
+    if (!m_Scene) {
+        return "";
+    }
+
+    std::ostringstream stream{};
+    WriteScene(stream, -1);
+    return stream.str();
+}
+
+bool SceneSerializer::DeserializeFromString(const std::string& data) {
+    if (!m_Scene || data.empty()) {
+        return false;
+    }
+
+    Scene staging{m_Scene->GetName()};
+    SceneSerializer loader{&staging};
+    SceneJsonReader reader{[&loader](const nlohmann::json& entityJson, const nlohmann::json& header) {
+        loader.AddEntity(entityJson, header);
+    }};
+    if (!loader.FinishRead(reader, reader.Parse(data))) {
+        return false;
+    }
+    m_Scene->Swap(staging);
 
     PX_LOG_INFO(SCENE, "Scene loaded from memory snapshot");
     return true;
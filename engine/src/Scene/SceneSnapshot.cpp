@@ -0,0 +1,179 @@
+#include "Scene/SceneSnapshot.hpp"
+
+#include "Components/ComponentModuleRegistry.hpp"
+#include "Components/Script.hpp"
+#include "Components/UUID.hpp"
+#include "Reflection/Reflection.hpp"
+#include "Scene/Scene.hpp"
+#include "Scripting/ScriptComponent.hpp"
+#include "Scripting/ScriptRegistry.hpp"
+
+#include <cstring>
+#include <typeindex>
+
+namespace PiiXeL {
+
+namespace {
+template <typename T>
+void CopyStorage(const entt::registry& source, entt::registry& destination) {
+    const entt::storage_for_t<T>* storage = source.storage<T>();
+    if (storage && !storage->empty()) {
+        const entt::sparse_set& entities = *storage;
+        destination.insert<T>(entities.begin(), entities.end(), storage->begin());
+    }
+}
+
+// Fields whose value lives entirely inside the script object, so they can be copied byte-wise.
+bool IsPlainField(const Reflection::FieldInfo& field) {
+    switch (field.type) {
+        case Reflection::FieldType::Float:
+        case Reflection::FieldType::Int:
+        case Reflection::FieldType::Bool:
+        case Reflection::FieldType::Vector2:
+        case Reflection::FieldType::Color:
+        case Reflection::FieldType::Entity:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool IsSnapshotField(const Reflection::FieldInfo& field) {
+    return (field.flags & Reflection::FieldFlags::Serializable) != 0;
+}
+} // namespace
+
+void SceneSnapshot::Capture(Scene& scene) {
+    Clear();
+
+    entt::registry& registry = scene.GetRegistry();
+    for (entt::entity entity : registry.view<entt::entity>()) {
+        m_Registry.create(entity);
+    }
+
+    CopyStorage<UUID>(registry, m_Registry);
+    for (const std::shared_ptr<IComponentModule>& module : ComponentModuleRegistry::Instance().GetAllModules()) {
+        module->CopyStorage(registry, m_Registry);
+    }
+
+    // The copies only carry script names; the live instances stay with the play-mode registry.
+    Reflection::TypeRegistry& typeRegistry = Reflection::TypeRegistry::Instance();
+    for (auto [entity, scriptComponent] : registry.view<Script>().each()) {
+        Script copy{};
+        copy.scripts.reserve(scriptComponent.scripts.size());
+
+        for (size_t i = 0; i < scriptComponent.scripts.size(); ++i) {
+            const ScriptInstance& script = scriptComponent.scripts[i];
+            ScriptInstance& scriptCopy = copy.scripts.emplace_back();
+            scriptCopy.scriptName = script.scriptName;
+            scriptCopy.typeIndex = script.typeIndex;
+
+            if (!script.instance) {
+                continue;
+            }
+
+            const Reflection::TypeInfo* typeInfo = typeRegistry.GetTypeInfo(typeid(*script.instance));
+            m_Scripts.push_back({entity, static_cast<uint32_t>(i), script.instance->m_Enabled, typeInfo,
+                                 m_PropertyData.size(), m_PropertyValues.size()});
+            if (!typeInfo) {
+                continue;
+            }
+
+            const void* instance = script.instance.get();
+            for (const Reflection::FieldInfo& field : typeInfo->GetFields()) {
+                if (!IsSnapshotField(field)) {
+                    continue;
+                }
+
+                if (IsPlainField(field)) {
+                    const uint8_t* bytes = static_cast<const uint8_t*>(field.getConstPtr(instance));
+                    m_PropertyData.insert(m_PropertyData.end(), bytes, bytes + field.size);
+                }
+                else {
+                    m_PropertyValues.push_back(field.getValue(instance));
+                }
+            }
+        }
+
+        m_Registry.emplace<Script>(entity, std::move(copy));
+    }
+
+    m_EntityOrder = scene.GetEntityOrder();
+    m_Captured = true;
+}
+
+bool SceneSnapshot::Restore(Scene& scene) {
+    if (!m_Captured) {
+        return false;
+    }
+
+    // Queued destroys name play-mode entities and must not reach the restored registry.
+    scene.FlushDestroyedEntities();
+
+    entt::registry& registry = scene.GetRegistry();
+    registry.swap(m_Registry);
+    m_Registry.ctx().erase<EntityIndex*>();
+
+    scene.GetEntityOrder() = std::move(m_EntityOrder);
+
+    // The swap moved the context as well, so the index has to announce itself to the restored registry again.
+    EntityIndex& entityIndex = scene.GetEntityIndex();
+    entityIndex.BindContext();
+    entityIndex.Clear();
+    std::vector<std::pair<UUID, entt::entity>> indexEntries{};
+    indexEntries.reserve(scene.GetEntityOrder().size());
+    for (entt::entity entity : scene.GetEntityOrder()) {
+        if (const UUID* uuid = registry.try_get<UUID>(entity)) {
+            indexEntries.emplace_back(*uuid, entity);
+        }
+    }
+    entityIndex.RegisterEntities(indexEntries);
+
+    ScriptRegistry& scriptRegistry = ScriptRegistry::Instance();
+    for (const ScriptState& state : m_Scripts) {
+        ScriptInstance& script = registry.get<Script>(state.entity).scripts[state.scriptIndex];
+        script.instance = scriptRegistry.CreateScript(script.scriptName);
+        if (!script.instance) {
+            continue;
+        }
+
+        if (state.typeInfo && state.typeInfo->GetTypeIndex() == std::type_index(typeid(*script.instance))) {
+            void* instance = script.instance.get();
+            size_t dataOffset = state.dataOffset;
+            size_t valueOffset = state.valueOffset;
+
+            for (const Reflection::FieldInfo& field : state.typeInfo->GetFields()) {
+                if (!IsSnapshotField(field)) {
+                    continue;
+                }
+
+                if (IsPlainField(field)) {
+                    std::memcpy(field.getPtr(instance), m_PropertyData.data() + dataOffset, field.size);
+                    dataOffset += field.size;
+                }
+                else {
+                    field.setValue(instance, m_PropertyValues[valueOffset++]);
+                }
+            }
+        }
+
+        script.instance->m_Enabled = state.enabled;
+        script.instance->Initialize(state.entity, &scene);
+    }
+
+    // Releases the play-mode registry, including its context, in one go.
+    Clear();
+    return true;
+}
+
+void SceneSnapshot::Clear() {
+    // A fresh registry, so Capture() can recreate entities with exactly their original identifiers.
+    m_Registry = entt::registry{};
+    m_EntityOrder.Clear();
+    m_Scripts.clear();
+    m_PropertyData.clear();
+    m_PropertyValues.clear();
+    m_Captured = false;
+}
+
+} // namespace PiiXeL
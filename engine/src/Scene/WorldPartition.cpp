@@ -0,0 +1,320 @@
+#include "Scene/WorldPartition.hpp"
+
+#include "Build/GamePackage.hpp"
+#include "Components/AudioListener.hpp"
+#include "Components/Camera.hpp"
+#include "Components/Transform.hpp"
+#include "Core/Logger.hpp"
+#include "Scene/BinarySceneSerializer.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneLoader.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <utility>
+
+namespace PiiXeL {
+
+namespace {
+// Keeps cell coordinates and the neighbourhood around them well inside int32_t.
+constexpr float MaxCellCoordinate{1 << 30};
+
+constexpr const char* PersistentChunkName{"persistent"};
+
+// Failed cell loads are retried while the cell stays in range, up to this many attempts in total.
+constexpr uint32_t MaxCellLoadAttempts{3};
+
+int32_t ToCellCoordinate(float position, float cellSize) {
+    float cell = std::floor(position / cellSize);
+    if (!(cell > -MaxCellCoordinate)) {
+        return static_cast<int32_t>(-MaxCellCoordinate);
+    }
+    return static_cast<int32_t>(std::min(cell, MaxCellCoordinate));
+}
+
+int32_t CellDistance(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    return std::max(std::abs(x0 - x1), std::abs(y0 - y1));
+}
+
+bool WriteChunk(const std::filesystem::path& path, const std::vector<uint8_t>& data) {
+    std::ofstream file{path, std::ios::binary};
+    if (!file.is_open()) {
+        PX_LOG_ERROR(SCENE, "Failed to open file for writing: %s", path.string().c_str());
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return static_cast<bool>(file);
+}
+
+bool IsPersistent(const entt::registry& registry, entt::entity entity) {
+    return !registry.all_of<Transform>(entity) || registry.any_of<Camera, AudioListener>(entity);
+}
+} // namespace
+
+bool WorldPartition::Build(Scene& scene, const std::string& manifestPath, const WorldPartitionSettings& settings) {
+    if (!(settings.cellSize > 0.0f)) {
+        PX_LOG_ERROR(SCENE, "World partition cell size must be positive: %f", settings.cellSize);
+        return false;
+    }
+
+    std::filesystem::path manifest{manifestPath};
+    std::filesystem::path directory = manifest.parent_path();
+    std::string chunkFolder = manifest.stem().string() + "_cells";
+    std::filesystem::path chunkDirectory = directory / chunkFolder;
+
+    // Cells that became empty must not survive from an earlier build.
+    std::error_code error{};
+    std::filesystem::remove_all(chunkDirectory, error);
+    if (!std::filesystem::create_directories(chunkDirectory, error)) {
+        PX_LOG_ERROR(SCENE, "Failed to create directory: %s", chunkDirectory.string().c_str());
+        return false;
+    }
+
+    entt::registry& registry = scene.GetRegistry();
+    std::vector<entt::entity> persistent{};
+    std::map<std::pair<int32_t, int32_t>, std::vector<entt::entity>> cells{};
+    for (entt::entity entity : scene.GetEntityOrder()) {
+        if (IsPersistent(registry, entity)) {
+            persistent.push_back(entity);
+            continue;
+        }
+
+        const Vector2& position = registry.get<Transform>(entity).position;
+        std::pair<int32_t, int32_t> cell{ToCellCoordinate(position.x, settings.cellSize),
+                                         ToCellCoordinate(position.y, settings.cellSize)};
+        cells[cell].push_back(entity);
+    }
+
+    BinarySceneSerializer serializer{&scene};
+    std::string persistentChunk = chunkFolder + "/" + PersistentChunkName + BinarySceneSerializer::FileExtension;
+    if (!WriteChunk(directory / persistentChunk, serializer.SerializeToMemory(persistent))) {
+        return false;
+    }
+
+    nlohmann::json manifestJson{};
+    manifestJson["scene"] = scene.GetName();
+    manifestJson["cellSize"] = settings.cellSize;
+    manifestJson["loadRadius"] = std::max(settings.loadRadius, 0);
+    manifestJson["unloadRadius"] = std::max(settings.unloadRadius, std::max(settings.loadRadius, 0) + 1);
+    manifestJson["persistent"] = persistentChunk;
+    manifestJson["cells"] = nlohmann::json::array();
+
+    for (const auto& [coordinate, entities] : cells) {
+        std::string chunk = chunkFolder + "/cell_" + std::to_string(coordinate.first) + "_" +
+                            std::to_string(coordinate.second) + BinarySceneSerializer::FileExtension;
+        if (!WriteChunk(directory / chunk, serializer.SerializeToMemory(entities))) {
+            return false;
+        }
+
+        manifestJson["cells"].push_back(
+            {{"x", coordinate.first}, {"y", coordinate.second}, {"chunk", chunk}, {"entities", entities.size()}});
+    }
+
+    std::ofstream file{manifestPath};
+    if (!file.is_open()) {
+        PX_LOG_ERROR(SCENE, "Failed to open file for writing: %s", manifestPath.c_str());
+        return false;
+    }
+    file << manifestJson.dump(4);
+
+    PX_LOG_INFO(SCENE, "World partition saved to: %s (%zu cells, %zu persistent entities)", manifestPath.c_str(),
+                cells.size(), persistent.size());
+    return true;
+}
+
+bool WorldPartition::Open(const std::string& manifestPath) {
+    Close();
+
+    std::ifstream file{manifestPath};
+    if (!file.is_open()) {
+        PX_LOG_ERROR(SCENE, "Failed to open file for reading: %s", manifestPath.c_str());
+        return false;
+    }
+
+    return ReadManifest(nlohmann::json::parse(file, nullptr, false), manifestPath);
+}
+
+bool WorldPartition::Open(const GamePackage& package, const std::string& manifestPath) {
+    Close();
+
+    const AssetData* manifest = package.GetAsset(manifestPath);
+    if (!manifest) {
+        PX_LOG_ERROR(SCENE, "World partition not found in package: %s", manifestPath.c_str());
+        return false;
+    }
+
+    m_Package = &package;
+    return ReadManifest(nlohmann::json::parse(manifest->data.begin(), manifest->data.end(), nullptr, false),
+                        manifestPath);
+}
+
+bool WorldPartition::ReadManifest(const nlohmann::json& manifestJson, const std::string& manifestPath) {
+    // Chunk paths are relative to the manifest, on disk and inside a package alike.
+    std::filesystem::path directory = std::filesystem::path{manifestPath}.parent_path();
+    try {
+        if (manifestJson.is_discarded()) {
+            PX_LOG_ERROR(SCENE, "Failed to parse world partition: %s", manifestPath.c_str());
+            Close();
+            return false;
+        }
+
+        const WorldPartitionSettings defaults{};
+        m_Settings.cellSize = manifestJson.value("cellSize", defaults.cellSize);
+        m_Settings.loadRadius = std::max(manifestJson.value("loadRadius", defaults.loadRadius), 0);
+        m_Settings.unloadRadius =
+            std::max(manifestJson.value("unloadRadius", defaults.unloadRadius), m_Settings.loadRadius + 1);
+        if (!(m_Settings.cellSize > 0.0f)) {
+            PX_LOG_ERROR(SCENE, "World partition has an invalid cell size: %s", manifestPath.c_str());
+            Close();
+            return false;
+        }
+
+        m_PersistentChunk = (directory / manifestJson.at("persistent").get<std::string>()).generic_string();
+
+        for (const nlohmann::json& cellJson : manifestJson.at("cells")) {
+            Cell cell{};
+            cell.x = cellJson.at("x").get<int32_t>();
+            cell.y = cellJson.at("y").get<int32_t>();
+            cell.chunk = (directory / cellJson.at("chunk").get<std::string>()).generic_string();
+            m_Cells.emplace(CellKey(cell.x, cell.y), std::move(cell));
+        }
+    }
+    catch (const nlohmann::json::exception& e) {
+        PX_LOG_ERROR(SCENE, "Failed to parse world partition %s: %s", manifestPath.c_str(), e.what());
+        Close();
+        return false;
+    }
+
+    m_Open = true;
+    PX_LOG_INFO(SCENE, "World partition opened: %s (%zu cells)", manifestPath.c_str(), m_Cells.size());
+    return true;
+}
+
+bool WorldPartition::LoadPersistentChunk(Scene& scene) const {
+    BinarySceneSerializer serializer{&scene};
+    if (!m_Package) {
+        return serializer.Deserialize(m_PersistentChunk);
+    }
+
+    const AssetData* chunk = m_Package->GetAsset(m_PersistentChunk);
+    if (!chunk) {
+        PX_LOG_ERROR(SCENE, "World partition chunk not found in package: %s", m_PersistentChunk.c_str());
+        return false;
+    }
+    return serializer.DeserializeFromMemory(chunk->data.data(), chunk->data.size());
+}
+
+void WorldPartition::Close() {
+    // Cell loads still queued belong to this world, not to whatever scene becomes active next.
+    for (uint64_t key : m_ActiveCells) {
+        if (const std::shared_ptr<SceneLoadOperation>& operation = m_Cells.at(key).operation) {
+            operation->Cancel();
+        }
+    }
+
+    m_Open = false;
+    m_Package = nullptr;
+    m_Settings = WorldPartitionSettings{};
+    m_PersistentChunk.clear();
+    m_Cells.clear();
+    m_ActiveCells.clear();
+    m_HasFocus = false;
+}
+
+std::vector<std::shared_ptr<SceneLoadOperation>> WorldPartition::Update(Vector2 focus, SceneLoader& loader) {
+    std::vector<std::shared_ptr<SceneLoadOperation>> unloads{};
+    if (!m_Open) {
+        return unloads;
+    }
+
+    int32_t focusX = CellCoordinate(focus.x);
+    int32_t focusY = CellCoordinate(focus.y);
+    bool focusMoved = !m_HasFocus || focusX != m_FocusX || focusY != m_FocusY;
+    m_FocusX = focusX;
+    m_FocusY = focusY;
+    m_HasFocus = true;
+
+    // A load still in flight cannot be cancelled; it is unloaded once it has finished. A failed load leaves the
+    // active set at once, so the cell is requested again below while it is in range.
+    bool retry = false;
+    std::erase_if(m_ActiveCells, [&](uint64_t key) {
+        Cell& cell = m_Cells.at(key);
+        if (cell.operation->GetState() == SceneLoadState::Failed) {
+            cell.operation.reset();
+            if (++cell.failedLoads >= MaxCellLoadAttempts) {
+                PX_LOG_ERROR(SCENE, "World partition cell (%d, %d) failed to load %u times and is skipped: %s",
+                             cell.x, cell.y, cell.failedLoads, cell.chunk.c_str());
+            }
+            else {
+                retry = true;
+            }
+            return true;
+        }
+
+        if (CellDistance(cell.x, cell.y, focusX, focusY) <= m_Settings.unloadRadius || !cell.operation->IsDone()) {
+            return false;
+        }
+
+        if (cell.operation->GetState() == SceneLoadState::Completed) {
+            unloads.push_back(std::move(cell.operation));
+        }
+        cell.operation.reset();
+        return true;
+    });
+
+    if (!focusMoved && !retry) {
+        return unloads;
+    }
+
+    std::vector<Cell*> requests{};
+    const int32_t radius = m_Settings.loadRadius;
+    for (int32_t y = focusY - radius; y <= focusY + radius; ++y) {
+        for (int32_t x = focusX - radius; x <= focusX + radius; ++x) {
+            auto it = m_Cells.find(CellKey(x, y));
+            if (it != m_Cells.end() && !it->second.operation && it->second.failedLoads < MaxCellLoadAttempts) {
+                requests.push_back(&it->second);
+            }
+        }
+    }
+
+    std::sort(requests.begin(), requests.end(), [focusX, focusY](const Cell* a, const Cell* b) {
+        int64_t distanceA = static_cast<int64_t>(a->x - focusX) * (a->x - focusX) +
+                            static_cast<int64_t>(a->y - focusY) * (a->y - focusY);
+        int64_t distanceB = static_cast<int64_t>(b->x - focusX) * (b->x - focusX) +
+                            static_cast<int64_t>(b->y - focusY) * (b->y - focusY);
+        return distanceA < distanceB;
+    });
+
+    for (Cell* cell : requests) {
+        if (m_Package) {
+            const AssetData* chunk = m_Package->GetAsset(cell->chunk);
+            if (!chunk) {
+                PX_LOG_ERROR(SCENE, "World partition chunk not found in package: %s", cell->chunk.c_str());
+                cell->failedLoads = MaxCellLoadAttempts;
+                continue;
+            }
+            cell->operation = loader.LoadAsync(chunk->data, cell->chunk, SceneLoadMode::Additive);
+        }
+        else {
+            cell->operation = loader.LoadAsync(cell->chunk, SceneLoadMode::Additive);
+        }
+        m_ActiveCells.push_back(CellKey(cell->x, cell->y));
+    }
+
+    return unloads;
+}
+
+uint64_t WorldPartition::CellKey(int32_t x, int32_t y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+int32_t WorldPartition::CellCoordinate(float position) const {
+    return ToCellCoordinate(position, m_Settings.cellSize);
+}
+
+} // namespace PiiXeL
@@ -183,7 +183,7 @@ float AudioSourceHandle::GetMaxDistance() const {
 
 bool AudioSourceHandle::IsPlaying() const {
     if (IsValid()) {
-        return m_Component->state == AudioSourceState::Playing;
+        return m_Component->state == AudioSourceState::Playing || m_Component->state == AudioSourceState::Pending;
     }
     return false;
 }
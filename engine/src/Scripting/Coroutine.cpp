@@ -0,0 +1,103 @@
+#include "Scripting/Coroutine.hpp"
+
+#include "Components/Animator.hpp"
+#include "Core/Logger.hpp"
+#include "Scripting/CoroutineScheduler.hpp"
+
+namespace PiiXeL {
+
+CoroutineFrameAllocator& CoroutineFrameAllocator::Instance() {
+    static CoroutineFrameAllocator instance{};
+    return instance;
+}
+
+CoroutineFrameAllocator::~CoroutineFrameAllocator() {
+    for (void* chunk : m_Chunks) {
+        ::operator delete(chunk);
+    }
+}
+
+size_t CoroutineFrameAllocator::GetSizeClass(size_t size) {
+    size_t sizeClass = 0;
+    size_t blockSize = MinBlockSize;
+    while (sizeClass < ClassCount && blockSize < size) {
+        blockSize <<= 1;
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+void* CoroutineFrameAllocator::Allocate(size_t size) {
+    size_t sizeClass = GetSizeClass(size);
+    if (sizeClass == ClassCount) {
+        return ::operator new(size);
+    }
+
+    std::lock_guard<std::mutex> lock{m_Mutex};
+    if (!m_FreeLists[sizeClass]) {
+        size_t blockSize = MinBlockSize << sizeClass;
+        char* chunk = static_cast<char*>(::operator new(ChunkSize));
+        m_Chunks.push_back(chunk);
+
+        for (size_t offset = 0; offset + blockSize <= ChunkSize; offset += blockSize) {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + offset);
+            block->next = m_FreeLists[sizeClass];
+            m_FreeLists[sizeClass] = block;
+        }
+    }
+
+    FreeBlock* block = m_FreeLists[sizeClass];
+    m_FreeLists[sizeClass] = block->next;
+    return block;
+}
+
+void CoroutineFrameAllocator::Deallocate(void* ptr, size_t size) {
+    size_t sizeClass = GetSizeClass(size);
+    if (sizeClass == ClassCount) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock{m_Mutex};
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+    block->next = m_FreeLists[sizeClass];
+    m_FreeLists[sizeClass] = block;
+}
+
+void Coroutine::promise_type::unhandled_exception() {
+    PX_LOG_ERROR(SCRIPT, "Unhandled exception in script coroutine");
+}
+
+void WaitSeconds::await_suspend(Coroutine::Handle handle) const {
+    handle.promise().scheduler->ScheduleAfter(handle.promise().record, seconds);
+}
+
+void NextFrame::await_suspend(Coroutine::Handle handle) const {
+    handle.promise().scheduler->ScheduleNextFrame(handle.promise().record);
+}
+
+void NextFixedStep::await_suspend(Coroutine::Handle handle) const {
+    handle.promise().scheduler->ScheduleNextFixedStep(handle.promise().record);
+}
+
+void WaitUntil::await_suspend(Coroutine::Handle handle) {
+    handle.promise().scheduler->ScheduleWhen(handle.promise().record, std::move(predicate));
+}
+
+void AnimationFinished::await_suspend(Coroutine::Handle handle) const {
+    CoroutineScheduler* scheduler = handle.promise().scheduler;
+    entt::registry* registry = &scheduler->GetRegistry();
+    entt::entity target = entity;
+
+    // Conditions are first polled next frame, after AnimationSystem has applied any transition the script
+    // just triggered, so a stale isFinished from the previous state does not resume it early.
+    scheduler->ScheduleWhen(handle.promise().record, [registry, target]() {
+        if (!registry->valid(target)) {
+            return true;
+        }
+        const Animator* animator = registry->try_get<Animator>(target);
+        return !animator || (animator->isFinished && !animator->isTransitioning);
+    });
+}
+
+} // namespace PiiXeL
@@ -0,0 +1,260 @@
+#include "Scripting/CoroutineScheduler.hpp"
+
+#include "Components/Script.hpp"
+#include "Core/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace PiiXeL {
+
+CoroutineScheduler::CoroutineScheduler(entt::registry& registry) : m_Registry{registry} {}
+
+CoroutineScheduler::~CoroutineScheduler() {
+    for (Record& record : m_Records) {
+        if (record.handle) {
+            record.handle.destroy();
+            record.handle = nullptr;
+        }
+    }
+}
+
+CoroutineScheduler& CoroutineScheduler::Get(entt::registry& registry) {
+    if (CoroutineScheduler* scheduler = registry.ctx().find<CoroutineScheduler>()) {
+        return *scheduler;
+    }
+
+    CoroutineScheduler& scheduler = registry.ctx().emplace<CoroutineScheduler>(registry);
+    registry.on_destroy<Script>().connect<&CoroutineScheduler::OnScriptDestroyed>(scheduler);
+    return scheduler;
+}
+
+CoroutineId CoroutineScheduler::Start(Coroutine coroutine, entt::entity entity, const std::shared_ptr<void>& owner) {
+    Coroutine::Handle handle = coroutine.Release();
+    if (!handle) {
+        return {};
+    }
+
+    uint32_t index{0};
+    if (!m_FreeRecords.empty()) {
+        index = m_FreeRecords.back();
+        m_FreeRecords.pop_back();
+    }
+    else {
+        index = static_cast<uint32_t>(m_Records.size());
+        m_Records.emplace_back();
+    }
+
+    Record& record = m_Records[index];
+    record.handle = handle;
+    record.owner = owner;
+    record.ownerKey = owner.get();
+    record.entity = entity;
+    record.waiting = false;
+    record.running = false;
+    record.cancelled = false;
+
+    handle.promise().scheduler = this;
+    handle.promise().record = index;
+
+    if (entity != entt::null) {
+        m_EntityRecords[entity].push_back(index);
+    }
+    ++m_ActiveCount;
+
+    CoroutineId id = MakeId(index);
+    Resume(id);
+    return id;
+}
+
+void CoroutineScheduler::Stop(CoroutineId id) {
+    if (IsLive(id)) {
+        Cancel(id.index);
+    }
+}
+
+void CoroutineScheduler::StopOwner(const void* owner) {
+    if (!owner) {
+        return;
+    }
+
+    for (uint32_t index = 0; index < m_Records.size(); ++index) {
+        if (m_Records[index].handle && m_Records[index].ownerKey == owner) {
+            Cancel(index);
+        }
+    }
+}
+
+void CoroutineScheduler::StopEntity(entt::entity entity) {
+    auto it = m_EntityRecords.find(entity);
+    if (it == m_EntityRecords.end()) {
+        return;
+    }
+
+    std::vector<uint32_t> records = it->second;
+    for (uint32_t index : records) {
+        Cancel(index);
+    }
+}
+
+void CoroutineScheduler::Update(float deltaTime) {
+    // Taken before anything resumes so a coroutine that yields again this frame waits for the next one.
+    m_Ready.clear();
+    m_Ready.swap(m_NextFrame);
+    m_Polling.clear();
+    m_Polling.swap(m_Conditions);
+
+    m_TickAccumulator += static_cast<double>(deltaTime) / static_cast<double>(TickSeconds);
+    double ticks = std::floor(m_TickAccumulator);
+    m_TickAccumulator -= ticks;
+    if (ticks > 0.0) {
+        m_Timers.Advance(static_cast<uint64_t>(ticks), [this](uint64_t value) { Resume(Unpack(value)); });
+    }
+
+    ResumeAll(m_Ready);
+
+    for (Condition& condition : m_Polling) {
+        if (!IsLive(condition.id)) {
+            continue;
+        }
+        if (condition.predicate()) {
+            Resume(condition.id);
+        }
+        else {
+            m_Conditions.push_back(std::move(condition));
+        }
+    }
+    m_Polling.clear();
+}
+
+void CoroutineScheduler::FixedStep() {
+    m_Ready.clear();
+    m_Ready.swap(m_NextFixedStep);
+    ResumeAll(m_Ready);
+}
+
+void CoroutineScheduler::ScheduleAfter(uint32_t record, float seconds) {
+    long long ticks = std::llround(static_cast<double>(seconds) / static_cast<double>(TickSeconds));
+    uint64_t delay = ticks > 0 ? static_cast<uint64_t>(ticks) : 1;
+
+    m_Records[record].waiting = true;
+    m_Timers.Schedule(m_Timers.GetNow() + delay, Pack(MakeId(record)));
+}
+
+void CoroutineScheduler::ScheduleNextFrame(uint32_t record) {
+    m_Records[record].waiting = true;
+    m_NextFrame.push_back(MakeId(record));
+}
+
+void CoroutineScheduler::ScheduleNextFixedStep(uint32_t record) {
+    m_Records[record].waiting = true;
+    m_NextFixedStep.push_back(MakeId(record));
+}
+
+void CoroutineScheduler::ScheduleWhen(uint32_t record, std::function<bool()> predicate) {
+    m_Records[record].waiting = true;
+    m_Conditions.push_back(Condition{MakeId(record), std::move(predicate)});
+}
+
+bool CoroutineScheduler::IsRunning(CoroutineId id) const {
+    return IsLive(id);
+}
+
+void CoroutineScheduler::OnScriptDestroyed(entt::registry& registry, entt::entity entity) {
+    (void)registry;
+    StopEntity(entity);
+}
+
+void CoroutineScheduler::Resume(CoroutineId id) {
+    if (!IsLive(id)) {
+        return;
+    }
+
+    // The owner is the script itself (see ScriptComponent::GetCoroutineOwner), so holding it keeps the script
+    // alive until the coroutine suspends again, even if the coroutine destroys its own entity. An expired owner
+    // means the script is gone and the coroutine is dropped instead of touching a dead `this`.
+    std::shared_ptr<void> owner = m_Records[id.index].owner.lock();
+    if (!owner && m_Records[id.index].ownerKey) {
+        Release(id.index);
+        return;
+    }
+
+    Coroutine::Handle handle = m_Records[id.index].handle;
+    m_Records[id.index].waiting = false;
+    m_Records[id.index].running = true;
+
+    handle.resume();
+
+    Record& record = m_Records[id.index];
+    record.running = false;
+    if (record.cancelled || handle.done()) {
+        Release(id.index);
+        return;
+    }
+
+    if (!record.waiting) {
+        ScheduleNextFrame(id.index);
+    }
+}
+
+void CoroutineScheduler::ResumeAll(std::vector<CoroutineId>& ids) {
+    for (size_t i = 0; i < ids.size(); ++i) {
+        Resume(ids[i]);
+    }
+    ids.clear();
+}
+
+void CoroutineScheduler::Cancel(uint32_t index) {
+    Record& record = m_Records[index];
+    if (!record.handle || record.cancelled) {
+        return;
+    }
+
+    record.cancelled = true;
+    if (!record.running) {
+        Release(index);
+    }
+}
+
+void CoroutineScheduler::Release(uint32_t index) {
+    Record& record = m_Records[index];
+    Coroutine::Handle handle = record.handle;
+    entt::entity entity = record.entity;
+
+    record.handle = nullptr;
+    record.owner.reset();
+    record.ownerKey = nullptr;
+    record.entity = entt::null;
+    record.cancelled = false;
+    ++record.generation;
+    m_FreeRecords.push_back(index);
+    --m_ActiveCount;
+
+    if (entity != entt::null) {
+        auto it = m_EntityRecords.find(entity);
+        if (it != m_EntityRecords.end()) {
+            std::vector<uint32_t>& records = it->second;
+            records.erase(std::remove(records.begin(), records.end(), index), records.end());
+            if (records.empty()) {
+                m_EntityRecords.erase(it);
+            }
+        }
+    }
+
+    handle.destroy();
+}
+
+bool CoroutineScheduler::IsLive(CoroutineId id) const {
+    return id.index < m_Records.size() && m_Records[id.index].generation == id.generation &&
+           m_Records[id.index].handle && !m_Records[id.index].cancelled;
+}
+
+uint64_t CoroutineScheduler::Pack(CoroutineId id) {
+    return (static_cast<uint64_t>(id.generation) << 32) | id.index;
+}
+
+CoroutineId CoroutineScheduler::Unpack(uint64_t value) {
+    return CoroutineId{static_cast<uint32_t>(value & UINT32_MAX), static_cast<uint32_t>(value >> 32)};
+}
+
+} // namespace PiiXeL
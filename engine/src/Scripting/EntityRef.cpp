@@ -1,30 +1,57 @@
 #include "Scripting/EntityRef.hpp"
 
-#include "Scene/EntityRegistry.hpp"
+#include "Scene/EntityIndex.hpp"
 
 namespace PiiXeL {
 
-EntityRef::EntityRef(entt::entity entity) {
-    m_UUID = EntityRegistry::Instance().GetUUID(entity);
+EntityRef::EntityRef(const entt::registry& registry, entt::entity entity) {
+    Set(registry, entity);
 }
 
-entt::entity EntityRef::Get() const {
+entt::entity EntityRef::Get(const entt::registry& registry) const {
+    const EntityIndex* index = EntityIndex::Find(registry);
+    return index ? Get(*index) : entt::null;
+}
+
+entt::entity EntityRef::Get(const EntityIndex& index) const {
     if (m_UUID.Get() == 0) {
         return entt::null;
     }
-    return EntityRegistry::Instance().GetEntity(m_UUID);
-}
 
-void EntityRef::Set(entt::entity entity) {
-    m_UUID = EntityRegistry::Instance().GetUUID(entity);
-}
+    // Generations are unique across indices, so one compare covers both "same index" and "unchanged".
+    uint64_t generation = index.GetGeneration();
+    uint32_t sequence = m_CacheSequence.load(std::memory_order_acquire);
+    if ((sequence & 1u) == 0) {
+        uint32_t cachedEntity = m_CachedEntity.load(std::memory_order_relaxed);
+        uint64_t cachedUUID = m_CachedUUID.load(std::memory_order_relaxed);
+        uint64_t cachedGeneration = m_CachedGeneration.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
 
-bool EntityRef::IsValid() const {
-    if (m_UUID.Get() == 0) {
-        return false;
+        if (m_CacheSequence.load(std::memory_order_relaxed) == sequence && cachedGeneration == generation &&
+            cachedUUID == m_UUID.Get())
+        {
+            return entt::entity{cachedEntity};
+        }
     }
-    entt::entity entity = Get();
-    return entity != entt::null && EntityRegistry::Instance().HasEntity(m_UUID);
+
+    entt::entity entity = index.GetEntity(m_UUID);
+
+    // Only one writer at a time; a thread that loses the race keeps its result and leaves the cache alone.
+    if ((sequence & 1u) == 0 &&
+        m_CacheSequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire))
+    {
+        std::atomic_thread_fence(std::memory_order_release);
+        m_CachedEntity.store(entt::to_integral(entity), std::memory_order_relaxed);
+        m_CachedUUID.store(m_UUID.Get(), std::memory_order_relaxed);
+        m_CachedGeneration.store(generation, std::memory_order_relaxed);
+        m_CacheSequence.store(sequence + 2, std::memory_order_release);
+    }
+    return entity;
+}
+
+void EntityRef::Set(const entt::registry& registry, entt::entity entity) {
+    const UUID* uuid = entity != entt::null && registry.valid(entity) ? registry.try_get<UUID>(entity) : nullptr;
+    m_UUID = uuid ? *uuid : UUID{0};
 }
 
 } // namespace PiiXeL
@@ -0,0 +1,38 @@
+#include "Scripting/Event.hpp"
+
+namespace PiiXeL {
+
+EventBus& EventBus::Get(entt::registry& registry) {
+    if (EventBus* bus = registry.ctx().find<EventBus>()) {
+        return *bus;
+    }
+    return registry.ctx().emplace<EventBus>();
+}
+
+void EventBus::Flush() {
+    if (m_Flushing) {
+        m_FlushRequested = true;
+        return;
+    }
+
+    m_Flushing = true;
+    do {
+        m_FlushRequested = false;
+        for (size_t i = 0; i < m_Queues.size(); ++i) {
+            if (m_Queues[i]) {
+                m_Queues[i]->Flush();
+            }
+        }
+    } while (m_FlushRequested);
+    m_Flushing = false;
+}
+
+void EventBus::Clear() {
+    for (std::unique_ptr<EventQueueBase>& queue : m_Queues) {
+        if (queue) {
+            queue->Clear();
+        }
+    }
+}
+
+} // namespace PiiXeL
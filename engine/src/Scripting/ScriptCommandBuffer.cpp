@@ -0,0 +1,14 @@
+#include "Scripting/ScriptCommandBuffer.hpp"
+
+namespace PiiXeL {
+
+thread_local ScriptCommandBuffer* ScriptCommandBuffer::s_Current{nullptr};
+
+void ScriptCommandBuffer::Apply(Scene& scene) {
+    for (Command& command : m_Commands) {
+        command(scene);
+    }
+    m_Commands.clear();
+}
+
+} // namespace PiiXeL
@@ -1,7 +1,10 @@
 #include "Scripting/ScriptComponent.hpp"
 
 #include "Components/Transform.hpp"
+#include "Core/Logger.hpp"
 #include "Scene/Scene.hpp"
+#include "Scripting/CoroutineScheduler.hpp"
+#include "Scripting/ScriptCommandBuffer.hpp"
 
 namespace PiiXeL {
 
@@ -35,4 +38,104 @@ void ScriptComponent::Translate(Vector2 offset) {
     }
 }
 
+entt::entity ScriptComponent::CreateEntity(const std::string& name, std::function<void(entt::entity)> onCreated) {
+    if (ScriptCommandBuffer* commands = ScriptCommandBuffer::GetCurrent()) {
+        commands->Record([name, callback = std::move(onCreated)](Scene& scene) {
+            entt::entity entity = scene.CreateEntity(name);
+            if (callback) {
+                callback(entity);
+            }
+        });
+        return entt::null;
+    }
+
+    if (!m_Scene) {
+        return entt::null;
+    }
+
+    entt::entity entity = m_Scene->CreateEntity(name);
+    if (onCreated) {
+        onCreated(entity);
+    }
+    return entity;
+}
+
+void ScriptComponent::DestroyEntity(entt::entity entity) {
+    if (ScriptCommandBuffer* commands = ScriptCommandBuffer::GetCurrent()) {
+        commands->Record([entity](Scene& scene) {
+            if (scene.GetRegistry().valid(entity)) {
+                scene.DestroyEntity(entity);
+            }
+        });
+        return;
+    }
+
+    if (m_Scene && m_Scene->GetRegistry().valid(entity)) {
+        m_Scene->DestroyEntity(entity);
+    }
+}
+
+CoroutineId ScriptComponent::StartCoroutine(Coroutine coroutine) {
+    if (!m_Scene) {
+        PX_LOG_WARNING(SCRIPT, "Cannot start a coroutine on a script that is not attached to a scene");
+        return {};
+    }
+
+    if (ScriptCommandBuffer* commands = ScriptCommandBuffer::GetCurrent()) {
+        // The deferred start runs after this call returns, so it may only reach the script through a weak
+        // reference; a script nobody shares could be gone by then.
+        std::weak_ptr<ScriptComponent> self = weak_from_this();
+        if (self.expired()) {
+            PX_LOG_WARNING(SCRIPT, "Cannot defer a coroutine start on a script that is not owned by a shared_ptr");
+            return {};
+        }
+
+        std::shared_ptr<Coroutine> pending = std::make_shared<Coroutine>(std::move(coroutine));
+        commands->Record([self, pending](Scene& scene) {
+            std::shared_ptr<ScriptComponent> script = self.lock();
+            if (script && scene.GetRegistry().valid(script->m_Entity)) {
+                script->StartCoroutine(std::move(*pending));
+            }
+        });
+        return {};
+    }
+
+    CoroutineScheduler& scheduler = CoroutineScheduler::Get(m_Scene->GetRegistry());
+    return scheduler.Start(std::move(coroutine), m_Entity, GetCoroutineOwner());
+}
+
+void ScriptComponent::StopCoroutine(CoroutineId id) {
+    if (!m_Scene) {
+        return;
+    }
+
+    if (CoroutineScheduler* scheduler = m_Scene->GetRegistry().ctx().find<CoroutineScheduler>()) {
+        scheduler->Stop(id);
+    }
+}
+
+void ScriptComponent::StopAllCoroutines() {
+    if (!m_Scene) {
+        return;
+    }
+
+    if (CoroutineScheduler* scheduler = m_Scene->GetRegistry().ctx().find<CoroutineScheduler>()) {
+        scheduler->StopOwner(this);
+        if (m_CoroutineOwner) {
+            scheduler->StopOwner(m_CoroutineOwner.get());
+        }
+    }
+}
+
+std::shared_ptr<void> ScriptComponent::GetCoroutineOwner() {
+    if (std::shared_ptr<ScriptComponent> self = weak_from_this().lock()) {
+        return self;
+    }
+
+    if (!m_CoroutineOwner) {
+        m_CoroutineOwner = std::make_shared<bool>(true);
+    }
+    return m_CoroutineOwner;
+}
+
 } // namespace PiiXeL
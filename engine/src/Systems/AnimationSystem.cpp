@@ -27,6 +27,7 @@ void AnimationSystem::ResetAnimators(entt::registry& registry) {
         animator.currentFrameIndex = 0;
         animator.frameTime = 0.0f;
         animator.isTransitioning = false;
+        animator.isFinished = false;
         animator.transitionToState.clear();
         animator.transitionTime = 0.0f;
         animator.transitionDuration = 0.0f;
@@ -56,6 +57,7 @@ void AnimationSystem::UpdateAnimator(entt::registry& registry, entt::entity enti
         animator.stateTime = 0.0f;
         animator.currentFrameIndex = 0;
         animator.frameTime = 0.0f;
+        animator.isFinished = false;
     }
 
     EvaluateTransitions(registry, entity);
@@ -70,6 +72,7 @@ void AnimationSystem::UpdateAnimator(entt::registry& registry, entt::entity enti
             animator.stateTime = 0.0f;
             animator.currentFrameIndex = 0;
             animator.frameTime = 0.0f;
+            animator.isFinished = false;
         }
     }
 
@@ -203,6 +206,7 @@ void AnimationSystem::UpdateAnimation(entt::registry& registry, entt::entity ent
             }
             else {
                 animator.frameTime = currentFrame.duration;
+                animator.isFinished = true;
                 break;
             }
         }
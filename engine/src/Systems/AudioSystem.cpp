@@ -1,5 +1,8 @@
 #include "Systems/AudioSystem.hpp"
 
+#include "Audio/AudioBackend.hpp"
+#include "Audio/AudioDecodeQueue.hpp"
+#include "Audio/MixerAudioBackend.hpp"
 #include "Components/AudioListener.hpp"
 #include "Components/AudioSource.hpp"
 #include "Components/Transform.hpp"
@@ -8,8 +11,10 @@
 #include "Resources/AudioAsset.hpp"
 #include "Scene/Scene.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <raymath.h>
+#include <vector>
 
 namespace PiiXeL {
 
@@ -24,16 +29,35 @@ void AudioSystem::Initialize() {
         return;
     }
 
-    InitAudioDevice();
-
-    if (!IsAudioDeviceReady()) {
-        PX_LOG_ERROR(ENGINE, "Failed to initialize audio device");
+    m_Backend = AudioBackend::Create(m_BackendType);
+    if (!m_Backend->Initialize()) {
+        m_Backend.reset();
         return;
     }
 
-    SetMasterVolume(m_MasterVolume);
+    AudioAsset::SetPcmSampleRate(m_Backend->GetPcmSampleRate());
+    m_Backend->SetMasterVolume(m_MasterVolume);
+    // Flatten first so re-applying the routes one at a time can never close a cycle against the backend defaults.
+    for (size_t bus = 1; bus < m_BusGains.size(); ++bus) {
+        m_Backend->SetBusParent(static_cast<AudioBus>(bus), AudioBus::Master);
+    }
+    for (size_t bus = 1; bus < m_BusGains.size(); ++bus) {
+        m_Backend->SetBusParent(static_cast<AudioBus>(bus), m_BusGraph.GetParent(static_cast<AudioBus>(bus)));
+    }
+    for (size_t bus = 0; bus < m_BusGains.size(); ++bus) {
+        m_Backend->SetBusGain(static_cast<AudioBus>(bus), m_BusGains[bus]);
+        if (m_BusDucking[bus].amount > 0.0f) {
+            m_Backend->SetBusDucking(static_cast<AudioBus>(bus), m_BusDucking[bus].trigger, m_BusDucking[bus].amount);
+        }
+    }
+    m_VoicePool.Initialize(m_Backend.get(), m_MaxVoices);
+    m_UnloadListenerId = AssetRegistry::Instance().AddUnloadListener([this](UUID uuid) {
+        m_VoicePool.ReleaseClip(uuid);
+        m_Backend->Flush();
+    });
     m_IsInitialized = true;
-    PX_LOG_INFO(ENGINE, "Audio system initialized");
+    PX_LOG_INFO(ENGINE, "Audio system initialized (%s backend, %u voices)", AudioBackend::GetTypeName(m_BackendType),
+                m_MaxVoices);
 }
 
 void AudioSystem::Shutdown() {
@@ -41,21 +65,63 @@ void AudioSystem::Shutdown() {
         return;
     }
 
-    CloseAudioDevice();
+    AssetRegistry::Instance().RemoveUnloadListener(m_UnloadListenerId);
+    m_UnloadListenerId = 0;
+    m_VoicePool.Shutdown();
+
+    if (const MixerAudioBackend* mixer = dynamic_cast<const MixerAudioBackend*>(m_Backend.get())) {
+        AudioMixerStats stats = mixer->GetMixerStats();
+        PX_LOG_INFO(ENGINE, "Audio mixer cost: %.3f ms peak, %.2f%% of real time over %llu frames", stats.peakMixMs,
+                    stats.load * 100.0, static_cast<unsigned long long>(stats.renderedFrames));
+    }
+
+    m_Backend->Shutdown();
+    m_Backend.reset();
+    AudioAsset::SetPcmSampleRate(0);
+    AudioDecodeQueue::Instance().Clear();
     m_IsInitialized = false;
     PX_LOG_INFO(ENGINE, "Audio system shutdown");
 }
 
-void AudioSystem::Update(float deltaTime, entt::registry& registry) {
-    (void)deltaTime;
+void AudioSystem::SetBackendType(AudioBackendType type) {
+    if (type == m_BackendType) {
+        return;
+    }
+
+    m_BackendType = type;
+    if (!m_IsInitialized) {
+        return;
+    }
+
+    Shutdown();
+
+    AssetRegistry& assetRegistry = AssetRegistry::Instance();
+    std::vector<UUID> audioAssets{};
+    for (const auto& [uuid, asset] : assetRegistry.GetAllAssets()) {
+        if (asset && asset->GetType() == AssetType::Audio) {
+            audioAssets.push_back(uuid);
+        }
+    }
+    for (UUID uuid : audioAssets) {
+        assetRegistry.UnloadAsset(uuid);
+    }
 
+    Initialize();
+}
+
+void AudioSystem::Update(float deltaTime, entt::registry& registry) {
     if (!m_IsInitialized) {
         return;
     }
 
+    AudioDecodeQueue::Instance().Update();
+    m_VoicePool.Advance(deltaTime);
+
     UpdateListener(registry);
-    UpdateSources(registry);
+    UpdateSources(deltaTime, registry);
     UpdateSpatialAudio(registry);
+
+    m_Backend->Advance(deltaTime);
 }
 
 void AudioSystem::UpdateListener(entt::registry& registry) {
@@ -72,7 +138,7 @@ void AudioSystem::UpdateListener(entt::registry& registry) {
     }
 }
 
-void AudioSystem::UpdateSources(entt::registry& registry) {
+void AudioSystem::UpdateSources(float deltaTime, entt::registry& registry) {
     auto view = registry.view<AudioSource>();
 
     for (auto entity : view) {
@@ -82,51 +148,235 @@ void AudioSystem::UpdateSources(entt::registry& registry) {
             continue;
         }
 
-        std::shared_ptr<Asset> asset = AssetRegistry::Instance().LoadAsset(source.audioClip);
-        if (!asset) {
+        AudioAsset* clip = ResolveClip(source);
+        if (!clip) {
+            UpdatePendingSource(source);
             continue;
         }
 
-        AudioAsset* audioAsset = dynamic_cast<AudioAsset*>(asset.get());
-        if (!audioAsset || !audioAsset->IsLoaded()) {
-            continue;
+        if (source.state == AudioSourceState::Pending) {
+            source.state = AudioSourceState::Playing;
         }
 
-        Sound sound = audioAsset->GetSound();
-        if (sound.frameCount == 0) {
+        if (clip->IsStreaming()) {
+            UpdateStreamingSource(source, *clip);
             continue;
         }
 
         if (source.playOnAwake && !source.hasPlayedOnAwake) {
-            float targetVolume = source.mute ? 0.0f : (source.volume * m_MasterVolume);
-            SetSoundVolume(sound, targetVolume);
-            SetSoundPitch(sound, source.pitch);
-            source.lastAppliedVolume = targetVolume;
-            source.lastAppliedPitch = source.pitch;
-            PlaySound(sound);
-            source.state = AudioSourceState::Playing;
+            StartVoice(registry, entity, source, *clip);
             source.hasPlayedOnAwake = true;
-            PX_LOG_INFO(ENGINE, "Playing sound on awake");
         }
 
-        if (source.state == AudioSourceState::Playing) {
-            if (!IsSoundPlaying(sound)) {
-                if (source.loop) {
-                    float targetVolume = source.mute ? 0.0f : (source.volume * m_MasterVolume);
-                    SetSoundVolume(sound, targetVolume);
-                    SetSoundPitch(sound, source.pitch);
-                    source.lastAppliedVolume = targetVolume;
-                    source.lastAppliedPitch = source.pitch;
-                    PlaySound(sound);
-                }
-                else {
-                    source.state = AudioSourceState::Stopped;
+        uint32_t voice = m_VoicePool.GetBackendVoice(source.voice);
+
+        if (source.state != AudioSourceState::Playing) {
+            if (source.state == AudioSourceState::Stopped) {
+                if (voice != 0) {
+                    m_VoicePool.Release(source.voice);
                 }
+                source.voice = AudioVoiceHandle{};
+                source.isVirtual = false;
+            }
+            else if (voice != 0 && m_Backend->IsVoicePlaying(voice)) {
+                m_Backend->PauseVoice(voice);
+                m_VoicePool.SetPaused(source.voice, true);
+            }
+            continue;
+        }
+
+        if (voice == 0) {
+            if (!source.voice.IsValid() && !source.isVirtual) {
+                StartVoice(registry, entity, source, *clip);
+                continue;
+            }
+
+            source.voice = AudioVoiceHandle{};
+            source.isVirtual = true;
+            AdvanceVirtual(registry, entity, source, *clip, deltaTime);
+            continue;
+        }
+
+        if (m_VoicePool.IsPaused(source.voice)) {
+            m_Backend->ResumeVoice(voice);
+            m_VoicePool.SetPaused(source.voice, false);
+        }
+
+        source.playbackPosition += deltaTime * source.pitch;
+
+        if (!m_Backend->IsVoicePlaying(voice)) {
+            if (source.loop) {
+                m_Backend->PlayVoice(voice);
+                source.playbackPosition = 0.0f;
+            }
+            else {
+                m_VoicePool.Release(source.voice);
+                source.voice = AudioVoiceHandle{};
+                source.state = AudioSourceState::Stopped;
             }
         }
     }
 }
 
+void AudioSystem::UpdatePendingSource(AudioSource& source) {
+    if (source.playOnAwake && !source.hasPlayedOnAwake) {
+        // Skip drops the awake play while the clip is missing but leaves it armed, so the source still starts as
+        // soon as the clip has loaded instead of staying silent for good.
+        if (source.pendingPolicy == AudioPendingPolicy::Skip) {
+            return;
+        }
+        source.hasPlayedOnAwake = true;
+        source.state = AudioSourceState::Playing;
+    }
+
+    if (source.state != AudioSourceState::Playing && source.state != AudioSourceState::Pending) {
+        return;
+    }
+
+    if (source.pendingPolicy == AudioPendingPolicy::Skip || !AudioDecodeQueue::Instance().IsPending(source.audioClip)) {
+        source.state = AudioSourceState::Stopped;
+        return;
+    }
+
+    source.state = AudioSourceState::Pending;
+}
+
+void AudioSystem::UpdateStreamingSource(AudioSource& source, AudioAsset& stream) {
+    if (source.playOnAwake && !source.hasPlayedOnAwake) {
+        StartStream(source, stream);
+        source.hasPlayedOnAwake = true;
+    }
+
+    if (source.state == AudioSourceState::Stopped) {
+        if (source.isStreaming) {
+            stream.StopStream();
+            source.isStreaming = false;
+        }
+        return;
+    }
+
+    if (source.state == AudioSourceState::Paused) {
+        if (source.isStreaming && stream.IsStreamPlaying()) {
+            stream.PauseStream();
+        }
+        return;
+    }
+
+    if (!source.isStreaming) {
+        StartStream(source, stream);
+    }
+    else if (stream.IsStreamPaused()) {
+        stream.ResumeStream();
+    }
+    else if (!stream.IsStreamPlaying()) {
+        source.isStreaming = false;
+        source.state = AudioSourceState::Stopped;
+    }
+}
+
+void AudioSystem::StartStream(AudioSource& source, AudioAsset& stream) {
+    float targetVolume = source.mute ? 0.0f : (source.volume * m_MasterVolume);
+    stream.PlayStream(source.loop);
+    stream.SetStreamVolume(targetVolume);
+    stream.SetStreamPitch(source.pitch);
+    stream.SetStreamPan(0.5f);
+    source.lastAppliedVolume = targetVolume;
+    source.lastAppliedPitch = source.pitch;
+    source.lastAppliedPan = 0.5f;
+    source.isStreaming = true;
+    source.state = AudioSourceState::Playing;
+}
+
+void AudioSystem::AdvanceVirtual(entt::registry& registry, entt::entity entity, AudioSource& source,
+                                 const AudioAsset& clip, float deltaTime) {
+    source.playbackPosition += deltaTime * source.pitch;
+
+    bool wrapped = false;
+    float length = clip.GetLength();
+    if (source.playbackPosition >= length) {
+        if (!source.loop || !(length > 0.0f)) {
+            source.isVirtual = false;
+            source.playbackPosition = 0.0f;
+            source.state = AudioSourceState::Stopped;
+            return;
+        }
+        source.playbackPosition = std::fmod(source.playbackPosition, length);
+        wrapped = true;
+    }
+
+    // Losing a voice only lowers a sound for as long as the pool is full: it takes the next free voice and picks
+    // up where it would have been by now. A loop also competes again, and may steal, each time it wraps.
+    if (wrapped || m_VoicePool.HasFreeVoice()) {
+        StartVoice(registry, entity, source, clip, source.playbackPosition);
+    }
+}
+
+void AudioSystem::StartVoice(entt::registry& registry, entt::entity entity, AudioSource& source,
+                             const AudioAsset& clip, float startPosition) {
+    if (m_VoicePool.GetBackendVoice(source.voice) != 0) {
+        m_VoicePool.Release(source.voice);
+    }
+
+    float audibility = ComputeAudibility(registry, entity, source);
+    source.voice = m_VoicePool.Acquire(clip, source.audioClip, entity, source.priority, audibility);
+    source.state = AudioSourceState::Playing;
+    source.playbackPosition = startPosition;
+
+    uint32_t voice = m_VoicePool.GetBackendVoice(source.voice);
+    if (voice == 0) {
+        source.isVirtual = true;
+        return;
+    }
+
+    float targetVolume = source.mute ? 0.0f : (source.volume * m_MasterVolume);
+    m_Backend->SetVoiceVolume(voice, targetVolume);
+    m_Backend->SetVoicePitch(voice, source.pitch);
+    m_Backend->SetVoicePan(voice, 0.5f);
+    m_Backend->SetVoiceBus(voice, source.bus);
+    source.lastAppliedVolume = targetVolume;
+    source.lastAppliedPitch = source.pitch;
+    source.lastAppliedPan = 0.5f;
+    source.isVirtual = false;
+    m_Backend->PlayVoice(voice);
+    if (startPosition > 0.0f) {
+        m_Backend->SeekVoice(voice, startPosition);
+    }
+}
+
+float AudioSystem::ComputeAttenuation(const AudioSource& source, Vector2 sourcePos, Vector2 listenerPos) {
+    float distance = Vector2Distance(sourcePos, listenerPos);
+
+    float volumeAttenuation = 1.0f;
+    if (distance > source.minDistance) {
+        if (distance >= source.maxDistance) {
+            volumeAttenuation = 0.0f;
+        }
+        else {
+            volumeAttenuation = 1.0f - ((distance - source.minDistance) / (source.maxDistance - source.minDistance));
+        }
+    }
+
+    return volumeAttenuation * source.spatialBlend + (1.0f - source.spatialBlend);
+}
+
+float AudioSystem::ComputeAudibility(entt::registry& registry, entt::entity entity, const AudioSource& source) const {
+    if (source.mute) {
+        return 0.0f;
+    }
+
+    if (!source.spatialize || source.spatialBlend < 0.01f || m_ListenerEntity == entt::null) {
+        return source.volume;
+    }
+
+    Transform* listenerTransform = registry.try_get<Transform>(m_ListenerEntity);
+    Transform* sourceTransform = registry.try_get<Transform>(entity);
+    if (!listenerTransform || !sourceTransform) {
+        return source.volume;
+    }
+
+    return source.volume * ComputeAttenuation(source, sourceTransform->position, listenerTransform->position);
+}
+
 void AudioSystem::UpdateSpatialAudio(entt::registry& registry) {
     if (m_ListenerEntity == entt::null) {
         return;
@@ -152,38 +402,20 @@ void AudioSystem::UpdateSpatialAudio(entt::registry& registry) {
             continue;
         }
 
-        std::shared_ptr<Asset> asset = AssetRegistry::Instance().LoadAsset(source.audioClip);
-        if (!asset) {
-            continue;
-        }
-
-        AudioAsset* audioAsset = dynamic_cast<AudioAsset*>(asset.get());
-        if (!audioAsset || !audioAsset->IsLoaded()) {
+        uint32_t voice = m_VoicePool.GetBackendVoice(source.voice);
+        AudioAsset* stream = source.isStreaming ? source.clipHandle.asset : nullptr;
+        if (voice == 0 && !stream) {
             continue;
         }
 
-        Sound sound = audioAsset->GetSound();
-
         Vector2 sourcePos = transform.position;
-        float distance = Vector2Distance(sourcePos, listenerPos);
-
-        float volumeAttenuation = 1.0f;
-        if (distance > source.minDistance) {
-            if (distance >= source.maxDistance) {
-                volumeAttenuation = 0.0f;
-            }
-            else {
-                volumeAttenuation =
-                    1.0f - ((distance - source.minDistance) / (source.maxDistance - source.minDistance));
-            }
-        }
-
-        volumeAttenuation = volumeAttenuation * source.spatialBlend + (1.0f - source.spatialBlend);
+        float volumeAttenuation = ComputeAttenuation(source, sourcePos, listenerPos);
 
         float finalVolume = source.volume * volumeAttenuation * m_MasterVolume;
         if (source.mute) {
             finalVolume = 0.0f;
         }
+        m_VoicePool.SetAudibility(source.voice, source.mute ? 0.0f : source.volume * volumeAttenuation);
 
         float pan = 0.0f;
         if (source.maxDistance > 0.0f) {
@@ -197,37 +429,66 @@ void AudioSystem::UpdateSpatialAudio(entt::registry& registry) {
         constexpr float panEpsilon = 0.02f;
 
         if (fabs(finalVolume - source.lastAppliedVolume) > volumeEpsilon) {
-            SetSoundVolume(sound, finalVolume);
+            if (voice != 0) {
+                m_Backend->SetVoiceVolume(voice, finalVolume);
+            }
+            else {
+                stream->SetStreamVolume(finalVolume);
+            }
             source.lastAppliedVolume = finalVolume;
         }
 
         if (fabs(targetPan - source.lastAppliedPan) > panEpsilon) {
-            SetSoundPan(sound, targetPan);
+            if (voice != 0) {
+                m_Backend->SetVoicePan(voice, targetPan);
+            }
+            else {
+                stream->SetStreamPan(targetPan);
+            }
             source.lastAppliedPan = targetPan;
         }
     }
 }
 
 void AudioSystem::PlaySource(entt::registry& registry, entt::entity entity) {
+    if (!m_IsInitialized) {
+        return;
+    }
+
     AudioSource* source = registry.try_get<AudioSource>(entity);
     if (!source || source->audioClip.Get() == 0) {
         return;
     }
 
-    std::shared_ptr<Asset> asset = AssetRegistry::Instance().LoadAsset(source->audioClip);
-    if (!asset) {
+    AudioAsset* clip = ResolveClip(*source);
+    if (!clip) {
+        if (source->pendingPolicy == AudioPendingPolicy::Delay &&
+            AudioDecodeQueue::Instance().IsPending(source->audioClip)) {
+            source->state = AudioSourceState::Pending;
+        }
         return;
     }
 
-    AudioAsset* audioAsset = dynamic_cast<AudioAsset*>(asset.get());
-    if (!audioAsset || !audioAsset->IsLoaded()) {
+    if (clip->IsStreaming()) {
+        if (source->isStreaming && clip->IsStreamPaused()) {
+            clip->ResumeStream();
+            source->state = AudioSourceState::Playing;
+        }
+        else {
+            StartStream(*source, *clip);
+        }
+        return;
+    }
+
+    uint32_t voice = m_VoicePool.GetBackendVoice(source->voice);
+    if (source->state == AudioSourceState::Paused && voice != 0) {
+        m_Backend->ResumeVoice(voice);
+        m_VoicePool.SetPaused(source->voice, false);
+        source->state = AudioSourceState::Playing;
         return;
     }
 
-    Sound sound = audioAsset->GetSound();
-    PlaySound(sound);
-    source->state = AudioSourceState::Playing;
-    PX_LOG_INFO(ENGINE, "Playing audio source");
+    StartVoice(registry, entity, *source, *clip);
 }
 
 void AudioSystem::PauseSource(entt::registry& registry, entt::entity entity) {
@@ -236,18 +497,14 @@ void AudioSystem::PauseSource(entt::registry& registry, entt::entity entity) {
         return;
     }
 
-    std::shared_ptr<Asset> asset = AssetRegistry::Instance().LoadAsset(source->audioClip);
-    if (!asset) {
-        return;
+    uint32_t voice = m_VoicePool.GetBackendVoice(source->voice);
+    if (voice != 0) {
+        m_Backend->PauseVoice(voice);
+        m_VoicePool.SetPaused(source->voice, true);
     }
-
-    AudioAsset* audioAsset = dynamic_cast<AudioAsset*>(asset.get());
-    if (!audioAsset || !audioAsset->IsLoaded()) {
-        return;
+    if (source->isStreaming && source->clipHandle.asset) {
+        source->clipHandle.asset->PauseStream();
     }
-
-    Sound sound = audioAsset->GetSound();
-    PauseSound(sound);
     source->state = AudioSourceState::Paused;
 }
 
@@ -257,18 +514,14 @@ void AudioSystem::StopSource(entt::registry& registry, entt::entity entity) {
         return;
     }
 
-    std::shared_ptr<Asset> asset = AssetRegistry::Instance().LoadAsset(source->audioClip);
-    if (!asset) {
-        return;
-    }
-
-    AudioAsset* audioAsset = dynamic_cast<AudioAsset*>(asset.get());
-    if (!audioAsset || !audioAsset->IsLoaded()) {
-        return;
+    m_VoicePool.Release(source->voice);
+    if (source->isStreaming && source->clipHandle.asset) {
+        source->clipHandle.asset->StopStream();
     }
-
-    Sound sound = audioAsset->GetSound();
-    StopSound(sound);
+    source->voice = AudioVoiceHandle{};
+    source->isVirtual = false;
+    source->isStreaming = false;
+    source->playbackPosition = 0.0f;
     source->state = AudioSourceState::Stopped;
 }
 
@@ -279,10 +532,98 @@ void AudioSystem::StopAllSources(entt::registry& registry) {
     }
 }
 
+AudioAsset* AudioSystem::ResolveClip(AudioSource& source) {
+    AudioClipHandle& handle = source.clipHandle;
+    AssetRegistry& registry = AssetRegistry::Instance();
+
+    if (handle.generation != 0 && handle.clip == source.audioClip &&
+        handle.generation == registry.GetSlotGeneration(handle.slot))
+    {
+        return handle.asset;
+    }
+
+    handle = AudioClipHandle{};
+    handle.clip = source.audioClip;
+    if (source.audioClip.Get() == 0) {
+        return nullptr;
+    }
+
+    handle.slot = registry.AcquireSlot(source.audioClip);
+    handle.generation = registry.GetSlotGeneration(handle.slot);
+
+    if (registry.IsAssetLoaded(source.audioClip)) {
+        std::shared_ptr<Asset> asset = registry.GetAsset(source.audioClip);
+        AudioAsset* audioAsset = dynamic_cast<AudioAsset*>(asset.get());
+        if (audioAsset &&
+            (audioAsset->IsStreaming() || audioAsset->GetSound().frameCount > 0 || !audioAsset->GetPcm().empty())) {
+            handle.asset = audioAsset;
+        }
+    }
+    else {
+        AudioDecodeQueue::Instance().Request(source.audioClip);
+    }
+
+    return handle.asset;
+}
+
+void AudioSystem::PreloadClips(const std::vector<UUID>& clips) {
+    AssetRegistry& registry = AssetRegistry::Instance();
+    for (UUID clip : clips) {
+        if (clip.Get() != 0 && !registry.IsAssetLoaded(clip)) {
+            AudioDecodeQueue::Instance().Request(clip);
+        }
+    }
+}
+
 void AudioSystem::SetMasterVolume(float volume) {
     m_MasterVolume = Clamp(volume, 0.0f, 1.0f);
     if (m_IsInitialized) {
-        ::SetMasterVolume(m_MasterVolume);
+        m_Backend->SetMasterVolume(m_MasterVolume);
+    }
+}
+
+void AudioSystem::SetBusGain(AudioBus bus, float gain) {
+    if (bus >= AudioBus::Count) {
+        return;
+    }
+
+    m_BusGains[static_cast<size_t>(bus)] = std::max(gain, 0.0f);
+    if (m_IsInitialized) {
+        m_Backend->SetBusGain(bus, m_BusGains[static_cast<size_t>(bus)]);
+    }
+}
+
+float AudioSystem::GetBusGain(AudioBus bus) const {
+    return bus < AudioBus::Count ? m_BusGains[static_cast<size_t>(bus)] : 0.0f;
+}
+
+void AudioSystem::SetBusDucking(AudioBus target, AudioBus trigger, float amount) {
+    if (target >= AudioBus::Count || trigger >= AudioBus::Count) {
+        return;
+    }
+
+    m_BusDucking[static_cast<size_t>(target)] = BusDucking{trigger, Clamp(amount, 0.0f, 1.0f)};
+    if (m_IsInitialized) {
+        m_Backend->SetBusDucking(target, trigger, m_BusDucking[static_cast<size_t>(target)].amount);
+    }
+}
+
+void AudioSystem::SetBusParent(AudioBus bus, AudioBus parent) {
+    if (!m_BusGraph.SetParent(bus, parent)) {
+        PX_LOG_WARNING(ENGINE, "Audio bus %u cannot route into bus %u", static_cast<uint32_t>(bus),
+                       static_cast<uint32_t>(parent));
+        return;
+    }
+
+    if (m_IsInitialized) {
+        m_Backend->SetBusParent(bus, parent);
+    }
+}
+
+void AudioSystem::SetMaxVoices(uint32_t maxVoices) {
+    m_MaxVoices = maxVoices > 0 ? maxVoices : 1;
+    if (m_IsInitialized) {
+        m_VoicePool.SetMaxVoices(m_MaxVoices);
     }
 }
 
@@ -295,6 +636,11 @@ void AudioSystem::ResetAudioSources(entt::registry& registry) {
         source.lastAppliedVolume = -1.0f;
         source.lastAppliedPitch = -1.0f;
         source.lastAppliedPan = 0.5f;
+        source.playbackPosition = 0.0f;
+        source.clipHandle = AudioClipHandle{};
+        source.voice = AudioVoiceHandle{};
+        source.isVirtual = false;
+        source.isStreaming = false;
     }
 }
 
@@ -6,7 +6,9 @@
 #include "Components/Script.hpp"
 #include "Components/Transform.hpp"
 #include "Core/Logger.hpp"
+#include "Debug/Profiler.hpp"
 #include "Scene/Scene.hpp"
+#include "Scripting/Event.hpp"
 #include "Scripting/ScriptComponent.hpp"
 
 namespace PiiXeL {
@@ -156,6 +158,18 @@ void PhysicsSystem::SyncTransforms(entt::registry& registry) {
     });
 }
 
+void PhysicsSystem::DestroyBody(entt::registry& registry, entt::entity entity) {
+    RigidBody2D* rb = registry.try_get<RigidBody2D>(entity);
+    if (!rb || B2_IS_NULL(rb->box2dBodyId)) {
+        return;
+    }
+
+    if (B2_IS_NON_NULL(m_WorldId)) {
+        b2DestroyBody(rb->box2dBodyId);
+    }
+    rb->box2dBodyId = b2_nullBodyId;
+}
+
 void PhysicsSystem::DestroyAllBodies(entt::registry& registry) {
     if (B2_IS_NULL(m_WorldId)) {
         return;
@@ -189,6 +203,18 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
         return;
     }
 
+    // Bus events are only produced when something listens, so scenes without listeners pay nothing extra.
+    EventQueue<CollisionEvent>* collisionEvents{nullptr};
+    EventQueue<TriggerEvent>* triggerEvents{nullptr};
+    if (EventBus* eventBus = registry.ctx().find<EventBus>()) {
+        if (eventBus->HasListeners<CollisionEvent>()) {
+            collisionEvents = &eventBus->GetQueue<CollisionEvent>();
+        }
+        if (eventBus->HasListeners<TriggerEvent>()) {
+            triggerEvents = &eventBus->GetQueue<TriggerEvent>();
+        }
+    }
+
     b2ContactEvents contactEvents = b2World_GetContactEvents(m_WorldId);
 
     for (int i = 0; i < contactEvents.beginCount; ++i) {
@@ -209,10 +235,15 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
                 auto [it, inserted] = m_ActiveCollisions.insert(pair);
 
                 if (inserted) {
+                    if (collisionEvents) {
+                        collisionEvents->Enqueue({entityA, entityB, ContactPhase::Enter});
+                    }
+
                     if (registry.all_of<Script>(entityA)) {
                         Script& scriptComponent = registry.get<Script>(entityA);
                         for (ScriptInstance& script : scriptComponent.scripts) {
                             if (script.instance) {
+                                PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                                 script.instance->OnCollisionEnter(entityB);
                             }
                         }
@@ -222,6 +253,7 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
                         Script& scriptComponent = registry.get<Script>(entityB);
                         for (ScriptInstance& script : scriptComponent.scripts) {
                             if (script.instance) {
+                                PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                                 script.instance->OnCollisionEnter(entityA);
                             }
                         }
@@ -249,10 +281,15 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
                 size_t erased = m_ActiveCollisions.erase(pair);
 
                 if (erased > 0) {
+                    if (collisionEvents) {
+                        collisionEvents->Enqueue({entityA, entityB, ContactPhase::Exit});
+                    }
+
                     if (registry.all_of<Script>(entityA)) {
                         Script& scriptComponent = registry.get<Script>(entityA);
                         for (ScriptInstance& script : scriptComponent.scripts) {
                             if (script.instance) {
+                                PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                                 script.instance->OnCollisionExit(entityB);
                             }
                         }
@@ -262,6 +299,7 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
                         Script& scriptComponent = registry.get<Script>(entityB);
                         for (ScriptInstance& script : scriptComponent.scripts) {
                             if (script.instance) {
+                                PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                                 script.instance->OnCollisionExit(entityA);
                             }
                         }
@@ -273,10 +311,15 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
 
     for (const auto& [entityA, entityB] : m_ActiveCollisions) {
         if (registry.valid(entityA) && registry.valid(entityB)) {
+            if (collisionEvents) {
+                collisionEvents->Enqueue({entityA, entityB, ContactPhase::Stay});
+            }
+
             if (registry.all_of<Script>(entityA)) {
                 Script& scriptComponent = registry.get<Script>(entityA);
                 for (ScriptInstance& script : scriptComponent.scripts) {
                     if (script.instance) {
+                        PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                         script.instance->OnCollisionStay(entityB);
                     }
                 }
@@ -286,6 +329,7 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
                 Script& scriptComponent = registry.get<Script>(entityB);
                 for (ScriptInstance& script : scriptComponent.scripts) {
                     if (script.instance) {
+                        PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                         script.instance->OnCollisionStay(entityA);
                     }
                 }
@@ -313,10 +357,15 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
                 auto [it, inserted] = m_ActiveTriggers.insert(pair);
 
                 if (inserted) {
+                    if (triggerEvents) {
+                        triggerEvents->Enqueue({sensorEntity, visitorEntity, ContactPhase::Enter});
+                    }
+
                     if (registry.all_of<Script>(sensorEntity)) {
                         Script& scriptComponent = registry.get<Script>(sensorEntity);
                         for (ScriptInstance& script : scriptComponent.scripts) {
                             if (script.instance) {
+                                PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                                 script.instance->OnTriggerEnter(visitorEntity);
                             }
                         }
@@ -326,6 +375,7 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
                         Script& scriptComponent = registry.get<Script>(visitorEntity);
                         for (ScriptInstance& script : scriptComponent.scripts) {
                             if (script.instance) {
+                                PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                                 script.instance->OnTriggerEnter(sensorEntity);
                             }
                         }
@@ -353,10 +403,15 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
                 size_t erased = m_ActiveTriggers.erase(pair);
 
                 if (erased > 0) {
+                    if (triggerEvents) {
+                        triggerEvents->Enqueue({sensorEntity, visitorEntity, ContactPhase::Exit});
+                    }
+
                     if (registry.all_of<Script>(sensorEntity)) {
                         Script& scriptComponent = registry.get<Script>(sensorEntity);
                         for (ScriptInstance& script : scriptComponent.scripts) {
                             if (script.instance) {
+                                PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                                 script.instance->OnTriggerExit(visitorEntity);
                             }
                         }
@@ -366,6 +421,7 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
                         Script& scriptComponent = registry.get<Script>(visitorEntity);
                         for (ScriptInstance& script : scriptComponent.scripts) {
                             if (script.instance) {
+                                PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                                 script.instance->OnTriggerExit(sensorEntity);
                             }
                         }
@@ -377,10 +433,15 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
 
     for (const auto& [entityA, entityB] : m_ActiveTriggers) {
         if (registry.valid(entityA) && registry.valid(entityB)) {
+            if (triggerEvents) {
+                triggerEvents->Enqueue({entityA, entityB, ContactPhase::Stay});
+            }
+
             if (registry.all_of<Script>(entityA)) {
                 Script& scriptComponent = registry.get<Script>(entityA);
                 for (ScriptInstance& script : scriptComponent.scripts) {
                     if (script.instance) {
+                        PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                         script.instance->OnTriggerStay(entityB);
                     }
                 }
@@ -390,6 +451,7 @@ void PhysicsSystem::ProcessCollisionEvents(entt::registry& registry) {
                 Script& scriptComponent = registry.get<Script>(entityB);
                 for (ScriptInstance& script : scriptComponent.scripts) {
                     if (script.instance) {
+                        PROFILE_SCRIPT_SLOT(script.profileSlot, script.typeIndex, script.scriptName, 1);
                         script.instance->OnTriggerStay(entityA);
                     }
                 }
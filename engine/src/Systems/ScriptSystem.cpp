@@ -2,13 +2,56 @@
 
 #include "Components/Script.hpp"
 #include "Scene/Scene.hpp"
+#include "Core/JobSystem.hpp"
+#include "Core/Logger.hpp"
+#include "Debug/Profiler.hpp"
+#include "Scripting/CoroutineScheduler.hpp"
+#include "Scripting/ScriptCommandBuffer.hpp"
 #include "Scripting/ScriptComponent.hpp"
 #include "Scripting/ScriptRegistry.hpp"
 
+#include <algorithm>
 #include <raylib.h>
 
 namespace PiiXeL {
 
+namespace {
+constexpr size_t MinParallelChunkSize{64};
+constexpr size_t ChunksPerThread{4};
+
+size_t GetParallelThreadCount() {
+    return static_cast<size_t>(JobSystem::Instance().GetWorkerCount()) + 1;
+}
+
+#ifndef NDEBUG
+// Debug-only fingerprint of every storage size; any change across the parallel phase means a script
+// mutated the registry directly instead of going through the deferred ScriptComponent API.
+std::vector<size_t> CaptureStorageSizes(entt::registry& registry) {
+    std::vector<size_t> sizes{};
+    sizes.push_back(registry.storage<entt::entity>().free_list());
+    for (auto [id, storage] : registry.storage()) {
+        (void)id;
+        sizes.push_back(storage.size());
+    }
+    return sizes;
+}
+#endif
+} // namespace
+
+bool ScriptBatchCache::IsLive(const entt::registry& registry, const ScriptComponent& script) const {
+    entt::entity entity = script.GetEntity();
+    if (changedEntities.count(entity) == 0) {
+        return true;
+    }
+
+    const Script* scriptComponent = registry.valid(entity) ? registry.try_get<Script>(entity) : nullptr;
+    if (!scriptComponent) {
+        return false;
+    }
+    return std::any_of(scriptComponent->scripts.begin(), scriptComponent->scripts.end(),
+                       [&script](const ScriptInstance& instance) { return instance.instance.get() == &script; });
+}
+
 ScriptSystem::ScriptSystem() = default;
 
 ScriptSystem::~ScriptSystem() = default;
@@ -17,34 +60,125 @@ void ScriptSystem::OnUpdate(Scene* scene, float deltaTime) {
     if (!scene)
         return;
 
+    ScriptBatchCache& cache = PrepareBatches(scene);
+
+    if (!cache.parallelScripts.empty()) {
+        RunParallelUpdate(scene, cache, deltaTime);
+    }
+
+    // A script whose owning Script component dropped it (removed, replaced or entity destroyed) is skipped until
+    // the next activation pass prunes it.
     entt::registry& registry = scene->GetRegistry();
+    for (ScriptBatch& batch : cache.batches) {
+        if (batch.scripts.empty())
+            continue;
+
+        PROFILE_SCRIPT_SLOT(batch.profileSlot, batch.type, batch.name, batch.scripts.size());
+        for (const std::shared_ptr<ScriptComponent>& script : batch.scripts) {
+            if (cache.IsLive(registry, *script)) {
+                script->ExecuteUpdate(deltaTime);
+            }
+        }
+    }
 
-    auto view = registry.view<Script>();
-    for (auto entity : view) {
-        Script& scriptComponent = view.get<Script>(entity);
+    if (CoroutineScheduler* scheduler = scene->GetRegistry().ctx().find<CoroutineScheduler>()) {
+        scheduler->Update(deltaTime);
+    }
+}
 
-        for (ScriptInstance& script : scriptComponent.scripts) {
-            if (!script.instance && !script.scriptName.empty()) {
-                script.instance = CreateScript(script.scriptName);
-                if (script.instance) {
-                    script.instance->Initialize(entity, scene);
-                }
+void ScriptSystem::OnFixedUpdate(Scene* scene, float fixedDeltaTime) {
+    if (!scene)
+        return;
+
+    ScriptBatchCache& cache = PrepareBatches(scene);
+
+    for (ScriptBatch& batch : cache.batches) {
+        if (batch.scripts.empty())
+            continue;
+
+        PROFILE_SCRIPT_SLOT(batch.profileSlot, batch.type, batch.name, batch.scripts.size());
+        for (const std::shared_ptr<ScriptComponent>& script : batch.scripts) {
+            if (cache.IsLive(scene->GetRegistry(), *script)) {
+                script->ExecuteFixedUpdate(fixedDeltaTime);
             }
+        }
+    }
 
-            if (script.instance) {
-                if (!script.instance->GetScene()) {
-                    script.instance->Initialize(entity, scene);
-                }
+    if (CoroutineScheduler* scheduler = scene->GetRegistry().ctx().find<CoroutineScheduler>()) {
+        scheduler->FixedStep();
+    }
+}
 
-                script.instance->ExecuteUpdate(deltaTime);
+std::shared_ptr<ScriptComponent> ScriptSystem::CreateScript(const std::string& name) {
+    return ScriptRegistry::Instance().CreateScript(name);
+}
+
+void ScriptSystem::RunParallelUpdate(Scene* scene, ScriptBatchCache& cache, float deltaTime) {
+    size_t chunkCount = cache.parallelChunks.size() - 1;
+    if (m_CommandBuffers.size() < chunkCount) {
+        m_CommandBuffers.resize(chunkCount);
+    }
+
+    entt::registry& registry = scene->GetRegistry();
+#ifndef NDEBUG
+    std::vector<size_t> storageSizes = CaptureStorageSizes(registry);
+#endif
+
+    // Runs on the engine JobSystem; the registry is only read during this phase, so the liveness check is safe
+    // from every worker.
+    JobSystem::Instance().ParallelFor(chunkCount, [this, &cache, &registry, deltaTime](size_t chunk) {
+        ScriptCommandBuffer::SetCurrent(&m_CommandBuffers[chunk]);
+        for (size_t i = cache.parallelChunks[chunk]; i < cache.parallelChunks[chunk + 1]; ++i) {
+            const std::shared_ptr<ScriptComponent>& script = cache.parallelScripts[i];
+            if (cache.IsLive(registry, *script)) {
+                script->ExecuteParallelUpdate(deltaTime);
             }
         }
+        ScriptCommandBuffer::SetCurrent(nullptr);
+    });
+
+#ifndef NDEBUG
+    if (CaptureStorageSizes(registry) != storageSizes) {
+        PX_LOG_ERROR(SCRIPT, "Registry was modified directly during OnParallelUpdate; use the deferred "
+                             "AddComponent/RemoveComponent/CreateEntity/DestroyEntity calls instead");
+    }
+#endif
+
+    // Replayed in chunk order so the result does not depend on which worker ran which chunk.
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        m_CommandBuffers[chunk].Apply(*scene);
     }
 }
 
-void ScriptSystem::OnFixedUpdate(Scene* scene, float fixedDeltaTime) {
-    if (!scene)
-        return;
+ScriptBatchCache& ScriptSystem::PrepareBatches(Scene* scene) {
+    entt::registry& registry = scene->GetRegistry();
+
+    ScriptBatchCache* cache = registry.ctx().find<ScriptBatchCache>();
+    if (!cache) {
+        cache = &registry.ctx().emplace<ScriptBatchCache>();
+        registry.on_construct<Script>().connect<&ScriptBatchCache::MarkDirty>(*cache);
+        registry.on_update<Script>().connect<&ScriptBatchCache::MarkDirty>(*cache);
+        registry.on_destroy<Script>().connect<&ScriptBatchCache::MarkDirty>(*cache);
+    }
+
+    if (cache->dirty) {
+        ActivateScripts(scene, *cache);
+    }
+
+    return *cache;
+}
+
+void ScriptSystem::ActivateScripts(Scene* scene, ScriptBatchCache& cache) {
+    // Cleared up front so scripts spawned from OnAwake schedule another pass instead of being lost.
+    cache.dirty = false;
+    cache.changedEntities.clear();
+
+    for (ScriptBatch& batch : cache.batches) {
+        batch.scripts.clear();
+    }
+    cache.parallelScripts.clear();
+    cache.parallelChunks.clear();
+    std::vector<entt::entity> parallelEntities{};
 
     entt::registry& registry = scene->GetRegistry();
 
@@ -52,23 +186,54 @@ void ScriptSystem::OnFixedUpdate(Scene* scene, float fixedDeltaTime) {
     for (auto entity : view) {
         Script& scriptComponent = view.get<Script>(entity);
 
-        for (ScriptInstance& script : scriptComponent.scripts) {
+        for (size_t i = 0; i < scriptComponent.scripts.size(); ++i) {
+            ScriptInstance& script = scriptComponent.scripts[i];
             if (!script.instance && !script.scriptName.empty()) {
                 script.instance = CreateScript(script.scriptName);
-                if (script.instance) {
-                    script.instance->Initialize(entity, scene);
-                }
             }
 
-            if (script.instance && script.instance->GetScene()) {
-                script.instance->ExecuteFixedUpdate(fixedDeltaTime);
+            if (!script.instance) {
+                continue;
+            }
+
+            std::shared_ptr<ScriptComponent> instance = script.instance;
+            if (script.typeIndex == std::type_index(typeid(void))) {
+                script.typeIndex = std::type_index(typeid(*instance));
+            }
+            std::type_index type = script.typeIndex;
+
+            if (!instance->GetScene()) {
+                instance->Initialize(entity, scene);
+            }
+
+            auto [it, inserted] = cache.batchIndices.try_emplace(type, cache.batches.size());
+            if (inserted) {
+                ScriptBatch& batch = cache.batches.emplace_back();
+                batch.type = type;
+                batch.name = script.scriptName.empty() ? type.name() : script.scriptName;
+            }
+            if (instance->UsesParallelUpdate()) {
+                cache.parallelScripts.push_back(instance);
+                parallelEntities.push_back(entity);
             }
+            cache.batches[it->second].scripts.push_back(std::move(instance));
         }
     }
-}
 
-std::shared_ptr<ScriptComponent> ScriptSystem::CreateScript(const std::string& name) {
-    return ScriptRegistry::Instance().CreateScript(name);
+    if (cache.parallelScripts.empty()) {
+        return;
+    }
+
+    size_t threadCount = GetParallelThreadCount();
+    size_t chunkSize = std::max(MinParallelChunkSize, cache.parallelScripts.size() / (threadCount * ChunksPerThread));
+
+    cache.parallelChunks.push_back(0);
+    for (size_t i = 1; i < parallelEntities.size(); ++i) {
+        if (i - cache.parallelChunks.back() >= chunkSize && parallelEntities[i] != parallelEntities[i - 1]) {
+            cache.parallelChunks.push_back(i);
+        }
+    }
+    cache.parallelChunks.push_back(parallelEntities.size());
 }
 
 } // namespace PiiXeL
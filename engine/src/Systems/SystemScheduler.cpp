@@ -0,0 +1,151 @@
+#include "Systems/SystemScheduler.hpp"
+
+#include "Core/JobSystem.hpp"
+#include "Debug/Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace PiiXeL {
+
+namespace {
+bool Intersects(const std::vector<entt::id_type>& a, const std::vector<entt::id_type>& b) {
+    for (entt::id_type id : a) {
+        if (std::find(b.begin(), b.end(), id) != b.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
+bool SystemAccess::ConflictsWith(const SystemAccess& other) const {
+    if (m_Exclusive || other.m_Exclusive) {
+        return true;
+    }
+
+    return Intersects(m_Writes, other.m_Writes) || Intersects(m_Writes, other.m_Reads) ||
+           Intersects(m_Reads, other.m_Writes);
+}
+
+void SystemAccess::PrepareStorages(entt::registry& registry) const {
+    for (void (*prepare)(entt::registry&) : m_Storages) {
+        prepare(registry);
+    }
+}
+
+void SystemScheduler::AddSystem(const std::string& name, const SystemAccess& access, SystemFunction function) {
+    size_t index = m_Systems.size();
+    System& system = m_Systems.emplace_back(System{name, access, std::move(function), {}, 0});
+
+    for (size_t i = 0; i < index; ++i) {
+        if (m_Systems[i].access.ConflictsWith(system.access)) {
+            m_Systems[i].dependents.push_back(index);
+            ++system.dependencyCount;
+        }
+    }
+}
+
+void SystemScheduler::Run(entt::registry& registry, float deltaTime) {
+    if (m_Systems.empty()) {
+        return;
+    }
+
+    if (m_Parallel && JobSystem::Instance().GetWorkerCount() > 0) {
+        RunParallel(registry, deltaTime);
+        return;
+    }
+
+    m_DeltaTime = deltaTime;
+#ifdef BUILD_WITH_EDITOR
+    m_Profiling = Profiler::Instance().IsEnabled();
+#endif
+    for (size_t i = 0; i < m_Systems.size(); ++i) {
+        Execute(i, 0);
+    }
+}
+
+void SystemScheduler::RunParallel(entt::registry& registry, float deltaTime) {
+    for (const System& system : m_Systems) {
+        system.access.PrepareStorages(registry);
+    }
+
+    std::unique_lock<std::mutex> lock{m_Mutex};
+    m_DeltaTime = deltaTime;
+#ifdef BUILD_WITH_EDITOR
+    m_Profiling = Profiler::Instance().IsEnabled();
+#endif
+    m_Remaining = m_Systems.size();
+    m_PendingDependencies.resize(m_Systems.size());
+    for (size_t i = 0; i < m_Systems.size(); ++i) {
+        m_PendingDependencies[i] = m_Systems[i].dependencyCount;
+        if (m_PendingDependencies[i] == 0) {
+            Dispatch(i);
+        }
+    }
+
+    // The calling thread runs the main-thread systems and sleeps while only jobs are left.
+    while (m_Remaining > 0) {
+        if (m_MainReady.empty()) {
+            m_WorkReady.wait(lock);
+            continue;
+        }
+
+        size_t index = m_MainReady.front();
+        m_MainReady.pop_front();
+
+        lock.unlock();
+        Execute(index, 0);
+        lock.lock();
+        Complete(index);
+    }
+}
+
+void SystemScheduler::Dispatch(size_t index) {
+    if (m_Systems[index].access.IsMainThread()) {
+        m_MainReady.push_back(index);
+        m_WorkReady.notify_all();
+        return;
+    }
+
+    // Scheduling with m_Mutex held is fine: with workers running, the job never runs inline.
+    JobSystem::Instance().Schedule([this, index]() {
+        Execute(index, JobSystem::GetThreadIndex());
+        std::lock_guard<std::mutex> lock{m_Mutex};
+        Complete(index);
+    });
+}
+
+void SystemScheduler::Execute(size_t index, uint32_t threadIndex) {
+    System& system = m_Systems[index];
+
+#ifdef BUILD_WITH_EDITOR
+    if (m_Profiling) {
+        std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+        system.function(m_DeltaTime);
+        std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+        Profiler::Instance().AddTimelineEvent(system.name, threadIndex, start, end);
+        return;
+    }
+#else
+    (void)threadIndex;
+#endif
+
+    system.function(m_DeltaTime);
+}
+
+void SystemScheduler::Complete(size_t index) {
+    --m_Remaining;
+    for (size_t dependent : m_Systems[index].dependents) {
+        if (--m_PendingDependencies[dependent] == 0) {
+            Dispatch(dependent);
+        }
+    }
+
+    // Wakes the calling thread at the end of the run.
+    if (m_Remaining == 0) {
+        m_WorkReady.notify_all();
+    }
+}
+
+} // namespace PiiXeL
@@ -133,15 +133,16 @@ public:
 
 protected:
     void OnUpdate(float deltaTime) override {
-        if (!target.IsValid() || !GetScene())
+        if (!target.IsSet() || !GetScene())
             return;
 
         entt::registry& registry = GetScene()->GetRegistry();
-        if (!registry.valid(target.Get()))
+        entt::entity targetEntity = target.Get(registry);
+        if (targetEntity == entt::null || !registry.valid(targetEntity))
             return;
 
-        if (registry.all_of<PiiXeL::Transform>(target.Get())) {
-            Vector2 targetPos = registry.get<PiiXeL::Transform>(target.Get()).position;
+        if (registry.all_of<PiiXeL::Transform>(targetEntity)) {
+            Vector2 targetPos = registry.get<PiiXeL::Transform>(targetEntity).position;
             Vector2 desiredPos = {targetPos.x + offset.x, targetPos.y + offset.y};
 
             Vector2 currentPos = GetPosition();
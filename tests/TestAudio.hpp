@@ -0,0 +1,63 @@
+#ifndef PIIXELENGINE_TESTAUDIO_HPP
+#define PIIXELENGINE_TESTAUDIO_HPP
+
+#include "Components/UUID.hpp"
+#include "Resources/AssetRegistry.hpp"
+#include "Resources/AudioAsset.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PiiXeL::Test {
+
+// 16-bit mono PCM WAV file holding a sine tone.
+inline std::vector<uint8_t> MakeToneWav(uint32_t frameCount, uint32_t sampleRate = 44100, float frequency = 440.0f) {
+    const uint32_t dataSize = frameCount * 2;
+    std::vector<uint8_t> wav(44 + dataSize);
+
+    auto write32 = [&wav](size_t offset, uint32_t value) { std::memcpy(wav.data() + offset, &value, 4); };
+    auto write16 = [&wav](size_t offset, uint16_t value) { std::memcpy(wav.data() + offset, &value, 2); };
+
+    std::memcpy(wav.data(), "RIFF", 4);
+    write32(4, 36 + dataSize);
+    std::memcpy(wav.data() + 8, "WAVEfmt ", 8);
+    write32(16, 16);
+    write16(20, 1);
+    write16(22, 1);
+    write32(24, sampleRate);
+    write32(28, sampleRate * 2);
+    write16(32, 2);
+    write16(34, 16);
+    std::memcpy(wav.data() + 36, "data", 4);
+    write32(40, dataSize);
+
+    for (uint32_t i = 0; i < frameCount; ++i) {
+        float phase = 6.2831853f * frequency * static_cast<float>(i) / static_cast<float>(sampleRate);
+        int16_t sample = static_cast<int16_t>(std::sin(phase) * 16000.0f);
+        write16(44 + static_cast<size_t>(i) * 2, static_cast<uint16_t>(sample));
+    }
+    return wav;
+}
+
+// Loads a tone as a WAV audio asset and hands it to the AssetRegistry. Call after the AudioSystem is initialized so
+// the clip is decoded for its backend.
+inline std::shared_ptr<AudioAsset> AddToneClip(UUID uuid, uint32_t frameCount, float frequency = 440.0f) {
+    std::shared_ptr<AudioAsset> asset = std::make_shared<AudioAsset>(uuid, "tone_" + std::to_string(uuid.Get()));
+    asset->SetFormat(AudioFormat::WAV);
+
+    std::vector<uint8_t> wav = MakeToneWav(frameCount, 44100, frequency);
+    if (!asset->Load(wav.data(), wav.size())) {
+        return nullptr;
+    }
+
+    AssetRegistry::Instance().AddLoadedAsset(asset);
+    return asset;
+}
+
+} // namespace PiiXeL::Test
+
+#endif // PIIXELENGINE_TESTAUDIO_HPP
@@ -0,0 +1,63 @@
+#ifndef PIIXELENGINE_TESTHARNESS_HPP
+#define PIIXELENGINE_TESTHARNESS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace PiiXeL::Test {
+
+inline int& FailureCount() {
+    static int failures{0};
+    return failures;
+}
+
+inline void ReportFailure(const char* file, int line, const char* expression) {
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+    ++FailureCount();
+}
+
+// Returned from main(): a non-zero exit code fails the CTest entry.
+inline int Finish(const char* name) {
+    if (FailureCount() == 0) {
+        std::printf("%s: passed\n", name);
+        return 0;
+    }
+
+    std::fprintf(stderr, "%s: %d check(s) failed\n", name, FailureCount());
+    return 1;
+}
+
+struct BenchmarkResult {
+    double medianMs{0.0};
+    double minMs{0.0};
+};
+
+// Runs function() `runs` times after one warm-up run and prints the median and fastest run.
+template <typename Function>
+BenchmarkResult Benchmark(const char* name, int runs, Function&& function) {
+    runs = std::max(runs, 1);
+    function();
+
+    std::vector<double> samples{};
+    samples.reserve(static_cast<size_t>(runs));
+    for (int i = 0; i < runs; ++i) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        function();
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    std::sort(samples.begin(), samples.end());
+    BenchmarkResult result{samples[samples.size() / 2], samples.front()};
+    std::printf("%-48s median %9.3f ms   min %9.3f ms   (%d runs)\n", name, result.medianMs, result.minMs, runs);
+    return result;
+}
+
+} // namespace PiiXeL::Test
+
+#define PX_CHECK(expression)                                                                                           \
+    ((expression) ? static_cast<void>(0) : ::PiiXeL::Test::ReportFailure(__FILE__, __LINE__, #expression))
+
+#endif // PIIXELENGINE_TESTHARNESS_HPP
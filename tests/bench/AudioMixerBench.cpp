@@ -0,0 +1,64 @@
+#include "Audio/OfflineAudioBackend.hpp"
+#include "TestAudio.hpp"
+#include "TestHarness.hpp"
+
+#include <cstdio>
+#include <string>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr uint32_t SampleRate{48000};
+constexpr uint32_t RenderFrames{SampleRate};
+constexpr uint32_t VoiceCounts[]{16, 64, 256};
+} // namespace
+
+// Mixer cost on the offline backend: one second of output per run with every voice playing, spread over the buses.
+int main() {
+    OfflineAudioBackend backend{SampleRate};
+    PX_CHECK(backend.Initialize());
+    AudioAsset::SetPcmSampleRate(SampleRate);
+    backend.SetBusDucking(AudioBus::Music, AudioBus::Sfx, 0.5f);
+
+    std::shared_ptr<AudioAsset> clip = Test::AddToneClip(UUID{1}, 44100 * 2);
+    PX_CHECK(clip != nullptr);
+    if (!clip) {
+        return Test::Finish("AudioMixerBench");
+    }
+
+    constexpr AudioBus Buses[]{AudioBus::Music, AudioBus::Sfx, AudioBus::UI, AudioBus::Ambience};
+    for (uint32_t voiceCount : VoiceCounts) {
+        std::vector<uint32_t> voices{};
+        for (uint32_t i = 0; i < voiceCount; ++i) {
+            uint32_t voice = backend.CreateVoice(*clip);
+            backend.SetVoiceBus(voice, Buses[i % 4]);
+            backend.SetVoicePan(voice, static_cast<float>(i % 11) / 10.0f);
+            backend.SetVoicePitch(voice, 0.75f + 0.05f * static_cast<float>(i % 10));
+            backend.SetVoiceVolume(voice, 1.0f / static_cast<float>(voiceCount));
+            voices.push_back(voice);
+        }
+
+        std::string name = "Offline mix, " + std::to_string(voiceCount) + " voices, 1 s of audio";
+        Test::BenchmarkResult result = Test::Benchmark(name.c_str(), 10, [&]() {
+            for (uint32_t voice : voices) {
+                backend.PlayVoice(voice);
+            }
+            backend.Render(RenderFrames);
+        });
+        PX_CHECK(result.medianMs < 1000.0);
+        std::printf("  real-time load %.4f\n", result.medianMs / 1000.0);
+
+        for (uint32_t voice : voices) {
+            backend.DestroyVoice(voice);
+        }
+    }
+
+    AudioMixerStats stats = backend.GetMixerStats();
+    PX_CHECK(stats.renderedFrames > 0);
+    std::printf("Mixer stats: peak block %.3f ms, overall load %.4f\n", stats.peakMixMs, stats.load);
+
+    backend.Shutdown();
+    AssetRegistry::Instance().UnloadAll();
+    AudioAsset::SetPcmSampleRate(0);
+    return Test::Finish("AudioMixerBench");
+}
@@ -0,0 +1,67 @@
+#include "Components/AudioListener.hpp"
+#include "Components/AudioSource.hpp"
+#include "Components/Transform.hpp"
+#include "Systems/AudioSystem.hpp"
+#include "TestAudio.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr int SourceCount{2000};
+constexpr int ClipCount{16};
+constexpr int FramesPerRun{60};
+constexpr float FrameTime{1.0f / 60.0f};
+} // namespace
+
+int main() {
+    AudioSystem audio{};
+    audio.SetBackendType(AudioBackendType::Offline);
+    audio.Initialize();
+
+    for (int i = 0; i < ClipCount; ++i) {
+        PX_CHECK(Test::AddToneClip(UUID{1000u + static_cast<uint64_t>(i)}, 44100, 220.0f + 20.0f * i) != nullptr);
+    }
+
+    entt::registry registry{};
+    entt::entity listener = registry.create();
+    registry.emplace<Transform>(listener);
+    registry.emplace<AudioListener>(listener);
+
+    for (int i = 0; i < SourceCount; ++i) {
+        entt::entity entity = registry.create();
+        registry.emplace<Transform>(entity, Vector2{static_cast<float>(i % 50) * 20.0f, static_cast<float>(i / 50)});
+        AudioSource& source = registry.emplace<AudioSource>(entity);
+        source.audioClip = UUID{1000u + static_cast<uint64_t>(i % ClipCount)};
+        source.loop = true;
+        source.playOnAwake = true;
+    }
+
+    Test::Benchmark("AudioSystem::Update, 2000 sources, cached", 10, [&]() {
+        for (int frame = 0; frame < FramesPerRun; ++frame) {
+            audio.Update(FrameTime, registry);
+        }
+    });
+
+    // Dropping the handles forces the registry lookup and dynamic_cast the cache avoids.
+    Test::Benchmark("AudioSystem::Update, 2000 sources, re-resolved", 10, [&]() {
+        for (int frame = 0; frame < FramesPerRun; ++frame) {
+            for (auto [entity, source] : registry.view<AudioSource>().each()) {
+                source.clipHandle = AudioClipHandle{};
+            }
+            audio.Update(FrameTime, registry);
+        }
+    });
+
+    size_t resolved = 0;
+    for (auto [entity, source] : registry.view<AudioSource>().each()) {
+        resolved += source.clipHandle.asset != nullptr ? 1 : 0;
+    }
+    PX_CHECK(resolved == SourceCount);
+
+    audio.Shutdown();
+    AssetRegistry::Instance().UnloadAll();
+    return Test::Finish("AudioSourceBench");
+}
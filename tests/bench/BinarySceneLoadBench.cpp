@@ -0,0 +1,87 @@
+#include "Components/BoxCollider2D.hpp"
+#include "Components/RigidBody2D.hpp"
+#include "Components/Sprite.hpp"
+#include "Components/Tag.hpp"
+#include "Components/Transform.hpp"
+#include "Reflection/ReflectionInit.hpp"
+#include "Scene/BinarySceneSerializer.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneSerializer.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr size_t EntityCount{10000};
+
+void PopulateScene(Scene& scene) {
+    for (size_t i = 0; i < EntityCount; ++i) {
+        entt::entity entity = scene.CreateEntity("Crate");
+        entt::registry& registry = scene.GetRegistry();
+        registry.get<Transform>(entity).position = Vector2{static_cast<float>(i), 64.0f};
+        Sprite& sprite = registry.emplace<Sprite>(entity);
+        sprite.layer = 2;
+        RigidBody2D& body = registry.emplace<RigidBody2D>(entity);
+        body.mass = 4.0f;
+        registry.emplace<BoxCollider2D>(entity);
+    }
+}
+
+// Both loaders have to restore every entity with its own position and the record columns intact.
+size_t CountLoaded(Scene& scene) {
+    entt::registry& registry = scene.GetRegistry();
+    size_t count = 0;
+    for (auto [entity, transform, body] : registry.view<Transform, RigidBody2D>().each()) {
+        bool tagged = registry.all_of<Tag, Sprite, BoxCollider2D>(entity);
+        count += tagged && transform.position.y == 64.0f && body.mass == 4.0f ? 1 : 0;
+    }
+    return count;
+}
+} // namespace
+
+// Loading the same 10k entity scene from the JSON text and from the binary column format.
+int main() {
+    Reflection::InitializeReflection();
+
+    std::string jsonText{};
+    std::vector<uint8_t> binary{};
+    {
+        Scene scene{"BinarySceneLoadBench"};
+        PopulateScene(scene);
+        jsonText = SceneSerializer{&scene}.SerializeToString();
+        binary = BinarySceneSerializer{&scene}.SerializeToMemory();
+    }
+    PX_CHECK(BinarySceneSerializer::IsBinaryScene(binary.data(), binary.size()));
+
+    size_t jsonCount = 0;
+    Test::Benchmark("SceneSerializer JSON load, 10k", 10, [&]() {
+        Scene scene{"BinarySceneLoadBench"};
+        SceneSerializer serializer{&scene};
+        jsonCount = serializer.DeserializeFromString(jsonText) ? CountLoaded(scene) : 0;
+    });
+
+    size_t binaryCount = 0;
+    Test::Benchmark("BinarySceneSerializer load, 10k", 10, [&]() {
+        Scene scene{"BinarySceneLoadBench"};
+        BinarySceneSerializer serializer{&scene};
+        binaryCount = serializer.DeserializeFromMemory(binary.data(), binary.size()) ? CountLoaded(scene) : 0;
+    });
+
+    PX_CHECK(jsonCount == EntityCount);
+    PX_CHECK(binaryCount == EntityCount);
+
+    // A column count the file cannot hold is rejected before anything is allocated for it.
+    std::vector<uint8_t> corrupt = binary;
+    uint32_t columnCount = 0xFFFFFFFFu;
+    std::memcpy(corrupt.data() + 3 * sizeof(uint32_t), &columnCount, sizeof(columnCount));
+    Scene rejected{"BinarySceneLoadBench"};
+    PX_CHECK(!BinarySceneSerializer{&rejected}.DeserializeFromMemory(corrupt.data(), corrupt.size()));
+
+    return Test::Finish("BinarySceneLoadBench");
+}
@@ -0,0 +1,83 @@
+#include "Components/BoxCollider2D.hpp"
+#include "Components/ComponentModuleRegistry.hpp"
+#include "Components/RigidBody2D.hpp"
+#include "Components/Sprite.hpp"
+#include "Components/Transform.hpp"
+#include "Reflection/ReflectionInit.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+#include <nlohmann/json.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr size_t EntityCount{10000};
+
+nlohmann::json MakeEntitiesJson() {
+    entt::registry registry{};
+    entt::entity entity = registry.create();
+    registry.emplace<Transform>(entity, Vector2{32.0f, 64.0f});
+    registry.emplace<Sprite>(entity).layer = 2;
+    registry.emplace<RigidBody2D>(entity).mass = 4.0f;
+    registry.emplace<BoxCollider2D>(entity);
+
+    nlohmann::json entityJson = ComponentModuleRegistry::Instance().SerializeEntity(registry, entity);
+    entityJson["uuid"] = 1;
+    return nlohmann::json(EntityCount, entityJson);
+}
+
+size_t CountLoaded(const entt::registry& registry) {
+    size_t count = 0;
+    for (auto [entity, transform, body] : registry.view<Transform, RigidBody2D>().each()) {
+        count += transform.position.y == 64.0f && body.mass == 4.0f ? 1 : 0;
+    }
+    return count;
+}
+} // namespace
+
+// Component dispatch while loading 10k entity objects: the hashed module table against the string-keyed map
+// lookup it replaced, each feeding the same module codecs. Both have to load every entity.
+int main() {
+    Reflection::InitializeReflection();
+    ComponentModuleRegistry& modules = ComponentModuleRegistry::Instance();
+    const nlohmann::json entitiesJson = MakeEntitiesJson();
+
+    std::unordered_map<std::string, IComponentModule*> modulesByName{};
+    for (const std::shared_ptr<IComponentModule>& module : modules.GetAllModules()) {
+        modulesByName.emplace(module->GetName(), module.get());
+    }
+
+    size_t tableCount = 0;
+    Test::Benchmark("ComponentModuleRegistry hashed dispatch, 10k", 10, [&]() {
+        entt::registry registry{};
+        for (const nlohmann::json& entityJson : entitiesJson) {
+            modules.DeserializeEntity(registry, registry.create(), entityJson);
+        }
+        tableCount = CountLoaded(registry);
+    });
+
+    size_t mapCount = 0;
+    Test::Benchmark("std::unordered_map<std::string> dispatch, 10k", 10, [&]() {
+        entt::registry registry{};
+        for (const nlohmann::json& entityJson : entitiesJson) {
+            entt::entity entity = registry.create();
+            for (auto it = entityJson.begin(); it != entityJson.end(); ++it) {
+                auto moduleIt = modulesByName.find(it.key());
+                if (moduleIt != modulesByName.end()) {
+                    moduleIt->second->Deserialize(registry, entity, it.value());
+                }
+            }
+        }
+        mapCount = CountLoaded(registry);
+    });
+
+    PX_CHECK(tableCount == EntityCount);
+    PX_CHECK(mapCount == EntityCount);
+
+    return Test::Finish("ComponentLoadBench");
+}
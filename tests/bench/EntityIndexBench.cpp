@@ -0,0 +1,140 @@
+#include "Components/UUID.hpp"
+#include "Scene/EntityIndex.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr size_t EntityCount{50000};
+constexpr size_t LookupCount{2000000};
+constexpr size_t ChurnCount{5000};
+
+// The two hash maps the flat index replaced: UUID -> entity and entity id -> UUID.
+struct MapIndex {
+    std::unordered_map<UUID, entt::entity> uuidToEntity;
+    std::unordered_map<uint32_t, UUID> entityToUUID;
+
+    void Register(UUID uuid, entt::entity entity) {
+        uuidToEntity[uuid] = entity;
+        entityToUUID[entt::to_integral(entity)] = uuid;
+    }
+
+    void Unregister(UUID uuid) {
+        auto it = uuidToEntity.find(uuid);
+        if (it != uuidToEntity.end()) {
+            entityToUUID.erase(entt::to_integral(it->second));
+            uuidToEntity.erase(it);
+        }
+    }
+
+    [[nodiscard]] entt::entity GetEntity(UUID uuid) const {
+        auto it = uuidToEntity.find(uuid);
+        return it != uuidToEntity.end() ? it->second : entt::null;
+    }
+
+    [[nodiscard]] UUID GetUUID(entt::entity entity) const {
+        auto it = entityToUUID.find(entt::to_integral(entity));
+        return it != entityToUUID.end() ? it->second : UUID{0};
+    }
+};
+} // namespace
+
+// 50k entities: bulk registration, 2M random lookups both ways and register/unregister churn, flat table against
+// the previous pair of std::unordered_maps. Both sides must agree on every lookup.
+int main() {
+    entt::registry registry{};
+    std::mt19937_64 random{1234};
+
+    std::vector<std::pair<UUID, entt::entity>> entries{};
+    entries.reserve(EntityCount);
+    for (size_t i = 0; i < EntityCount; ++i) {
+        entt::entity entity = registry.create();
+        UUID uuid{random() | 1};
+        registry.emplace<UUID>(entity, uuid);
+        entries.emplace_back(uuid, entity);
+    }
+
+    std::vector<size_t> order(LookupCount);
+    for (size_t& slot : order) {
+        slot = static_cast<size_t>(random() % EntityCount);
+    }
+
+    EntityIndex index{registry};
+    MapIndex maps{};
+
+    Test::Benchmark("EntityIndex register, 50k", 10, [&]() {
+        index.Clear();
+        index.RegisterEntities(entries);
+    });
+    Test::Benchmark("unordered_map register, 50k", 10, [&]() {
+        maps = MapIndex{};
+        maps.uuidToEntity.reserve(EntityCount);
+        maps.entityToUUID.reserve(EntityCount);
+        for (const auto& [uuid, entity] : entries) {
+            maps.Register(uuid, entity);
+        }
+    });
+    PX_CHECK(index.GetCount() == EntityCount);
+
+    uint64_t indexSum = 0;
+    uint64_t mapSum = 0;
+    Test::Benchmark("EntityIndex UUID -> entity, 2M", 10, [&]() {
+        for (size_t slot : order) {
+            indexSum += entt::to_integral(index.GetEntity(entries[slot].first));
+        }
+    });
+    Test::Benchmark("unordered_map UUID -> entity, 2M", 10, [&]() {
+        for (size_t slot : order) {
+            mapSum += entt::to_integral(maps.GetEntity(entries[slot].first));
+        }
+    });
+    PX_CHECK(indexSum == mapSum);
+
+    indexSum = 0;
+    mapSum = 0;
+    Test::Benchmark("EntityIndex entity -> UUID, 2M", 10, [&]() {
+        for (size_t slot : order) {
+            indexSum += index.GetUUID(entries[slot].second).Get();
+        }
+    });
+    Test::Benchmark("unordered_map entity -> UUID, 2M", 10, [&]() {
+        for (size_t slot : order) {
+            mapSum += maps.GetUUID(entries[slot].second).Get();
+        }
+    });
+    PX_CHECK(indexSum == mapSum);
+
+    // Every run removes and re-adds the same 5k entries, so both sides end where they started.
+    Test::Benchmark("EntityIndex churn, 5k", 10, [&]() {
+        for (size_t i = 0; i < ChurnCount; ++i) {
+            index.Unregister(entries[order[i]].first);
+        }
+        for (size_t i = 0; i < ChurnCount; ++i) {
+            index.Register(entries[order[i]].first, entries[order[i]].second);
+        }
+    });
+    Test::Benchmark("unordered_map churn, 5k", 10, [&]() {
+        for (size_t i = 0; i < ChurnCount; ++i) {
+            maps.Unregister(entries[order[i]].first);
+        }
+        for (size_t i = 0; i < ChurnCount; ++i) {
+            maps.Register(entries[order[i]].first, entries[order[i]].second);
+        }
+    });
+    PX_CHECK(index.GetCount() == EntityCount);
+    size_t mismatches = 0;
+    for (const auto& [uuid, entity] : entries) {
+        mismatches += index.GetEntity(uuid) != entity ? 1 : 0;
+    }
+    PX_CHECK(mismatches == 0);
+
+    return Test::Finish("EntityIndexBench");
+}
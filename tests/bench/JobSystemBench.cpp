@@ -0,0 +1,103 @@
+#include "Core/JobSystem.hpp"
+#include "TestHarness.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr uint32_t WorkerCount{4};
+constexpr size_t JobCount{10000};
+constexpr size_t ChainLength{1000};
+
+// A few microseconds of work, so a deque holds jobs long enough for other workers to steal them.
+void Spin(std::chrono::microseconds duration) {
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+    }
+}
+
+// A job that throws must still finish its counter, so waiting on it and on the jobs that depend on it returns.
+void CheckThrowingJob(JobSystem& jobs) {
+    JobHandle thrower = jobs.Schedule([]() { throw std::runtime_error{"job failure"}; });
+    std::atomic<bool> dependentRan{false};
+    JobHandle dependents[] = {thrower};
+    JobHandle dependent = jobs.Schedule([&dependentRan]() { dependentRan = true; }, dependents);
+
+    jobs.Wait(dependent);
+    PX_CHECK(thrower->IsDone());
+    PX_CHECK(dependentRan);
+}
+} // namespace
+
+// Spawn, steal and wait costs of the job system with four workers: independent jobs scheduled from the main thread,
+// jobs spawned by a worker that the others steal from its deque, and a dependency chain that runs strictly in order.
+int main() {
+    JobSystem& jobs = JobSystem::Instance();
+    jobs.Initialize(WorkerCount);
+
+    std::atomic<size_t> spawned{0};
+    Test::Benchmark("Schedule + Wait, 10k empty jobs from main", 20, [&]() {
+        spawned = 0;
+        std::vector<JobHandle> handles{};
+        handles.reserve(JobCount);
+        for (size_t i = 0; i < JobCount; ++i) {
+            handles.push_back(jobs.Schedule([&spawned]() { spawned.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        for (const JobHandle& handle : handles) {
+            jobs.Wait(handle);
+        }
+    });
+    PX_CHECK(spawned == JobCount);
+
+    std::atomic<size_t> batched{0};
+    Test::Benchmark("ParallelForAsync + Wait, 10k indices", 20, [&]() {
+        batched = 0;
+        JobHandle handle = jobs.ParallelForAsync(JobCount, 64, [&batched](size_t begin, size_t end) {
+            batched.fetch_add(end - begin, std::memory_order_relaxed);
+        });
+        jobs.Wait(handle);
+    });
+    PX_CHECK(batched == JobCount);
+
+    // Every batch lands on the spawning worker's deque; the other workers only get work by stealing it.
+    std::vector<uint32_t> ranOn(JobCount, 0);
+    Test::Benchmark("Worker-spawned ParallelFor, 10k x 2us (steal)", 10, [&]() {
+        JobHandle root = jobs.Schedule([&]() {
+            jobs.ParallelFor(JobCount, [&ranOn](size_t index) {
+                Spin(std::chrono::microseconds{2});
+                ranOn[index] = JobSystem::GetThreadIndex();
+            });
+        });
+        jobs.Wait(root);
+    });
+    std::set<uint32_t> threads(ranOn.begin(), ranOn.end());
+    PX_CHECK(threads.size() > 1);
+
+    std::vector<size_t> order{};
+    order.reserve(ChainLength);
+    Test::Benchmark("Dependency chain, 1k jobs", 20, [&]() {
+        order.clear();
+        JobHandle previous{};
+        for (size_t i = 0; i < ChainLength; ++i) {
+            JobHandle dependencies[] = {previous};
+            previous = jobs.Schedule([&order, i]() { order.push_back(i); }, dependencies);
+        }
+        jobs.Wait(previous);
+    });
+    bool ordered = order.size() == ChainLength;
+    for (size_t i = 0; ordered && i < ChainLength; ++i) {
+        ordered = order[i] == i;
+    }
+    PX_CHECK(ordered);
+
+    CheckThrowingJob(jobs);
+
+    jobs.Shutdown();
+    return Test::Finish("JobSystemBench");
+}
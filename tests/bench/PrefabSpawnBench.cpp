@@ -0,0 +1,104 @@
+#include "Components/BoxCollider2D.hpp"
+#include "Components/ComponentModuleRegistry.hpp"
+#include "Components/RigidBody2D.hpp"
+#include "Components/Sprite.hpp"
+#include "Components/Tag.hpp"
+#include "Components/Transform.hpp"
+#include "Reflection/ReflectionInit.hpp"
+#include "Resources/PrefabAsset.hpp"
+#include "Scene/EntityFactory.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneSerializer.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+#include <nlohmann/json.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr size_t InstanceCount{10000};
+
+// A typical gameplay entity: tagged sprite with a dynamic body and a box collider.
+nlohmann::json MakeEntityJson() {
+    Scene scene{"PrefabSource"};
+    entt::registry& registry = scene.GetRegistry();
+    entt::entity entity = registry.create();
+    registry.emplace<Tag>(entity, "Crate");
+    registry.emplace<Transform>(entity, Vector2{32.0f, 64.0f});
+    Sprite& sprite = registry.emplace<Sprite>(entity);
+    sprite.layer = 2;
+    RigidBody2D& body = registry.emplace<RigidBody2D>(entity);
+    body.mass = 4.0f;
+    registry.emplace<BoxCollider2D>(entity);
+
+    nlohmann::json entityJson = nlohmann::json::object();
+    for (const std::shared_ptr<IComponentModule>& module : ComponentModuleRegistry::Instance().GetAllModules()) {
+        if (module->HasComponent(registry, entity)) {
+            entityJson[module->GetName()] = module->Serialize(registry, entity);
+        }
+    }
+    return entityJson;
+}
+
+// Module components are only duplicated in editor builds, so the check sticks to the built-in Transform.
+size_t CountCrates(Scene& scene) {
+    size_t count = 0;
+    for (auto [entity, transform] : scene.GetRegistry().view<Transform>().each()) {
+        count += transform.position.x == 32.0f && transform.position.y == 64.0f ? 1 : 0;
+    }
+    return count;
+}
+} // namespace
+
+// 10k copies of one entity: prefab instantiation against deserializing the same entities from scene JSON and
+// against duplicating a live entity one at a time. Every path has to produce all 10k entities.
+int main() {
+    Reflection::InitializeReflection();
+
+    std::string prefabText = MakeEntityJson().dump();
+    PrefabAsset prefab{UUID{1}, "Crate"};
+    PX_CHECK(prefab.Load(prefabText.data(), prefabText.size()));
+    PX_CHECK(prefab.GetComponentCount() == 5);
+
+    std::string sceneText{};
+    {
+        Scene scene{"PrefabSpawnBench"};
+        prefab.Instantiate(scene, InstanceCount);
+        SceneSerializer serializer{&scene};
+        sceneText = serializer.SerializeToString();
+    }
+
+    size_t prefabCount = 0;
+    Test::Benchmark("PrefabAsset::Instantiate, 10k", 10, [&]() {
+        Scene scene{"PrefabSpawnBench"};
+        prefabCount = prefab.Instantiate(scene, InstanceCount).size();
+        prefabCount = CountCrates(scene) == prefabCount ? prefabCount : 0;
+    });
+
+    size_t jsonCount = 0;
+    Test::Benchmark("SceneSerializer JSON deserialize, 10k", 10, [&]() {
+        Scene scene{"PrefabSpawnBench"};
+        SceneSerializer serializer{&scene};
+        jsonCount = serializer.DeserializeFromString(sceneText) ? CountCrates(scene) : 0;
+    });
+
+    size_t duplicateCount = 0;
+    Test::Benchmark("EntityFactory::DuplicateEntity, 10k", 10, [&]() {
+        Scene scene{"PrefabSpawnBench"};
+        entt::entity source = prefab.Instantiate(scene, 1).front();
+        for (size_t i = 1; i < InstanceCount; ++i) {
+            EntityFactory::DuplicateEntity(&scene, source);
+        }
+        duplicateCount = CountCrates(scene);
+    });
+
+    PX_CHECK(prefabCount == InstanceCount);
+    PX_CHECK(jsonCount == InstanceCount);
+    PX_CHECK(duplicateCount == InstanceCount);
+
+    return Test::Finish("PrefabSpawnBench");
+}
@@ -0,0 +1,102 @@
+#include "Components/BoxCollider2D.hpp"
+#include "Components/RigidBody2D.hpp"
+#include "Components/Sprite.hpp"
+#include "Components/Transform.hpp"
+#include "Components/UUID.hpp"
+#include "Reflection/ReflectionInit.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneSerializer.hpp"
+#include "Scene/SceneSnapshot.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstdio>
+#include <string>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr size_t EntityCount{10000};
+
+void PopulateScene(Scene& scene) {
+    entt::registry& registry = scene.GetRegistry();
+    for (size_t i = 0; i < EntityCount; ++i) {
+        entt::entity entity = scene.CreateEntity("Crate");
+        registry.get<Transform>(entity).position = Vector2{static_cast<float>(i), 64.0f};
+        registry.emplace<Sprite>(entity).layer = 2;
+        registry.emplace<RigidBody2D>(entity).mass = 4.0f;
+        registry.emplace<BoxCollider2D>(entity);
+    }
+}
+
+// What a play session does to the scene: moves everything, drops a component and spawns extra entities.
+void Play(Scene& scene) {
+    entt::registry& registry = scene.GetRegistry();
+    for (auto [entity, transform] : registry.view<Transform>().each()) {
+        transform.position.y += 100.0f;
+    }
+    registry.clear<BoxCollider2D>();
+    for (size_t i = 0; i < 100; ++i) {
+        static_cast<void>(scene.CreateEntity("Spawned"));
+    }
+}
+
+// The edit-mode scene has to come back exactly: same entity count, untouched positions, every collider and a
+// UUID index that resolves each entity.
+bool MatchesEditState(Scene& scene) {
+    entt::registry& registry = scene.GetRegistry();
+    if (scene.GetEntityOrder().size() != EntityCount || scene.GetEntityIndex().GetCount() != EntityCount) {
+        return false;
+    }
+
+    for (entt::entity entity : scene.GetEntityOrder()) {
+        const Transform* transform = registry.try_get<Transform>(entity);
+        const UUID* uuid = registry.try_get<UUID>(entity);
+        if (!transform || !uuid || transform->position.y != 64.0f || !registry.all_of<BoxCollider2D>(entity) ||
+            scene.GetEntityIndex().GetEntity(*uuid) != entity)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+// Entering and leaving play mode on a 10k entity scene: the storage-copy snapshot against the JSON round trip it
+// replaced. Both have to restore the edit-mode scene after every play session.
+int main() {
+    Reflection::InitializeReflection();
+
+    Scene snapshotScene{"SceneSnapshotBench"};
+    PopulateScene(snapshotScene);
+    SceneSnapshot snapshot{};
+
+    bool snapshotRestored = true;
+    Test::BenchmarkResult snapshotResult = Test::Benchmark("SceneSnapshot capture + restore, 10k", 10, [&]() {
+        snapshot.Capture(snapshotScene);
+        Play(snapshotScene);
+        snapshotRestored = snapshot.Restore(snapshotScene) && MatchesEditState(snapshotScene) && snapshotRestored;
+    });
+    PX_CHECK(snapshotRestored);
+    PX_CHECK(snapshot.IsEmpty());
+    PX_CHECK(!snapshot.Restore(snapshotScene));
+
+    Scene jsonScene{"SceneSnapshotBench"};
+    PopulateScene(jsonScene);
+
+    bool jsonRestored = true;
+    Test::BenchmarkResult jsonResult = Test::Benchmark("SceneSerializer JSON round trip, 10k", 10, [&]() {
+        SceneSerializer serializer{&jsonScene};
+        std::string saved = serializer.SerializeToString();
+        Play(jsonScene);
+        jsonRestored = serializer.DeserializeFromString(saved) && MatchesEditState(jsonScene) && jsonRestored;
+    });
+    PX_CHECK(jsonRestored);
+
+    // The snapshot exists to make entering and leaving play mode cheaper than the JSON round trip it replaced.
+    PX_CHECK(snapshotResult.medianMs < jsonResult.medianMs);
+    std::printf("  snapshot / JSON: %.2f\n", snapshotResult.medianMs / jsonResult.medianMs);
+
+    return Test::Finish("SceneSnapshotBench");
+}
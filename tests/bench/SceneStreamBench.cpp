@@ -0,0 +1,175 @@
+#include "Components/BoxCollider2D.hpp"
+#include "Components/ComponentModuleRegistry.hpp"
+#include "Components/RigidBody2D.hpp"
+#include "Components/Sprite.hpp"
+#include "Components/Transform.hpp"
+#include "Components/UUID.hpp"
+#include "Reflection/ReflectionInit.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneSerializer.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace {
+// Live and peak bytes handed out by the global operator new, so the benchmark can report peak heap use per path
+// on every platform. Each block carries its size in a header.
+std::atomic<size_t> s_HeapCurrent{0};
+std::atomic<size_t> s_HeapPeak{0};
+constexpr size_t HeapHeaderSize{alignof(std::max_align_t)};
+} // namespace
+
+void* operator new(size_t size) {
+    void* block = std::malloc(size + HeapHeaderSize);
+    if (!block) {
+        throw std::bad_alloc{};
+    }
+
+    *static_cast<size_t*>(block) = size;
+    size_t current = s_HeapCurrent.fetch_add(size, std::memory_order_relaxed) + size;
+    size_t peak = s_HeapPeak.load(std::memory_order_relaxed);
+    while (current > peak && !s_HeapPeak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+    }
+    return static_cast<unsigned char*>(block) + HeapHeaderSize;
+}
+
+void operator delete(void* pointer) noexcept {
+    if (!pointer) {
+        return;
+    }
+
+    void* block = static_cast<unsigned char*>(pointer) - HeapHeaderSize;
+    s_HeapCurrent.fetch_sub(*static_cast<size_t*>(block), std::memory_order_relaxed);
+    std::free(block);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+
+using namespace PiiXeL;
+
+namespace {
+constexpr size_t EntityCount{100000};
+
+// Heap growth above the bytes already live when function() starts, reported next to the timing.
+template <typename Function>
+size_t MeasurePeakHeap(const char* name, Function&& function) {
+    size_t baseline = s_HeapCurrent.load(std::memory_order_relaxed);
+    s_HeapPeak.store(baseline, std::memory_order_relaxed);
+    function();
+    size_t peak = s_HeapPeak.load(std::memory_order_relaxed) - baseline;
+    std::printf("%-48s peak heap %9.1f MB\n", name, static_cast<double>(peak) / (1024.0 * 1024.0));
+    return peak;
+}
+
+void PopulateScene(Scene& scene) {
+    entt::registry& registry = scene.GetRegistry();
+    for (size_t i = 0; i < EntityCount; ++i) {
+        entt::entity entity = scene.CreateEntity("Crate");
+        registry.get<Transform>(entity).position = Vector2{static_cast<float>(i), 64.0f};
+        registry.emplace<Sprite>(entity).layer = 2;
+        registry.emplace<RigidBody2D>(entity).mass = 4.0f;
+        registry.emplace<BoxCollider2D>(entity);
+    }
+}
+
+size_t CountLoaded(Scene& scene) {
+    size_t count = 0;
+    for (auto [entity, transform, body] : scene.GetRegistry().view<Transform, RigidBody2D>().each()) {
+        count += transform.position.y == 64.0f && body.mass == 4.0f ? 1 : 0;
+    }
+    return count;
+}
+
+// The whole-document path the streaming serializer replaced: one JSON DOM for the scene, dumped at the end.
+std::string SaveThroughDom(Scene& scene) {
+    entt::registry& registry = scene.GetRegistry();
+    nlohmann::json sceneJson{};
+    sceneJson["scene"] = scene.GetName();
+    nlohmann::json& entities = sceneJson["entities"] = nlohmann::json::array();
+    for (entt::entity entity : scene.GetEntityOrder()) {
+        nlohmann::json entityJson = ComponentModuleRegistry::Instance().SerializeEntity(registry, entity);
+        entityJson["uuid"] = registry.get<UUID>(entity).Get();
+        entities.push_back(std::move(entityJson));
+    }
+    return sceneJson.dump();
+}
+
+bool LoadThroughDom(Scene& scene, const std::string& text) {
+    nlohmann::json sceneJson = nlohmann::json::parse(text, nullptr, false);
+    if (sceneJson.is_discarded() || !sceneJson.contains("entities")) {
+        return false;
+    }
+
+    SceneSerializer serializer{&scene};
+    for (const nlohmann::json& entityJson : sceneJson["entities"]) {
+        scene.GetEntityOrder().Add(serializer.DeserializeEntity(entityJson));
+    }
+    return true;
+}
+} // namespace
+
+// Saving and loading a generated 100k entity scene through the streaming writer and SAX reader, against building
+// the whole JSON document first. Reports time and peak heap growth; the text being loaded is allocated up front
+// and not counted.
+int main() {
+    Reflection::InitializeReflection();
+
+    Scene source{"SceneStreamBench"};
+    PopulateScene(source);
+
+    std::string streamedText{};
+    Test::Benchmark("SceneSerializer streaming save, 100k", 3, [&]() {
+        streamedText = SceneSerializer{&source}.SerializeToString();
+    });
+    std::string domText{};
+    Test::Benchmark("JSON DOM save, 100k", 3, [&]() { domText = SaveThroughDom(source); });
+
+    size_t streamedSavePeak = MeasurePeakHeap("SceneSerializer streaming save, 100k", [&]() {
+        std::string text = SceneSerializer{&source}.SerializeToString();
+    });
+    size_t domSavePeak = MeasurePeakHeap("JSON DOM save, 100k", [&]() { std::string text = SaveThroughDom(source); });
+
+    size_t streamedCount = 0;
+    Test::Benchmark("SceneSerializer streaming load, 100k", 3, [&]() {
+        Scene scene{"SceneStreamBench"};
+        streamedCount = SceneSerializer{&scene}.DeserializeFromString(streamedText) ? CountLoaded(scene) : 0;
+    });
+    size_t domCount = 0;
+    Test::Benchmark("JSON DOM load, 100k", 3, [&]() {
+        Scene scene{"SceneStreamBench"};
+        domCount = LoadThroughDom(scene, streamedText) ? CountLoaded(scene) : 0;
+    });
+
+    size_t streamedLoadPeak = MeasurePeakHeap("SceneSerializer streaming load, 100k", [&]() {
+        Scene scene{"SceneStreamBench"};
+        static_cast<void>(SceneSerializer{&scene}.DeserializeFromString(streamedText));
+    });
+    size_t domLoadPeak = MeasurePeakHeap("JSON DOM load, 100k", [&]() {
+        Scene scene{"SceneStreamBench"};
+        static_cast<void>(LoadThroughDom(scene, streamedText));
+    });
+
+    PX_CHECK(streamedCount == EntityCount);
+    PX_CHECK(domCount == EntityCount);
+    PX_CHECK(streamedSavePeak < domSavePeak);
+    PX_CHECK(streamedLoadPeak < domLoadPeak);
+
+    // A truncated file is rejected and the scene that was open keeps its entities.
+    Scene open{"SceneStreamBench"};
+    PX_CHECK(SceneSerializer{&open}.DeserializeFromString(streamedText));
+    std::string truncated = streamedText.substr(0, streamedText.size() / 2);
+    PX_CHECK(!SceneSerializer{&open}.DeserializeFromString(truncated));
+    PX_CHECK(CountLoaded(open) == EntityCount);
+    PX_CHECK(open.GetEntityIndex().GetCount() == EntityCount);
+
+    return Test::Finish("SceneStreamBench");
+}
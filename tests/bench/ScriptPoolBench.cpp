@@ -0,0 +1,79 @@
+#include "Components/Script.hpp"
+#include "Scene/Scene.hpp"
+#include "Scripting/ScriptComponent.hpp"
+#include "Scripting/ScriptRegistry.hpp"
+#include "Systems/ScriptSystem.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr int BurstSize{1000};
+constexpr int BurstsPerRun{100};
+
+class ProjectileScript : public ScriptComponent {
+public:
+    float lifetime{1.0f};
+    float speed{400.0f};
+
+protected:
+    void OnUpdate(float deltaTime) override { lifetime -= deltaTime; }
+};
+} // namespace
+
+REGISTER_SCRIPT(ProjectileScript)
+
+// Projectile-style churn: bursts of scripted instances are spawned and despawned, pooled against make_shared.
+int main() {
+    std::vector<std::shared_ptr<ScriptComponent>> live{};
+    live.reserve(BurstSize);
+
+    Test::BenchmarkResult pooled = Test::Benchmark("Script churn, pooled factory", 10, [&]() {
+        for (int burst = 0; burst < BurstsPerRun; ++burst) {
+            for (int i = 0; i < BurstSize; ++i) {
+                live.push_back(ScriptRegistry::Instance().CreateScript("ProjectileScript"));
+            }
+            live.clear();
+        }
+    });
+
+    Test::BenchmarkResult heap = Test::Benchmark("Script churn, make_shared", 10, [&]() {
+        for (int burst = 0; burst < BurstsPerRun; ++burst) {
+            for (int i = 0; i < BurstSize; ++i) {
+                live.push_back(std::make_shared<ProjectileScript>());
+            }
+            live.clear();
+        }
+    });
+    std::printf("  pooled / make_shared: %.2f\n", pooled.medianMs / heap.medianMs);
+
+    // A released block is the next one handed out.
+    const ScriptComponent* released = ScriptRegistry::Instance().CreateScript("ProjectileScript").get();
+    PX_CHECK(ScriptRegistry::Instance().CreateScript("ProjectileScript").get() == released);
+
+    // The same churn through entities, Script components and the ScriptSystem's activation pass.
+    Scene scene{"ScriptPoolBench"};
+    entt::registry& registry = scene.GetRegistry();
+    ScriptSystem scripts{};
+    std::vector<entt::entity> entities(BurstSize);
+    Test::Benchmark("Scripted entity spawn/despawn + update", 10, [&]() {
+        for (int burst = 0; burst < BurstsPerRun / 10; ++burst) {
+            registry.create(entities.begin(), entities.end());
+            for (entt::entity entity : entities) {
+                Script& script = registry.emplace<Script>(entity);
+                script.AddScript("ProjectileScript");
+            }
+            scripts.OnUpdate(&scene, 1.0f / 60.0f);
+            registry.destroy(entities.begin(), entities.end());
+        }
+    });
+    PX_CHECK(registry.view<Script>().size() == 0);
+
+    return Test::Finish("ScriptPoolBench");
+}
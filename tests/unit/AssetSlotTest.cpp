@@ -0,0 +1,35 @@
+#include "Resources/AssetRegistry.hpp"
+#include "Resources/AudioAsset.hpp"
+#include "TestAudio.hpp"
+#include "TestHarness.hpp"
+
+using namespace PiiXeL;
+
+int main() {
+    // Decode to PCM so no audio device is needed.
+    AudioAsset::SetPcmSampleRate(48000);
+    AssetRegistry& registry = AssetRegistry::Instance();
+
+    UUID first{1};
+    UUID second{2};
+    uint32_t firstSlot = registry.AcquireSlot(first);
+    uint32_t secondSlot = registry.AcquireSlot(second);
+    PX_CHECK(firstSlot != secondSlot);
+    PX_CHECK(registry.AcquireSlot(first) == firstSlot);
+
+    uint32_t firstGeneration = registry.GetSlotGeneration(firstSlot);
+    PX_CHECK(Test::AddToneClip(second, 4410) != nullptr);
+    PX_CHECK(registry.GetSlotGeneration(firstSlot) == firstGeneration);
+
+    uint32_t secondGeneration = registry.GetSlotGeneration(secondSlot);
+    registry.UnloadAsset(second);
+    PX_CHECK(registry.GetSlotGeneration(secondSlot) != secondGeneration);
+    PX_CHECK(registry.GetSlotGeneration(firstSlot) == firstGeneration);
+
+    PX_CHECK(Test::AddToneClip(first, 4410) != nullptr);
+    PX_CHECK(registry.GetSlotGeneration(firstSlot) != firstGeneration);
+
+    registry.UnloadAll();
+    AudioAsset::SetPcmSampleRate(0);
+    return Test::Finish("AssetSlotTest");
+}
@@ -0,0 +1,50 @@
+#include "Audio/AudioDecodeQueue.hpp"
+#include "Components/AudioListener.hpp"
+#include "Components/AudioSource.hpp"
+#include "Components/Transform.hpp"
+#include "Systems/AudioSystem.hpp"
+#include "TestAudio.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+using namespace PiiXeL;
+
+int main() {
+    AudioSystem audio{};
+    audio.SetBackendType(AudioBackendType::Offline);
+    audio.Initialize();
+
+    entt::registry registry{};
+    entt::entity listener = registry.create();
+    registry.emplace<Transform>(listener);
+    registry.emplace<AudioListener>(listener);
+
+    UUID clip{42};
+    entt::entity entity = registry.create();
+    registry.emplace<Transform>(entity);
+    AudioSource& source = registry.emplace<AudioSource>(entity);
+    source.audioClip = clip;
+    source.playOnAwake = true;
+    source.loop = true;
+    source.pendingPolicy = AudioPendingPolicy::Skip;
+
+    // The clip is unknown to the registry, so its decode fails and is scheduled for a retry instead of given up.
+    for (int frame = 0; frame < 5; ++frame) {
+        audio.Update(1.0f / 60.0f, registry);
+    }
+    PX_CHECK(source.state == AudioSourceState::Stopped);
+    PX_CHECK(!source.hasPlayedOnAwake);
+    PX_CHECK(AudioDecodeQueue::Instance().IsPending(clip));
+    PX_CHECK(!AudioDecodeQueue::Instance().HasFailed(clip));
+
+    // A skipped awake play stays armed and starts once the clip shows up.
+    PX_CHECK(Test::AddToneClip(clip, 44100) != nullptr);
+    audio.Update(1.0f / 60.0f, registry);
+    PX_CHECK(source.state == AudioSourceState::Playing);
+    PX_CHECK(source.hasPlayedOnAwake);
+
+    audio.Shutdown();
+    AssetRegistry::Instance().UnloadAll();
+    return Test::Finish("AudioPendingTest");
+}
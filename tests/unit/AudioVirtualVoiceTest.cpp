@@ -0,0 +1,98 @@
+#include "Audio/OfflineAudioBackend.hpp"
+#include "Components/AudioListener.hpp"
+#include "Components/AudioSource.hpp"
+#include "Components/Transform.hpp"
+#include "Systems/AudioSystem.hpp"
+#include "TestAudio.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cmath>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr float FrameTime{1.0f / 60.0f};
+
+entt::entity AddSource(entt::registry& registry, UUID clip, float priority, bool loop) {
+    entt::entity entity = registry.create();
+    registry.emplace<Transform>(entity);
+    AudioSource& source = registry.emplace<AudioSource>(entity);
+    source.audioClip = clip;
+    source.priority = priority;
+    source.loop = loop;
+    source.playOnAwake = true;
+    return entity;
+}
+
+void RunFrames(AudioSystem& audio, entt::registry& registry, int frames) {
+    for (int frame = 0; frame < frames; ++frame) {
+        audio.Update(FrameTime, registry);
+    }
+}
+} // namespace
+
+// A one-shot that loses its voice to a more important sound must take the next voice that frees up and carry on
+// from where it would have been, instead of running out its length in silence.
+int main() {
+    AudioSystem audio{};
+    audio.SetBackendType(AudioBackendType::Offline);
+    audio.SetMaxVoices(2);
+    audio.Initialize();
+
+    OfflineAudioBackend* backend = dynamic_cast<OfflineAudioBackend*>(audio.GetBackend());
+    PX_CHECK(backend != nullptr);
+    PX_CHECK(Test::AddToneClip(UUID{1}, 88200) != nullptr);
+    PX_CHECK(Test::AddToneClip(UUID{2}, 44100, 330.0f) != nullptr);
+    PX_CHECK(Test::AddToneClip(UUID{3}, 88200, 550.0f) != nullptr);
+    if (!backend) {
+        return Test::Finish("AudioVirtualVoiceTest");
+    }
+
+    entt::registry registry{};
+    entt::entity listener = registry.create();
+    registry.emplace<Transform>(listener);
+    registry.emplace<AudioListener>(listener);
+
+    // Lower numbers are more important; the one-shot is the cheapest voice once the pool is full.
+    entt::entity oneShot = AddSource(registry, UUID{1}, 200.0f, false);
+    entt::entity music = AddSource(registry, UUID{2}, 150.0f, true);
+    RunFrames(audio, registry, 3);
+    PX_CHECK(audio.GetActiveVoiceCount() == 2);
+    PX_CHECK(!registry.get<AudioSource>(oneShot).isVirtual);
+
+    entt::entity alarm = AddSource(registry, UUID{3}, 0.0f, false);
+    RunFrames(audio, registry, 2);
+    PX_CHECK(registry.get<AudioSource>(oneShot).isVirtual);
+    PX_CHECK(!registry.get<AudioSource>(alarm).isVirtual);
+
+    // Still no free voice, so the stolen one-shot stays virtual but keeps advancing.
+    RunFrames(audio, registry, 10);
+    PX_CHECK(registry.get<AudioSource>(oneShot).isVirtual);
+    PX_CHECK(registry.get<AudioSource>(oneShot).state == AudioSourceState::Playing);
+
+    audio.StopSource(registry, music);
+    RunFrames(audio, registry, 1);
+    const AudioSource& resumed = registry.get<AudioSource>(oneShot);
+    PX_CHECK(!resumed.isVirtual);
+    PX_CHECK(resumed.voice.IsValid());
+    PX_CHECK(resumed.state == AudioSourceState::Playing);
+    PX_CHECK(resumed.playbackPosition > 10.0f * FrameTime);
+
+    // With the alarm stopped as well, whatever is heard comes from the resumed one-shot.
+    audio.StopSource(registry, alarm);
+    backend->SetCaptureEnabled(true);
+    backend->ClearCapture();
+    RunFrames(audio, registry, 5);
+
+    float peak = 0.0f;
+    for (float sample : backend->GetCapture()) {
+        peak = std::max(peak, std::fabs(sample));
+    }
+    PX_CHECK(peak > 0.0f);
+
+    audio.Shutdown();
+    AssetRegistry::Instance().UnloadAll();
+    return Test::Finish("AudioVirtualVoiceTest");
+}
@@ -0,0 +1,71 @@
+#include "Components/RigidBody2D.hpp"
+#include "Components/Sprite.hpp"
+#include "Components/Transform.hpp"
+#include "Components/UUID.hpp"
+#include "Reflection/ReflectionInit.hpp"
+#include "Scene/BinarySceneSerializer.hpp"
+#include "Scene/Scene.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr size_t EntityCount{3};
+
+void PopulateScene(Scene& scene) {
+    for (size_t i = 0; i < EntityCount; ++i) {
+        entt::entity entity = scene.CreateEntity("Crate");
+        entt::registry& registry = scene.GetRegistry();
+        registry.get<Transform>(entity).position = Vector2{static_cast<float>(i), 8.0f};
+        registry.emplace<Sprite>(entity).layer = 1;
+        registry.emplace<RigidBody2D>(entity).mass = 2.0f;
+    }
+}
+
+// Records are written from value-initialized staging copies, so saving the same scene twice gives the same bytes.
+void TestByteStableOutput() {
+    Scene scene{"Stable"};
+    PopulateScene(scene);
+    BinarySceneSerializer serializer{&scene};
+    std::vector<uint8_t> first = serializer.SerializeToMemory();
+    std::vector<uint8_t> second = serializer.SerializeToMemory();
+    PX_CHECK(!first.empty());
+    PX_CHECK(first == second);
+}
+
+// Appending a chunk that is already loaded gives the copies fresh UUIDs, so both copies stay in the index.
+void TestAppendRemapsUUIDs() {
+    Scene source{"Chunk"};
+    PopulateScene(source);
+    std::vector<uint8_t> data = BinarySceneSerializer{&source}.SerializeToMemory();
+
+    Scene scene{"World"};
+    BinarySceneSerializer serializer{&scene};
+    std::vector<entt::entity> entities{};
+    PX_CHECK(serializer.AppendFromMemory(data.data(), data.size(), entities));
+    PX_CHECK(serializer.AppendFromMemory(data.data(), data.size(), entities));
+    PX_CHECK(entities.size() == EntityCount * 2);
+    PX_CHECK(scene.GetEntityIndex().GetCount() == EntityCount * 2);
+
+    std::set<uint64_t> uuids{};
+    for (entt::entity entity : entities) {
+        UUID uuid = scene.GetRegistry().get<UUID>(entity);
+        uuids.insert(uuid.Get());
+        PX_CHECK(scene.GetEntityIndex().GetEntity(uuid) == entity);
+    }
+    PX_CHECK(uuids.size() == EntityCount * 2);
+}
+} // namespace
+
+int main() {
+    Reflection::InitializeReflection();
+    TestByteStableOutput();
+    TestAppendRemapsUUIDs();
+    return Test::Finish("BinarySceneAppendTest");
+}
@@ -0,0 +1,53 @@
+#include "Components/ComponentModuleRegistry.hpp"
+#include "Components/Transform.hpp"
+#include "Reflection/ReflectionInit.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+#include <nlohmann/json.hpp>
+
+#include <memory>
+
+using namespace PiiXeL;
+
+namespace {
+// Has the same 32-bit FNV-1a name hash as "Transform".
+constexpr const char* CollidingName{"ColliderBVTUgca"};
+
+struct Marker {
+    int value{0};
+};
+
+// A module whose name hash collides with Transform's must not shadow it, and must itself be found past it.
+void TestHashCollision() {
+    ComponentModuleRegistry& registry = ComponentModuleRegistry::Instance();
+    PX_CHECK(ComponentModuleRegistry::HashName(CollidingName) == ComponentModuleRegistry::HashName("Transform"));
+
+    auto marker = std::make_shared<ComponentModule<Marker>>(CollidingName);
+    marker->SetSerializer([](const Marker& component) -> nlohmann::json { return {{"value", component.value}}; });
+    marker->SetDeserializer([](Marker& component, const nlohmann::json& data) {
+        component.value = data.value("value", 0);
+    });
+    registry.RegisterModule(marker);
+
+    PX_CHECK(registry.GetModuleByName("Transform") == registry.GetModule<Transform>());
+    PX_CHECK(registry.GetModuleByName(CollidingName) == marker.get());
+    PX_CHECK(registry.GetModuleByName("ColliderBVTUgcb") == nullptr);
+
+    entt::registry entities{};
+    entt::entity entity = entities.create();
+    nlohmann::json entityJson{{"Transform", {{"position", {3.0f, 4.0f}}}}, {CollidingName, {{"value", 7}}}};
+    registry.DeserializeEntity(entities, entity, entityJson);
+
+    const Transform* transform = entities.try_get<Transform>(entity);
+    const Marker* component = entities.try_get<Marker>(entity);
+    PX_CHECK(transform != nullptr && transform->position.x == 3.0f && transform->position.y == 4.0f);
+    PX_CHECK(component != nullptr && component->value == 7);
+}
+} // namespace
+
+int main() {
+    Reflection::InitializeReflection();
+    TestHashCollision();
+    return Test::Finish("ComponentLookupTest");
+}
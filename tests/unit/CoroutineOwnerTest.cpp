@@ -0,0 +1,96 @@
+#include "Components/Script.hpp"
+#include "Scene/Scene.hpp"
+#include "Scripting/Coroutine.hpp"
+#include "Scripting/CoroutineScheduler.hpp"
+#include "Scripting/ScriptCommandBuffer.hpp"
+#include "Scripting/ScriptComponent.hpp"
+#include "Systems/ScriptSystem.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+#include <memory>
+
+using namespace PiiXeL;
+
+namespace {
+int s_StepsAfterDestroy{0};
+
+// Destroys its own entity from inside a coroutine and keeps using `this` until the next suspension point.
+class SelfDestructScript : public ScriptComponent {
+public:
+    int value{0};
+
+protected:
+    void OnStart() override { StartCoroutine(Run()); }
+
+private:
+    Coroutine Run() {
+        co_await NextFrame{};
+        GetScene()->GetRegistry().destroy(GetEntity());
+        value += 1;
+        s_StepsAfterDestroy = value;
+        co_await NextFrame{};
+        s_StepsAfterDestroy = -1;
+    }
+};
+
+class IdleScript : public ScriptComponent {};
+
+Coroutine Wait() {
+    co_await NextFrame{};
+}
+
+// A coroutine started from OnParallelUpdate is recorded and started on the main thread. The record may only hold
+// the script weakly: a script without a shared owner is refused, and one destroyed before the replay is skipped.
+void TestDeferredStart() {
+    Scene scene{"DeferredStart"};
+    entt::entity entity = scene.GetRegistry().create();
+    ScriptCommandBuffer commands{};
+    ScriptCommandBuffer::SetCurrent(&commands);
+
+    IdleScript unowned{};
+    unowned.Initialize(entity, &scene);
+    PX_CHECK(!unowned.StartCoroutine(Wait()).IsValid());
+    PX_CHECK(commands.IsEmpty());
+
+    std::shared_ptr<IdleScript> owned = std::make_shared<IdleScript>();
+    owned->Initialize(entity, &scene);
+    owned->StartCoroutine(Wait());
+    std::shared_ptr<IdleScript> released = std::make_shared<IdleScript>();
+    released->Initialize(entity, &scene);
+    released->StartCoroutine(Wait());
+    PX_CHECK(commands.GetCommandCount() == 2);
+    released.reset();
+
+    ScriptCommandBuffer::SetCurrent(nullptr);
+    commands.Apply(scene);
+    PX_CHECK(CoroutineScheduler::Get(scene.GetRegistry()).GetActiveCount() == 1);
+}
+} // namespace
+
+int main() {
+    TestDeferredStart();
+
+    Scene scene{"CoroutineOwnerTest"};
+    entt::registry& registry = scene.GetRegistry();
+
+    std::shared_ptr<SelfDestructScript> script = std::make_shared<SelfDestructScript>();
+    std::weak_ptr<SelfDestructScript> watch = script;
+    entt::entity entity = registry.create();
+    Script component{};
+    component.AddScript(std::move(script), "SelfDestructScript");
+    registry.emplace<Script>(entity, std::move(component));
+
+    ScriptSystem scripts{};
+    for (int frame = 0; frame < 4; ++frame) {
+        scripts.OnUpdate(&scene, 0.016f);
+    }
+
+    // The script stayed alive for the rest of the resume, then the coroutine was cancelled with its entity.
+    PX_CHECK(s_StepsAfterDestroy == 1);
+    PX_CHECK(CoroutineScheduler::Get(registry).GetActiveCount() == 0);
+    PX_CHECK(watch.expired());
+
+    return Test::Finish("CoroutineOwnerTest");
+}
@@ -0,0 +1,50 @@
+#include "Scene/EntityIndex.hpp"
+#include "Scripting/EntityRef.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace PiiXeL;
+
+int main() {
+    entt::registry registry{};
+    EntityIndex index{registry};
+    for (uint64_t i = 1; i <= 100; ++i) {
+        index.Register(UUID{i}, registry.create());
+    }
+    entt::entity expected = index.GetEntity(UUID{42});
+    PX_CHECK(EntityIndex::Find(registry) == &index);
+
+    // Shared by every thread, as an EntityRef field read from several parallel script chunks would be.
+    EntityRef shared{UUID{42}};
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads{};
+    for (int thread = 0; thread < 8; ++thread) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 100000; ++i) {
+                if (shared.Get(index) != expected) {
+                    mismatches.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    PX_CHECK(mismatches.load() == 0);
+
+    // A copy re-resolves on its own through the registry, and changing the UUID invalidates the cached entity.
+    EntityRef copy = shared;
+    PX_CHECK(copy.Get(registry) == expected);
+    copy.SetUUID(UUID{7});
+    PX_CHECK(copy.Get(index) == index.GetEntity(UUID{7}));
+
+    index.Unregister(UUID{42});
+    PX_CHECK(shared.Get(index) == entt::null);
+
+    return Test::Finish("EntityRefTest");
+}
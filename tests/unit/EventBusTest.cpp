@@ -0,0 +1,91 @@
+#include "Scripting/Event.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+#include <vector>
+
+using namespace PiiXeL;
+
+namespace {
+struct Ping {
+    int value;
+};
+
+struct Pong {
+    int value;
+};
+
+// A listener flushing its own queue mid-delivery must not swap the batch being iterated; the events it enqueued
+// arrive in a second pass after the first batch is complete.
+void TestNestedQueueFlush() {
+    EventQueue<Ping> queue{};
+    std::vector<int> received{};
+    queue.Subscribe([&](const Ping& ping) {
+        received.push_back(ping.value);
+        if (ping.value < 3) {
+            queue.Enqueue(Ping{ping.value + 10});
+            queue.Flush();
+        }
+    });
+
+    queue.Enqueue(Ping{1});
+    queue.Enqueue(Ping{2});
+    queue.Flush();
+
+    PX_CHECK((received == std::vector<int>{1, 2, 11, 12}));
+    PX_CHECK(queue.GetPendingCount() == 0);
+}
+
+// Flushing the whole bus from a listener is deferred as well, and covers the other event types queued meanwhile.
+void TestNestedBusFlush() {
+    entt::registry registry{};
+    EventBus& bus = EventBus::Get(registry);
+    std::vector<int> pings{};
+    std::vector<int> pongs{};
+
+    bus.Subscribe<Ping>([&](const Ping& ping) {
+        pings.push_back(ping.value);
+        bus.Enqueue(Pong{ping.value});
+        bus.Flush();
+    });
+    bus.Subscribe<Pong>([&](const Pong& pong) {
+        pongs.push_back(pong.value);
+        if (pong.value == 1) {
+            bus.Enqueue(Ping{2});
+            bus.Flush();
+        }
+    });
+
+    bus.Enqueue(Ping{1});
+    bus.Flush();
+
+    PX_CHECK((pings == std::vector<int>{1, 2}));
+    PX_CHECK((pongs == std::vector<int>{1, 2}));
+}
+
+// Clearing from a listener drops what is queued but leaves the batch in flight intact.
+void TestClearDuringFlush() {
+    EventQueue<Ping> queue{};
+    std::vector<int> received{};
+    queue.Subscribe([&](const Ping& ping) {
+        received.push_back(ping.value);
+        queue.Enqueue(Ping{ping.value + 10});
+        queue.Clear();
+    });
+
+    queue.Enqueue(Ping{1});
+    queue.Enqueue(Ping{2});
+    queue.Flush();
+
+    PX_CHECK((received == std::vector<int>{1, 2}));
+    PX_CHECK(queue.GetPendingCount() == 0);
+}
+} // namespace
+
+int main() {
+    TestNestedQueueFlush();
+    TestNestedBusFlush();
+    TestClearDuringFlush();
+    return Test::Finish("EventBusTest");
+}
@@ -0,0 +1,131 @@
+#include "Components/BoxCollider2D.hpp"
+#include "Components/CircleCollider2D.hpp"
+#include "Components/ComponentModuleRegistry.hpp"
+#include "Components/RigidBody2D.hpp"
+#include "Components/Sprite.hpp"
+#include "Components/Tag.hpp"
+#include "Components/Transform.hpp"
+#include "Reflection/ReflectionInit.hpp"
+#include "Resources/AssetRegistry.hpp"
+#include "Resources/PrefabAsset.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneSerializer.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+#include <nlohmann/json.hpp>
+
+#include <memory>
+#include <random>
+#include <string>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr uint64_t PrefabUUID{0x5EED};
+
+std::shared_ptr<PrefabAsset> MakePrefab() {
+    entt::registry registry{};
+    entt::entity entity = registry.create();
+    registry.emplace<Tag>(entity, "Crate");
+    registry.emplace<Transform>(entity, Vector2{32.0f, 64.0f});
+    registry.emplace<Sprite>(entity).layer = 2;
+    registry.emplace<RigidBody2D>(entity).mass = 4.0f;
+    registry.emplace<BoxCollider2D>(entity).size = Vector2{2.0f, 3.0f};
+
+    std::string text = ComponentModuleRegistry::Instance().SerializeEntity(registry, entity).dump();
+    std::shared_ptr<PrefabAsset> prefab = std::make_shared<PrefabAsset>(UUID{PrefabUUID}, "Crate");
+    return prefab->Load(text.data(), text.size()) ? prefab : nullptr;
+}
+
+// Plain entities with a random subset of components, and prefab instances with random overrides, additions and
+// removals against their prefab.
+void PopulateRandomScene(Scene& scene, const PrefabAsset& prefab, std::mt19937& random) {
+    entt::registry& registry = scene.GetRegistry();
+    std::uniform_real_distribution<float> value{-100.0f, 100.0f};
+    std::bernoulli_distribution coin{0.5};
+
+    for (int i = 0; i < 64; ++i) {
+        entt::entity entity{};
+        if (coin(random)) {
+            entity = prefab.Instantiate(scene, 1).front();
+        }
+        else {
+            entity = scene.CreateEntity("Entity" + std::to_string(i));
+            if (coin(random)) {
+                registry.emplace<Sprite>(entity).layer = static_cast<int>(random() % 8);
+            }
+            if (coin(random)) {
+                registry.emplace<RigidBody2D>(entity);
+            }
+        }
+
+        if (coin(random)) {
+            registry.get<Transform>(entity).position = Vector2{value(random), value(random)};
+        }
+        if (coin(random)) {
+            registry.get<Transform>(entity).rotation = value(random);
+        }
+        if (RigidBody2D* body = registry.try_get<RigidBody2D>(entity); body && coin(random)) {
+            body->mass = value(random) + 101.0f;
+        }
+        if (coin(random)) {
+            registry.remove<BoxCollider2D>(entity);
+        }
+        if (coin(random)) {
+            registry.emplace_or_replace<CircleCollider2D>(entity).radius = value(random);
+        }
+    }
+}
+
+// Property: writing a scene delta-encoded and loading it back gives the same scene as the full encoding, for any
+// mix of plain entities and modified prefab instances.
+void TestDeltaRoundTrip() {
+    std::mt19937 random{1234};
+    for (int iteration = 0; iteration < 32; ++iteration) {
+        std::shared_ptr<PrefabAsset> prefab = MakePrefab();
+        PX_CHECK(prefab != nullptr);
+        if (!prefab) {
+            return;
+        }
+        AssetRegistry::Instance().AddLoadedAsset(prefab);
+
+        Scene source{"SceneDeltaTest"};
+        PopulateRandomScene(source, *prefab, random);
+
+        SceneSerializer sourceSerializer{&source};
+        std::string full = sourceSerializer.SerializeToString();
+        sourceSerializer.SetDeltaEncoding(true);
+        std::string delta = sourceSerializer.SerializeToString();
+        PX_CHECK(delta.size() < full.size());
+
+        Scene loaded{"SceneDeltaTest"};
+        SceneSerializer loadedSerializer{&loaded};
+        PX_CHECK(loadedSerializer.DeserializeFromString(delta));
+        PX_CHECK(loadedSerializer.SerializeToString() == full);
+
+        AssetRegistry::Instance().UnloadAll();
+    }
+}
+
+// Entities streamed before "delta" were created with the full encoding, so the file is rejected and the open
+// scene is left as it was.
+void TestDeltaAfterEntitiesRejected() {
+    Scene scene{"SceneDeltaTest"};
+    static_cast<void>(scene.CreateEntity("Kept"));
+
+    std::string text = R"({"entities":[{"uuid":7,"Transform":{"rotation":5.0}}],"delta":true,"scene":"Late"})";
+    SceneSerializer serializer{&scene};
+    PX_CHECK(!serializer.DeserializeFromString(text));
+    PX_CHECK(scene.GetName() == "SceneDeltaTest");
+    PX_CHECK(scene.GetEntityOrder().size() == 1);
+    PX_CHECK(scene.GetRegistry().get<Tag>(scene.GetEntityOrder()[0]).name == "Kept");
+}
+} // namespace
+
+int main() {
+    Reflection::InitializeReflection();
+    TestDeltaRoundTrip();
+    TestDeltaAfterEntitiesRejected();
+    return Test::Finish("SceneDeltaTest");
+}
@@ -0,0 +1,46 @@
+#include "Components/Tag.hpp"
+#include "Scene/Scene.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace PiiXeL;
+
+// Immediate destroys only leave holes in the entity order; the order handed out afterwards is compact, keeps the
+// survivors in their original sequence, and still accepts moves and new entities.
+int main() {
+    Scene scene{"SceneDestroyTest"};
+    std::vector<entt::entity> entities{};
+    for (int i = 0; i < 10; ++i) {
+        entities.push_back(scene.CreateEntity("Entity" + std::to_string(i)));
+    }
+
+    for (int i = 0; i < 10; i += 2) {
+        scene.DestroyEntityImmediate(entities[i]);
+    }
+    scene.DestroyEntity(entities[9]);
+    scene.FlushDestroyedEntities();
+
+    const EntityOrder& order = scene.GetEntityOrder();
+    PX_CHECK(order.size() == 4);
+    PX_CHECK(scene.GetEntityIndex().GetCount() == 4);
+    for (size_t i = 0; i < order.size(); ++i) {
+        PX_CHECK(order[i] == entities[i * 2 + 1]);
+    }
+
+    scene.DestroyEntityImmediate(entities[1]);
+    PX_CHECK(scene.GetEntityOrder().size() == 3);
+    PX_CHECK(!scene.GetEntityOrder().Contains(entities[1]));
+
+    scene.GetEntityOrder().Move(0, 2);
+    entt::entity added = scene.CreateEntity("Added");
+    PX_CHECK(scene.GetEntityOrder().size() == 4);
+    PX_CHECK(scene.GetEntityOrder()[2] == entities[3]);
+    PX_CHECK(scene.GetEntityOrder()[3] == added);
+    PX_CHECK(scene.GetRegistry().get<Tag>(scene.GetEntityOrder()[0]).name == "Entity5");
+
+    return Test::Finish("SceneDestroyTest");
+}
@@ -0,0 +1,119 @@
+#include "Scene/Scene.hpp"
+#include "Scene/SceneLoader.hpp"
+#include "TestHarness.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace PiiXeL;
+
+namespace {
+std::shared_ptr<const nlohmann::json> MakeScene(const char* name, uint64_t firstUUID, size_t entityCount) {
+    nlohmann::json sceneJson{{"scene", name}, {"entities", nlohmann::json::array()}};
+    for (size_t i = 0; i < entityCount; ++i) {
+        sceneJson["entities"].push_back({{"uuid", firstUUID + i}});
+    }
+    return std::make_shared<const nlohmann::json>(std::move(sceneJson));
+}
+
+// Runs loader updates until the operation is done, the way the engine drives it once per frame.
+std::vector<std::shared_ptr<SceneLoadOperation>> UpdateUntilDone(SceneLoader& loader, Scene* activeScene,
+                                                                 const SceneLoadOperation& operation) {
+    std::vector<std::shared_ptr<SceneLoadOperation>> finished{};
+    std::chrono::steady_clock::time_point timeout = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (!operation.IsDone() && std::chrono::steady_clock::now() < timeout) {
+        for (std::shared_ptr<SceneLoadOperation>& done : loader.Update(activeScene)) {
+            finished.push_back(std::move(done));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    return finished;
+}
+
+// The loader owns its share of a package scene, so the caller may drop the document right after the request.
+void TestPackageSceneOwnership() {
+    SceneLoader loader{};
+    std::shared_ptr<const nlohmann::json> sceneData = MakeScene("Package", 100, 3);
+    std::shared_ptr<SceneLoadOperation> operation = loader.LoadAsync(sceneData, "Package", SceneLoadMode::Single);
+    sceneData.reset();
+
+    UpdateUntilDone(loader, nullptr, *operation);
+    PX_CHECK(operation->GetState() == SceneLoadState::Completed);
+    std::unique_ptr<Scene> scene = operation->TakeScene();
+    PX_CHECK(scene && scene->GetEntityIndex().GetCount() == 3);
+}
+
+// An additive load queued behind a Single load must wait for the caller to swap scenes instead of going into the
+// scene that is about to be replaced.
+void TestAdditiveAfterSingle() {
+    SceneLoader loader{};
+    loader.SetFrameBudget(1000.0f);
+    Scene oldScene{"Old"};
+
+    std::shared_ptr<SceneLoadOperation> single =
+        loader.LoadAsync(MakeScene("Level", 200, 2), "Level", SceneLoadMode::Single);
+    std::shared_ptr<SceneLoadOperation> additive =
+        loader.LoadAsync(MakeScene("Overlay", 300, 1), "Overlay", SceneLoadMode::Additive);
+
+    std::vector<std::shared_ptr<SceneLoadOperation>> finished = UpdateUntilDone(loader, &oldScene, *single);
+    PX_CHECK(single->GetState() == SceneLoadState::Completed);
+    PX_CHECK(!additive->IsDone());
+    PX_CHECK(oldScene.GetEntityIndex().GetCount() == 0);
+
+    std::unique_ptr<Scene> level = single->TakeScene();
+    PX_CHECK(level != nullptr);
+    if (!level) {
+        return;
+    }
+
+    UpdateUntilDone(loader, level.get(), *additive);
+    PX_CHECK(additive->GetState() == SceneLoadState::Completed);
+    PX_CHECK(level->GetEntityIndex().GetCount() == 3);
+    PX_CHECK(oldScene.GetEntityIndex().GetCount() == 0);
+}
+
+// A scene with an entity whose uuid is not an unsigned number fails on the parse job and never reaches the scene.
+void TestMalformedUUID() {
+    SceneLoader loader{};
+    Scene scene{"Active"};
+    nlohmann::json sceneJson = *MakeScene("Broken", 500, 2);
+    sceneJson["entities"][1]["uuid"] = "not a number";
+    std::shared_ptr<SceneLoadOperation> operation = loader.LoadAsync(
+        std::make_shared<const nlohmann::json>(std::move(sceneJson)), "Broken", SceneLoadMode::Additive);
+
+    UpdateUntilDone(loader, &scene, *operation);
+    PX_CHECK(operation->GetState() == SceneLoadState::Failed);
+    PX_CHECK(scene.GetEntityIndex().GetCount() == 0);
+}
+
+// A cancelled load is handed back as failed and never touches the scene.
+void TestCancel() {
+    SceneLoader loader{};
+    Scene scene{"Active"};
+    std::shared_ptr<SceneLoadOperation> operation =
+        loader.LoadAsync(MakeScene("Cell", 400, 4), "Cell", SceneLoadMode::Additive);
+    operation->Cancel();
+
+    std::chrono::steady_clock::time_point timeout = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (loader.IsBusy() && std::chrono::steady_clock::now() < timeout) {
+        loader.Update(&scene);
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    PX_CHECK(operation->GetState() == SceneLoadState::Failed);
+    PX_CHECK(!loader.IsBusy());
+    PX_CHECK(scene.GetEntityIndex().GetCount() == 0);
+}
+} // namespace
+
+int main() {
+    TestPackageSceneOwnership();
+    TestAdditiveAfterSingle();
+    TestCancel();
+    TestMalformedUUID();
+    return Test::Finish("SceneLoaderTest");
+}
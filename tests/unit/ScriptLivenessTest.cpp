@@ -0,0 +1,95 @@
+#include "Components/Script.hpp"
+#include "Scene/Scene.hpp"
+#include "Scripting/ScriptComponent.hpp"
+#include "Systems/ScriptSystem.hpp"
+#include "TestHarness.hpp"
+
+#include <entt/entt.hpp>
+
+#include <memory>
+
+using namespace PiiXeL;
+
+namespace {
+class CountingScript : public ScriptComponent {
+public:
+    int updates{0};
+    entt::entity victim{entt::null};
+    bool removeVictimScript{false};
+
+protected:
+    void OnUpdate(float deltaTime) override {
+        (void)deltaTime;
+        ++updates;
+        if (victim == entt::null) {
+            return;
+        }
+
+        entt::registry& registry = GetScene()->GetRegistry();
+        if (removeVictimScript) {
+            registry.patch<Script>(victim, [](Script& script) { script.RemoveScript(0); });
+        }
+        else {
+            registry.destroy(victim);
+        }
+        victim = entt::null;
+    }
+};
+
+std::shared_ptr<CountingScript> Attach(Scene& scene, entt::entity entity) {
+    std::shared_ptr<CountingScript> instance = std::make_shared<CountingScript>();
+    Script script{};
+    script.AddScript(instance, "CountingScript");
+    scene.GetRegistry().emplace<Script>(entity, std::move(script));
+    return instance;
+}
+
+// A script removed or destroyed mid-frame by an earlier script must not run again, although the batch still
+// holds it until the next activation pass.
+void TestRemovedMidFrame(bool removeScript) {
+    Scene scene{"ScriptLivenessTest"};
+    entt::registry& registry = scene.GetRegistry();
+
+    entt::entity killerEntity = registry.create();
+    entt::entity victimEntity = registry.create();
+    std::shared_ptr<CountingScript> killer = Attach(scene, killerEntity);
+    std::shared_ptr<CountingScript> victim = Attach(scene, victimEntity);
+
+    ScriptSystem scripts{};
+    scripts.OnUpdate(&scene, 0.016f);
+    PX_CHECK(killer->updates == 1 && victim->updates == 1);
+
+    killer->victim = victimEntity;
+    killer->removeVictimScript = removeScript;
+    scripts.OnUpdate(&scene, 0.016f);
+    scripts.OnUpdate(&scene, 0.016f);
+    PX_CHECK(killer->updates == 3);
+    PX_CHECK(victim->updates == 1);
+}
+
+// Each registry keeps its own cache, so changing scripts in one scene does not rebuild another.
+void TestPerRegistryCache() {
+    Scene first{"First"};
+    Scene second{"Second"};
+    Attach(first, first.GetRegistry().create());
+    std::shared_ptr<CountingScript> other = Attach(second, second.GetRegistry().create());
+
+    ScriptSystem scripts{};
+    scripts.OnUpdate(&first, 0.016f);
+    scripts.OnUpdate(&second, 0.016f);
+
+    Attach(first, first.GetRegistry().create());
+    PX_CHECK(first.GetRegistry().ctx().get<ScriptBatchCache>().dirty);
+    PX_CHECK(!second.GetRegistry().ctx().get<ScriptBatchCache>().dirty);
+
+    scripts.OnUpdate(&second, 0.016f);
+    PX_CHECK(other->updates == 2);
+}
+} // namespace
+
+int main() {
+    TestRemovedMidFrame(false);
+    TestRemovedMidFrame(true);
+    TestPerRegistryCache();
+    return Test::Finish("ScriptLivenessTest");
+}
@@ -0,0 +1,111 @@
+#include "Build/GamePackage.hpp"
+#include "Components/Camera.hpp"
+#include "Components/Transform.hpp"
+#include "Reflection/ReflectionInit.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneLoader.hpp"
+#include "Scene/WorldPartition.hpp"
+#include "TestHarness.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace PiiXeL;
+
+namespace {
+constexpr float CellSize{1000.0f};
+
+// A camera in the persistent chunk and one entity in each of the cells (0, 0) and (1, 0), built on disk and then
+// packaged the way the GamePackageBuilder lays it out. The (1, 0) chunk is replaced by garbage when corrupt is set.
+GamePackage MakePackage(bool corrupt) {
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "piixel_world_partition_test";
+    std::filesystem::create_directories(directory);
+    std::filesystem::path manifestPath = directory / "World.partition";
+
+    Scene world{"World"};
+    entt::entity camera = world.CreateEntity("Camera");
+    world.GetRegistry().emplace<Camera>(camera);
+    world.GetRegistry().get<Transform>(world.CreateEntity("Near")).position = Vector2{100.0f, 100.0f};
+    world.GetRegistry().get<Transform>(world.CreateEntity("Far")).position = Vector2{CellSize + 100.0f, 100.0f};
+
+    WorldPartitionSettings settings{};
+    settings.cellSize = CellSize;
+    GamePackage package{};
+    PX_CHECK(WorldPartition::Build(world, manifestPath.string(), settings));
+
+    for (const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator(directory)) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+        std::ifstream file{entry.path(), std::ios::binary};
+        AssetData asset{};
+        asset.path = "scenes/" + std::filesystem::relative(entry.path(), directory).generic_string();
+        asset.type = "data";
+        asset.data.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+        if (corrupt && entry.path().filename() == "cell_1_0.pxscene") {
+            asset.data.assign(16, 0xAB);
+        }
+        package.AddAsset(asset);
+    }
+
+    std::filesystem::remove_all(directory);
+    return package;
+}
+
+// Runs partition and loader updates the way the engine does once per frame.
+void RunFrames(WorldPartition& partition, SceneLoader& loader, Scene& scene, int frames) {
+    for (int frame = 0; frame < frames; ++frame) {
+        partition.Update(Vector2{100.0f, 100.0f}, loader);
+        loader.Update(&scene);
+        std::this_thread::sleep_for(std::chrono::milliseconds{2});
+    }
+}
+
+// Every chunk is read from the package, none from disk: the files are gone before the partition is opened.
+void TestPackagedPartition() {
+    GamePackage package = MakePackage(false);
+    WorldPartition partition{};
+    PX_CHECK(partition.Open(package, "scenes/World.partition"));
+    PX_CHECK(partition.GetCellCount() == 2);
+
+    Scene scene{"World"};
+    PX_CHECK(partition.LoadPersistentChunk(scene));
+    PX_CHECK(scene.GetEntityIndex().GetCount() == 1);
+
+    SceneLoader loader{};
+    RunFrames(partition, loader, scene, 200);
+    PX_CHECK(scene.GetEntityIndex().GetCount() == 3);
+    PX_CHECK(partition.GetActiveCellCount() == 2);
+    partition.Close();
+}
+
+// A cell whose chunk does not load is requested again while in range and dropped after its last attempt, while
+// the healthy cell next to it stays loaded.
+void TestFailedCellRetried() {
+    GamePackage package = MakePackage(true);
+    WorldPartition partition{};
+    PX_CHECK(partition.Open(package, "scenes/World.partition"));
+
+    Scene scene{"World"};
+    PX_CHECK(partition.LoadPersistentChunk(scene));
+
+    SceneLoader loader{};
+    RunFrames(partition, loader, scene, 200);
+    PX_CHECK(scene.GetEntityIndex().GetCount() == 2);
+    PX_CHECK(partition.GetActiveCellCount() == 1);
+    partition.Close();
+}
+} // namespace
+
+int main() {
+    Reflection::InitializeReflection();
+    TestPackagedPartition();
+    TestFailedCellRetried();
+    return Test::Finish("WorldPartitionTest");
+}
@@ -1,4 +1,5 @@
 #include "Build/GamePackageBuilder.hpp"
+#include "Reflection/ReflectionInit.hpp"
 #include <iostream>
 #include <filesystem>
 
@@ -27,6 +28,9 @@ int main(int argc, char* argv[]) {
     std::cout << "Project path: " << projectPath << std::endl;
     std::cout << "Output path: " << outputPath << std::endl;
 
+    // The binary scene converter and prefab loading go through the component modules.
+    PiiXeL::Reflection::InitializeReflection();
+
     PiiXeL::GamePackageBuilder builder{};
 
     if (builder.BuildFromProject(projectPath, outputPath)) {